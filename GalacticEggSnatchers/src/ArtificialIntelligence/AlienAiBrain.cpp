@@ -3,20 +3,16 @@
 using namespace ARTIFICIAL_INTELLIGENCE;
 
 AlienAiBrain::AlienAiBrain(
-    const unsigned int minTimeBetweenMissileFiresInSeconds,
-    const unsigned int maxTimeBetweenMissileFiresInSeconds) :
-    m_missileFiringClock(),
-    m_minTimeBetweenMissileFiresInSeconds(),
-    m_randomNumberGenerator()
+    const float minTimeBetweenMissileFiresInSeconds,
+    const float maxTimeBetweenMissileFiresInSeconds,
+    SIMULATION::RandomNumberGenerator& randomNumberGenerator) :
+    m_minTimeBetweenMissileFiresInSeconds()
 {
-    InitializeRandomNumberGenerator();
-    InitializeTimeBetweenMissileFires(minTimeBetweenMissileFiresInSeconds, maxTimeBetweenMissileFiresInSeconds);
+    InitializeTimeBetweenMissileFires(minTimeBetweenMissileFiresInSeconds, maxTimeBetweenMissileFiresInSeconds, randomNumberGenerator);
 }
 
 AlienAiBrain::AlienAiBrain(const AlienAiBrain& brainToCopy) :
-    m_missileFiringClock(),
-    m_minTimeBetweenMissileFiresInSeconds(),
-    m_randomNumberGenerator()
+    m_minTimeBetweenMissileFiresInSeconds()
 {
     Copy(brainToCopy);
 }
@@ -40,61 +36,47 @@ AlienAiBrain& AlienAiBrain::operator= (const AlienAiBrain& rhsBrain)
     return (*this);
 }
 
-bool AlienAiBrain::ShouldFireMissile()
+sf::Time AlienAiBrain::GetTimeUntilNextMissileFire(SIMULATION::RandomNumberGenerator& randomNumberGenerator) const
 {
-    // CHECK IF SUFFICIENT TIME HAS PASSED SINCE A MISSILE WAS LAST DESIRED FOR FIRING.
+    // WAIT A MINIMUM AMOUNT OF TIME BEFORE FIRING.
     // This prevents missiles from being fired too quickly and overwhelming players.
-    sf::Time elapsedTimeSinceLastMissileFired = m_missileFiringClock.getElapsedTime();
-    float elapsedTimeSinceLastMissileFiredInSeconds = elapsedTimeSinceLastMissileFired.asSeconds();
-    bool missileFiringTimeDelayExceeded = (elapsedTimeSinceLastMissileFiredInSeconds > m_minTimeBetweenMissileFiresInSeconds);
-    if (!missileFiringTimeDelayExceeded)
-    {
-        // We need to wait longer before firing a missile.
-        return false;
-    }
-    
-    // GENERATE A RANDOM NUMBER TO DETERMINE IF A MISSILE SHOULD BE FIRED.
+    sf::Time timeUntilNextMissileFire = sf::seconds(m_minTimeBetweenMissileFiresInSeconds);
+
+    // DECIDE HOW MANY MORE DECISIONS ARE NEEDED BEFORE A MISSILE IS FIRED.
+    // Once the minimum time has passed, the alien repeatedly decides whether or not to fire,
+    // with only a certain chance of firing at each decision.  All decisions are made at once
+    // so that the alien doesn't need to be asked at every decision.
+    const sf::Time TIME_BETWEEN_DECISIONS = sf::microseconds(1000000 / 60);
     // A range of 0 - 99 is used because it is simple to understand in terms of common percentages.
     const unsigned int MAX_RANDOM_RANGE = 100;
-    unsigned int randomNumber = (m_randomNumberGenerator() % MAX_RANDOM_RANGE);
-
-    // CHECK IF THE RANDOM NUMBER WAS WITHIN THE MISSILE FIRING THRESHOLD.
     // A missile should only be fired if the random number is below a certain value.
     // This value may be adjusted later depending on how the gameplay feels.
     const unsigned int FIRE_MISSILE_MAX_THRESHOLD = 10;
-    bool shouldFireMissile = (randomNumber < FIRE_MISSILE_MAX_THRESHOLD);
-
-    // CHECK IF A MISSILE WAS DESIRED TO BE FIRED.
-    if (shouldFireMissile)
+    unsigned int decisionCountUntilFiring = 1;
+    while (randomNumberGenerator.GenerateNumberLessThan(MAX_RANDOM_RANGE) >= FIRE_MISSILE_MAX_THRESHOLD)
     {
-        // Reset the clock to allow another missile to be fired after sufficient time passes.
-        m_missileFiringClock.restart();
+        ++decisionCountUntilFiring;
     }
 
-    return shouldFireMissile;
+    timeUntilNextMissileFire += TIME_BETWEEN_DECISIONS * static_cast<sf::Int64>(decisionCountUntilFiring);
+    return timeUntilNextMissileFire;
 }
 
 void AlienAiBrain::Copy(const AlienAiBrain& brainToCopy)
 {
-    this->m_missileFiringClock = brainToCopy.m_missileFiringClock;
     this->m_minTimeBetweenMissileFiresInSeconds = brainToCopy.m_minTimeBetweenMissileFiresInSeconds;
-    this->m_randomNumberGenerator = brainToCopy.m_randomNumberGenerator;
-}
-        
-void AlienAiBrain::InitializeRandomNumberGenerator()
-{
-    // Initialize the random number generator with a seed based on the address of this object.
-    // This has been found to provide better randomness than seeding based on time.
-    unsigned long seed = reinterpret_cast<unsigned long>(this);
-    m_randomNumberGenerator.seed(seed);
 }
 
 void AlienAiBrain::InitializeTimeBetweenMissileFires(
-    const unsigned int minTimeBetweenMissileFiresInSeconds,
-    const unsigned int maxTimeBetweenMissileFiresInSeconds)
+    const float minTimeBetweenMissileFiresInSeconds,
+    const float maxTimeBetweenMissileFiresInSeconds,
+    SIMULATION::RandomNumberGenerator& randomNumberGenerator)
 {
     // GENERATE A RANDOM NUMBER OF SECONDS REQUIRED BETWEEN MISSILE FIRES.
     // This helps give more appearance of randomness in the alien missile firing.
-    unsigned int randomSeconds = ( (m_randomNumberGenerator() % maxTimeBetweenMissileFiresInSeconds) + minTimeBetweenMissileFiresInSeconds );
-    m_minTimeBetweenMissileFiresInSeconds = static_cast<float>(randomSeconds);
-}
\ No newline at end of file
+    // Only whole seconds are added randomly, so a maximum time under a second
+    // leaves the minimum time unchanged.
+    unsigned int maxRandomWholeSeconds = static_cast<unsigned int>(maxTimeBetweenMissileFiresInSeconds);
+    unsigned int randomWholeSeconds = randomNumberGenerator.GenerateNumberLessThan(maxRandomWholeSeconds);
+    m_minTimeBetweenMissileFiresInSeconds = ( static_cast<float>(randomWholeSeconds) + minTimeBetweenMissileFiresInSeconds );
+}
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <random>
 #include <SFML/System.hpp>
+#include "Simulation/RandomNumberGenerator.h"
 
 /// @brief  Code related to artificial intelligence.
 namespace ARTIFICIAL_INTELLIGENCE
@@ -9,23 +9,32 @@ namespace ARTIFICIAL_INTELLIGENCE
     ////////////////////////////////////////////////////////
     /// @brief  The artificial intelligence "brain" that is used
     ///         to make decisions for aliens.
+    ///
+    ///         Brains only hold a small amount of timing state so that
+    ///         many can be stored contiguously.  Randomness comes from a
+    ///         generator shared by all brains rather than one per brain.
+    ///         Rather than being asked every update whether to fire,
+    ///         a brain decides up front how long to wait before its next
+    ///         missile, allowing the wait to be scheduled as a single timer.
     ////////////////////////////////////////////////////////
     class AlienAiBrain
     {
     public:
-        /// @brief      Constructor.
-        ///             The provided time ranges can help be used to tune the difficulty
-        ///             of the artificial intelligence.  However, they are not strictly
-        ///             guaranteed to be absolute minimums and maximums - randomness
-        ///             is involved, so an alien may fire more or less often than
-        ///             the time range provided.
-        /// @param[in]  minTimeBetweenMissileFiresInSeconds - The miminum possible time
-        ///             between the brain deciding that it wants to fire a missile.
-        /// @param[in]  maxTimeBetweenMissileFiresInSeconds - The maximum possible time
-        ///             between the brain deciding that it wants to fire a missile.
+        /// @brief          Constructor.
+        ///                 The provided time ranges can help be used to tune the difficulty
+        ///                 of the artificial intelligence.  However, they are not strictly
+        ///                 guaranteed to be absolute minimums and maximums - randomness
+        ///                 is involved, so an alien may fire more or less often than
+        ///                 the time range provided.
+        /// @param[in]      minTimeBetweenMissileFiresInSeconds - The miminum possible time
+        ///                 between the brain deciding that it wants to fire a missile.
+        /// @param[in]      maxTimeBetweenMissileFiresInSeconds - The maximum possible time
+        ///                 between the brain deciding that it wants to fire a missile.
+        /// @param[in,out]  randomNumberGenerator - The random number generator for making decisions.
         explicit AlienAiBrain(
-            const unsigned int minTimeBetweenMissileFiresInSeconds,
-            const unsigned int maxTimeBetweenMissileFiresInSeconds);
+            const float minTimeBetweenMissileFiresInSeconds,
+            const float maxTimeBetweenMissileFiresInSeconds,
+            SIMULATION::RandomNumberGenerator& randomNumberGenerator);
         
         /// @brief      Copy constructor.
         /// @param[in]  brainToCopy - The brain to copy from.
@@ -39,34 +48,33 @@ namespace ARTIFICIAL_INTELLIGENCE
         /// @return     This brain with data copied from the provided brain.
         AlienAiBrain& operator= (const AlienAiBrain& rhsBrain);
 
-        /// @brief  Determines whether this alien brain desires firing a missile.
-        /// @return True if the brain wants to fire a missile; false otherwise.
-        bool ShouldFireMissile();
+        /// @brief          Decides how long this alien brain waits before firing its next missile,
+        ///                 starting from when it was created or last fired.
+        /// @param[in,out]  randomNumberGenerator - The random number generator for making decisions.
+        /// @return         The simulation time until the brain wants to fire a missile.
+        sf::Time GetTimeUntilNextMissileFire(SIMULATION::RandomNumberGenerator& randomNumberGenerator) const;
 
     private:
         /// @brief      Helper method for copying.
         /// @param[in]  brainToCopy - The brain to copy.
         void Copy(const AlienAiBrain& brainToCopy);
-        
-        /// @brief  Initializes the internal random number generator.
-        void InitializeRandomNumberGenerator();
 
-        /// @brief      Initializes the minimum required time between missile fires.
-        ///             The provided time ranges can help be used to tune the difficulty
-        ///             of the artificial intelligence.  However, they are not strictly
-        ///             guaranteed to be absolute minimums and maximums - randomness
-        ///             is involved, so an alien may fire more or less often than
-        ///             the time range provided.
-        /// @param[in]  minTimeBetweenMissileFiresInSeconds - The miminum possible time
-        ///             between the brain deciding that it wants to fire a missile.
-        /// @param[in]  maxTimeBetweenMissileFiresInSeconds - The maximum possible time
-        ///             between the brain deciding that it wants to fire a missile.
+        /// @brief          Initializes the minimum required time between missile fires.
+        ///                 The provided time ranges can help be used to tune the difficulty
+        ///                 of the artificial intelligence.  However, they are not strictly
+        ///                 guaranteed to be absolute minimums and maximums - randomness
+        ///                 is involved, so an alien may fire more or less often than
+        ///                 the time range provided.
+        /// @param[in]      minTimeBetweenMissileFiresInSeconds - The miminum possible time
+        ///                 between the brain deciding that it wants to fire a missile.
+        /// @param[in]      maxTimeBetweenMissileFiresInSeconds - The maximum possible time
+        ///                 between the brain deciding that it wants to fire a missile.
+        /// @param[in,out]  randomNumberGenerator - The random number generator for making decisions.
         void InitializeTimeBetweenMissileFires(
-            const unsigned int minTimeBetweenMissileFiresInSeconds,
-            const unsigned int maxTimeBetweenMissileFiresInSeconds);
+            const float minTimeBetweenMissileFiresInSeconds,
+            const float maxTimeBetweenMissileFiresInSeconds,
+            SIMULATION::RandomNumberGenerator& randomNumberGenerator);
 
-        sf::Clock m_missileFiringClock;    ///< A clock for tracking how much time passes between desiring firing a missile.
         float m_minTimeBetweenMissileFiresInSeconds;    ///< The minimum amount of time required between missile fires in seconds.
-        std::default_random_engine m_randomNumberGenerator; ///< The random number generator used for making decisions.
     };
-}
\ No newline at end of file
+}
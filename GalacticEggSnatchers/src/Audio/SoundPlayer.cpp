@@ -0,0 +1,143 @@
+#include <algorithm>
+#include "Audio/SoundPlayer.h"
+
+using namespace AUDIO;
+
+SoundPlayer::SoundPlayer(const unsigned int voiceCount) :
+    m_voices(voiceCount),
+    m_soundRequests(),
+    m_playCounter(0)
+{
+    // INITIALIZE THE VOICES AS FREE.
+    for (Voice& voice : m_voices)
+    {
+        voice.Priority = SOUND_PRIORITY_LOW;
+        voice.StartTime = 0;
+    }
+
+    // Space for a request per voice avoids allocating for typical frames.
+    m_soundRequests.reserve(voiceCount);
+}
+
+SoundPlayer::~SoundPlayer()
+{
+    StopAll();
+}
+
+void SoundPlayer::Play(const std::shared_ptr<sf::SoundBuffer>& soundBuffer, const SoundPriority priority)
+{
+    // CHECK IF THE SOUND CAN BE PLAYED.
+    // No sound buffers or voices exist without an audio device.
+    bool soundExists = (nullptr != soundBuffer);
+    bool voicesExist = !m_voices.empty();
+    if (!soundExists || !voicesExist)
+    {
+        return;
+    }
+
+    // COMBINE THE REQUEST WITH AN IDENTICAL ONE FROM THIS FRAME.
+    // The combined sound keeps the highest requested priority.
+    for (SoundRequest& soundRequest : m_soundRequests)
+    {
+        bool sameSound = (soundBuffer == soundRequest.SoundBuffer);
+        if (sameSound)
+        {
+            soundRequest.Priority = std::max(soundRequest.Priority, priority);
+            return;
+        }
+    }
+
+    // ADD THE REQUEST.
+    SoundRequest soundRequest;
+    soundRequest.SoundBuffer = soundBuffer;
+    soundRequest.Priority = priority;
+    m_soundRequests.push_back(soundRequest);
+}
+
+void SoundPlayer::Update()
+{
+    // START EACH REQUESTED SOUND ON A VOICE.
+    for (const SoundRequest& soundRequest : m_soundRequests)
+    {
+        // The sound is dropped if all voices are busy with more important sounds.
+        Voice* voice = FindVoice(soundRequest.Priority);
+        bool voiceFound = (nullptr != voice);
+        if (!voiceFound)
+        {
+            continue;
+        }
+
+        // Only switch buffers when needed since it requires the voice to be stopped.
+        voice->Sound.stop();
+        bool bufferChanged = (voice->SoundBuffer != soundRequest.SoundBuffer);
+        if (bufferChanged)
+        {
+            voice->Sound.setBuffer(*soundRequest.SoundBuffer);
+            voice->SoundBuffer = soundRequest.SoundBuffer;
+        }
+
+        ++m_playCounter;
+        voice->Priority = soundRequest.Priority;
+        voice->StartTime = m_playCounter;
+        voice->Sound.play();
+    }
+
+    m_soundRequests.clear();
+}
+
+void SoundPlayer::StopAll()
+{
+    for (Voice& voice : m_voices)
+    {
+        voice.Sound.stop();
+    }
+
+    m_soundRequests.clear();
+}
+
+unsigned int SoundPlayer::GetPlayingVoiceCount() const
+{
+    unsigned int playingVoiceCount = 0;
+    for (const Voice& voice : m_voices)
+    {
+        bool voicePlaying = (sf::Sound::Playing == voice.Sound.getStatus());
+        if (voicePlaying)
+        {
+            ++playingVoiceCount;
+        }
+    }
+
+    return playingVoiceCount;
+}
+
+SoundPlayer::Voice* SoundPlayer::FindVoice(const SoundPriority priority)
+{
+    Voice* voiceToSteal = nullptr;
+    for (Voice& voice : m_voices)
+    {
+        // USE THE VOICE IF IT IS FREE.
+        bool voicePlaying = (sf::Sound::Playing == voice.Sound.getStatus());
+        if (!voicePlaying)
+        {
+            return &voice;
+        }
+
+        // CHECK IF THE VOICE MAY BE STOLEN.
+        bool voiceMoreImportant = (voice.Priority > priority);
+        if (voiceMoreImportant)
+        {
+            continue;
+        }
+
+        // PREFER STEALING THE LOWEST PRIORITY, OLDEST SOUND.
+        bool betterVoiceToSteal = (nullptr == voiceToSteal) ||
+            (voice.Priority < voiceToSteal->Priority) ||
+            ((voice.Priority == voiceToSteal->Priority) && (voice.StartTime < voiceToSteal->StartTime));
+        if (betterVoiceToSteal)
+        {
+            voiceToSteal = &voice;
+        }
+    }
+
+    return voiceToSteal;
+}
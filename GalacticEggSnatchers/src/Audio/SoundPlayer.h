@@ -0,0 +1,103 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <SFML/Audio.hpp>
+
+/// @brief  Code related to playing audio for the game.
+namespace AUDIO
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  How important it is for a sound to be heard.
+    ///         When all voices are busy, a new sound may take
+    ///         over a voice playing a sound of equal or lower priority.
+    ////////////////////////////////////////////////////////
+    enum SoundPriority
+    {
+        SOUND_PRIORITY_LOW, ///< Frequent sounds that can be dropped without being missed.
+        SOUND_PRIORITY_NORMAL,  ///< Ordinary sounds.
+        SOUND_PRIORITY_HIGH ///< Sounds responding directly to the player that should always be heard.
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  Plays one-shot sounds on a fixed number of voices
+    ///         that are created once and reused, so playing sounds
+    ///         never allocates memory or creates more audio sources
+    ///         than the audio device supports.
+    ///
+    ///         Sounds requested with Play() are only started when
+    ///         Update() is called, once per frame.  Requests for the
+    ///         same sound in the same frame are combined into a single
+    ///         sound since playing identical sounds at the same time
+    ///         would only make them louder.  If no voice is free, the
+    ///         voice playing the lowest priority sound is stolen,
+    ///         preferring the one that has been playing the longest.
+    ////////////////////////////////////////////////////////
+    class SoundPlayer
+    {
+    public:
+        /// @brief  The default number of voices, which is well below the
+        ///         number of audio sources supported by audio devices.
+        static const unsigned int DEFAULT_VOICE_COUNT = 16;
+
+        /// @brief      Constructor.
+        /// @param[in]  voiceCount - The number of sounds that may play at once.
+        ///             0 if no audio device exists, in which case no sounds are played.
+        explicit SoundPlayer(const unsigned int voiceCount);
+
+        /// @brief  Destructor.  Stops all sounds.
+        ~SoundPlayer();
+
+        /// @brief      Requests that a sound be played when this player is next updated.
+        /// @param[in]  soundBuffer - The sound to play.  Ignored if null.
+        /// @param[in]  priority - How important it is for the sound to be heard.
+        void Play(const std::shared_ptr<sf::SoundBuffer>& soundBuffer, const SoundPriority priority);
+
+        /// @brief  Starts playing all sounds requested since the last update.
+        void Update();
+
+        /// @brief  Stops all playing sounds and discards any requested sounds.
+        void StopAll();
+
+        /// @brief  Gets the number of voices currently playing a sound.
+        /// @return The number of playing voices.
+        unsigned int GetPlayingVoiceCount() const;
+
+    private:
+        SoundPlayer(const SoundPlayer& playerToCopy);   ///< Private to disallow copying.
+        SoundPlayer& operator= (const SoundPlayer& rhsPlayer);  ///< Private to disallow assignment.
+
+        ////////////////////////////////////////////////////////
+        /// @brief  A reusable source for playing a single sound.
+        ////////////////////////////////////////////////////////
+        struct Voice
+        {
+            /// @brief  The buffer being played.  Held so it can't be freed while playing,
+            ///         and declared before the sound so that it outlives the sound.
+            std::shared_ptr<sf::SoundBuffer> SoundBuffer;
+            sf::Sound Sound;    ///< The sound played by the voice.
+            SoundPriority Priority; ///< The priority of the sound being played.
+            unsigned long long StartTime;   ///< The value of the play counter when the sound was started.
+        };
+
+        ////////////////////////////////////////////////////////
+        /// @brief  A sound requested to be played during the next update.
+        ////////////////////////////////////////////////////////
+        struct SoundRequest
+        {
+            std::shared_ptr<sf::SoundBuffer> SoundBuffer;   ///< The sound to play.
+            SoundPriority Priority; ///< How important it is for the sound to be heard.
+        };
+
+        /// @brief      Finds the voice to play a new sound on.
+        /// @param[in]  priority - The priority of the new sound.
+        /// @return     A free voice if one exists; otherwise, the voice playing the lowest priority,
+        ///             oldest sound if its priority doesn't exceed the new sound's.  Null if no voice
+        ///             can be used.
+        Voice* FindVoice(const SoundPriority priority);
+
+        std::vector<Voice> m_voices;    ///< The voices that sounds are played on.
+        std::vector<SoundRequest> m_soundRequests;  ///< The sounds requested since the last update.
+        unsigned long long m_playCounter;   ///< Incremented each time a sound is started to track how long sounds have been playing.
+    };
+}
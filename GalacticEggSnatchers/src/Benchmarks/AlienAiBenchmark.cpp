@@ -0,0 +1,44 @@
+#include <SFML/System.hpp>
+#include "ArtificialIntelligence/AlienAiBrain.h"
+#include "Benchmarks/AlienAiBenchmark.h"
+#include "Benchmarks/BenchmarkMeasurement.h"
+#include "Simulation/RandomNumberGenerator.h"
+
+void BENCHMARKS::RunAlienAiBenchmark(const std::vector<unsigned int>& entityCounts, std::ostream& output)
+{
+    output << "Alien AI benchmark" << std::endl;
+
+    for (unsigned int entityCount : entityCounts)
+    {
+        // CREATE THE ALIEN BRAINS.
+        // A fixed seed is used so that every run measures the same workload.
+        // The default difficulty of the first wave of aliens is used.
+        const uint64_t RANDOM_SEED = 2014;
+        SIMULATION::RandomNumberGenerator randomNumberGenerator(RANDOM_SEED);
+        const unsigned int MIN_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS = 3;
+        const unsigned int MAX_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS = 60;
+        std::vector<ARTIFICIAL_INTELLIGENCE::AlienAiBrain> brains;
+        brains.reserve(entityCount);
+        for (unsigned int brainIndex = 0; brainIndex < entityCount; ++brainIndex)
+        {
+            brains.push_back(ARTIFICIAL_INTELLIGENCE::AlienAiBrain(
+                MIN_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS,
+                MAX_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS,
+                randomNumberGenerator));
+        }
+
+        // MEASURE DECIDING WHEN EACH ALIEN FIRES ITS NEXT MISSILE.
+        unsigned int repetitionCount = GetRepetitionCount(entityCount);
+        uint64_t totalTimeUntilMissileFiresInMicroseconds = 0;
+        sf::Clock measurementClock;
+        for (unsigned int repetitionIndex = 0; repetitionIndex < repetitionCount; ++repetitionIndex)
+        {
+            for (const ARTIFICIAL_INTELLIGENCE::AlienAiBrain& brain : brains)
+            {
+                sf::Time timeUntilNextMissileFire = brain.GetTimeUntilNextMissileFire(randomNumberGenerator);
+                totalTimeUntilMissileFiresInMicroseconds += timeUntilNextMissileFire.asMicroseconds();
+            }
+        }
+        WriteMeasurement("Time until missile fire", entityCount, repetitionCount, measurementClock.getElapsedTime(), totalTimeUntilMissileFiresInMicroseconds, output);
+    }
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+namespace BENCHMARKS
+{
+    /// @brief          Measures how quickly aliens can decide when to fire their next missiles,
+    ///                 for each entity count, and writes a human-readable report.
+    /// @param[in]      entityCounts - The numbers of aliens to measure with.
+    /// @param[in,out]  output - The stream to write the report to.
+    void RunAlienAiBenchmark(const std::vector<unsigned int>& entityCounts, std::ostream& output);
+}
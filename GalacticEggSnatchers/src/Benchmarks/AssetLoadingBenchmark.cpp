@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <SFML/System.hpp>
+#include "Benchmarks/AssetLoadingBenchmark.h"
+#include "Resources/AssetArchive.h"
+#include "Resources/AssetFilepaths.h"
+#include "Resources/ResourceManager.h"
+
+/// @brief      Measures the fastest of several loads of assets with the specified number of threads.
+///             A new resource manager is used for each load so that no assets are already loaded.
+/// @param[in]  assetFilepaths - The filepaths of the assets to load.
+/// @param[in]  threadCount - The number of threads to load assets with.
+/// @return     The fastest wall-clock time to load the assets, in seconds.
+static float MeasureAssetLoading(const std::vector<std::string>& assetFilepaths, const unsigned int threadCount)
+{
+    // The fastest load is used since it is least affected by other activity on the machine.
+    const unsigned int LOAD_COUNT = 10;
+    float fastestLoadTimeInSeconds = 0.0f;
+    for (unsigned int loadIndex = 0; loadIndex < LOAD_COUNT; ++loadIndex)
+    {
+        RESOURCES::ResourceManager resourceManager;
+        resourceManager.MountArchive(RESOURCES::AssetArchive::DEFAULT_FILEPATH);
+        sf::Time loadTime = resourceManager.PreloadAssets(assetFilepaths, threadCount);
+
+        float loadTimeInSeconds = loadTime.asSeconds();
+        bool firstLoad = (0 == loadIndex);
+        fastestLoadTimeInSeconds = firstLoad ? loadTimeInSeconds : std::min(fastestLoadTimeInSeconds, loadTimeInSeconds);
+    }
+
+    return fastestLoadTimeInSeconds;
+}
+
+void BENCHMARKS::RunAssetLoadingBenchmark(std::ostream& output)
+{
+    std::vector<std::string> assetFilepaths = RESOURCES::GetAllAssetFilepaths();
+    output << "Asset loading benchmark" << std::endl;
+    output << "  " << assetFilepaths.size() << " assets" << std::endl;
+
+    // MEASURE SERIAL AND PARALLEL LOADING.
+    const unsigned int SERIAL_THREAD_COUNT = 1;
+    unsigned int parallelThreadCount = RESOURCES::ResourceManager::GetDefaultPreloadThreadCount();
+    const unsigned int THREAD_COUNTS[] = { SERIAL_THREAD_COUNT, parallelThreadCount };
+    const unsigned int THREAD_COUNT_COUNT = sizeof(THREAD_COUNTS) / sizeof(THREAD_COUNTS[0]);
+
+    float serialTimeInSeconds = 0.0f;
+    for (unsigned int threadCountIndex = 0; threadCountIndex < THREAD_COUNT_COUNT; ++threadCountIndex)
+    {
+        unsigned int threadCount = THREAD_COUNTS[threadCountIndex];
+        float loadTimeInSeconds = MeasureAssetLoading(assetFilepaths, threadCount);
+
+        // REPORT THE MEASUREMENT RELATIVE TO SERIAL LOADING.
+        bool isSerialLoading = (SERIAL_THREAD_COUNT == threadCount);
+        if (isSerialLoading)
+        {
+            serialTimeInSeconds = loadTimeInSeconds;
+        }
+
+        const float MILLISECONDS_PER_SECOND = 1000.0f;
+        float speedup = (loadTimeInSeconds > 0.0f) ? (serialTimeInSeconds / loadTimeInSeconds) : 0.0f;
+        output << "    " << std::setw(3) << threadCount << " thread(s)"
+            << std::fixed << std::setprecision(2)
+            << std::setw(10) << (loadTimeInSeconds * MILLISECONDS_PER_SECOND) << " ms"
+            << std::setw(8) << speedup << "x"
+            << std::endl;
+    }
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <ostream>
+
+namespace BENCHMARKS
+{
+    /// @brief          Measures the wall-clock time to load all game assets serially
+    ///                 on one thread and concurrently on all available threads,
+    ///                 and writes a human-readable report.  Images are always decoded
+    ///                 from their encoded data rather than the decoded image cache.
+    /// @param[in,out]  output - The stream to write the report to.
+    void RunAssetLoadingBenchmark(std::ostream& output);
+}
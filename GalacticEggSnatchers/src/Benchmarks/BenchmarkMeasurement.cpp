@@ -0,0 +1,39 @@
+#include <iomanip>
+#include "Benchmarks/BenchmarkMeasurement.h"
+
+std::vector<unsigned int> BENCHMARKS::GetDefaultEntityCounts()
+{
+    std::vector<unsigned int> entityCounts;
+    entityCounts.push_back(30);
+    entityCounts.push_back(300);
+    entityCounts.push_back(3000);
+    return entityCounts;
+}
+
+unsigned int BENCHMARKS::GetRepetitionCount(const unsigned int entityCount)
+{
+    const unsigned int ENTITIES_PROCESSED_PER_MEASUREMENT = 3000000;
+    unsigned int repetitionCount = (ENTITIES_PROCESSED_PER_MEASUREMENT / entityCount) + 1;
+    return repetitionCount;
+}
+
+void BENCHMARKS::WriteMeasurement(
+    const std::string& description,
+    const unsigned int entityCount,
+    const unsigned int repetitionCount,
+    const sf::Time& measurementTime,
+    const uint64_t checksum,
+    std::ostream& output)
+{
+    const float NANOSECONDS_PER_MICROSECOND = 1000.0f;
+    float measurementTimeInNanoseconds = static_cast<float>(measurementTime.asMicroseconds()) * NANOSECONDS_PER_MICROSECOND;
+    float processedEntityCount = static_cast<float>(entityCount) * static_cast<float>(repetitionCount);
+    float nanosecondsPerEntity = measurementTimeInNanoseconds / processedEntityCount;
+
+    output << "    " << std::setw(24) << std::left << description
+        << std::right << std::setw(8) << entityCount << " entities"
+        << std::fixed << std::setprecision(1)
+        << std::setw(10) << nanosecondsPerEntity << " ns/entity"
+        << "  (checksum " << checksum << ")"
+        << std::endl;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <SFML/System.hpp>
+
+namespace BENCHMARKS
+{
+    /// @brief  Gets the default numbers of entities that benchmarks of gameplay hot paths
+    ///         are measured with, ranging from normal gameplay to far beyond it.
+    /// @return The entity counts, in increasing order.
+    std::vector<unsigned int> GetDefaultEntityCounts();
+
+    /// @brief      Gets the number of times to repeat a benchmarked operation on a number of entities
+    ///             so that each measurement processes roughly the same number of entities.  This keeps
+    ///             measurements long enough to be reliable for small entity counts.
+    /// @param[in]  entityCount - The number of entities processed by each repetition.
+    /// @return     The number of repetitions to measure.
+    unsigned int GetRepetitionCount(const unsigned int entityCount);
+
+    /// @brief          Writes a single measurement of a benchmark as the average time per entity.
+    /// @param[in]      description - A short description of what was measured.
+    /// @param[in]      entityCount - The number of entities processed by each repetition.
+    /// @param[in]      repetitionCount - The number of repetitions measured.
+    /// @param[in]      measurementTime - The total time of all repetitions.
+    /// @param[in]      checksum - A value computed from the results of the measured operations,
+    ///                 which keeps them from being optimized away and allows runs to be compared.
+    /// @param[in,out]  output - The stream to write the measurement to.
+    void WriteMeasurement(
+        const std::string& description,
+        const unsigned int entityCount,
+        const unsigned int repetitionCount,
+        const sf::Time& measurementTime,
+        const uint64_t checksum,
+        std::ostream& output);
+}
@@ -0,0 +1,226 @@
+#include <memory>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+#include "Benchmarks/BenchmarkMeasurement.h"
+#include "Benchmarks/CollisionBenchmark.h"
+#include "Objects/AlienStore.h"
+#include "Objects/EasterBunny.h"
+#include "Objects/EasterEgg.h"
+#include "Objects/Weapons/MissilePool.h"
+#include "Physics/Collisions/CollisionSystem.h"
+#include "Simulation/RandomNumberGenerator.h"
+
+/// @brief  The boundaries of the screen that objects are confined to.
+static const sf::FloatRect SCREEN_BOUNDS_IN_PIXELS(0.0f, 0.0f, 800.0f, 600.0f);
+/// @brief  The seed used for placing objects so that every run measures the same workload.
+static const uint64_t RANDOM_SEED = 2014;
+
+/// @brief      Creates a sprite with the specified size.  No texture is needed since
+///             only the bounds of sprites are used for collisions.
+/// @param[in]  widthInPixels - The width of the sprite.
+/// @param[in]  heightInPixels - The height of the sprite.
+/// @return     The sprite, positioned at the origin.
+static sf::Sprite CreateSprite(const int widthInPixels, const int heightInPixels)
+{
+    sf::Sprite sprite;
+    sprite.setTextureRect(sf::IntRect(0, 0, widthInPixels, heightInPixels));
+    return sprite;
+}
+
+/// @brief          Gets a random position for an object, which may extend slightly past
+///                 the screen boundaries so that some objects collide with them.
+/// @param[in,out]  randomNumberGenerator - The random number generator for placing the object.
+/// @return         The random top-left position.
+static sf::Vector2f GetRandomPosition(SIMULATION::RandomNumberGenerator& randomNumberGenerator)
+{
+    const int BOUNDARY_OVERLAP_IN_PIXELS = 16;
+    unsigned int screenWidth = static_cast<unsigned int>(SCREEN_BOUNDS_IN_PIXELS.width);
+    unsigned int screenHeight = static_cast<unsigned int>(SCREEN_BOUNDS_IN_PIXELS.height);
+    int leftPosition = static_cast<int>(randomNumberGenerator.GenerateNumberLessThan(screenWidth)) - BOUNDARY_OVERLAP_IN_PIXELS;
+    int topPosition = static_cast<int>(randomNumberGenerator.GenerateNumberLessThan(screenHeight)) - BOUNDARY_OVERLAP_IN_PIXELS;
+    return sf::Vector2f(static_cast<float>(leftPosition), static_cast<float>(topPosition));
+}
+
+/// @brief          Adds randomly placed aliens to a store.
+/// @param[in]      alienCount - The number of aliens to add.
+/// @param[in,out]  randomNumberGenerator - The random number generator for placing aliens.
+/// @param[in,out]  aliens - The store to add aliens to.
+static void AddRandomAliens(
+    const unsigned int alienCount,
+    SIMULATION::RandomNumberGenerator& randomNumberGenerator,
+    OBJECTS::AlienStore& aliens)
+{
+    const int ALIEN_SIZE_IN_PIXELS = 32;
+    unsigned int alienSpriteId = aliens.GetSpriteId(CreateSprite(ALIEN_SIZE_IN_PIXELS, ALIEN_SIZE_IN_PIXELS));
+    const unsigned int TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS = 1;
+
+    aliens.Reserve(alienCount);
+    for (unsigned int alienIndex = 0; alienIndex < alienCount; ++alienIndex)
+    {
+        aliens.Add(
+            GetRandomPosition(randomNumberGenerator),
+            alienSpriteId,
+            OBJECTS::AlienStore::DEFAULT_MOVE_SPEED_IN_PIXELS_PER_SECOND,
+            TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS,
+            TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS,
+            randomNumberGenerator);
+    }
+}
+
+void BENCHMARKS::RunBoundaryCollisionBenchmark(const std::vector<unsigned int>& entityCounts, std::ostream& output)
+{
+    output << "Boundary collision benchmark" << std::endl;
+
+    PHYSICS::COLLISIONS::CollisionSystem collisionSystem(SCREEN_BOUNDS_IN_PIXELS);
+    for (unsigned int entityCount : entityCounts)
+    {
+        SIMULATION::RandomNumberGenerator randomNumberGenerator(RANDOM_SEED);
+        unsigned int repetitionCount = GetRepetitionCount(entityCount);
+
+        // MEASURE CONFINING INDIVIDUAL OBJECTS THROUGH THE COLLISION SYSTEM.
+        // Bunnies are used since the bunny is confined this way during gameplay.
+        const int BUNNY_SIZE_IN_PIXELS = 32;
+        std::vector< std::shared_ptr<OBJECTS::EasterBunny> > bunnies;
+        bunnies.reserve(entityCount);
+        for (unsigned int bunnyIndex = 0; bunnyIndex < entityCount; ++bunnyIndex)
+        {
+            std::shared_ptr<sf::Sprite> bunnySprite = std::make_shared<sf::Sprite>(CreateSprite(BUNNY_SIZE_IN_PIXELS, BUNNY_SIZE_IN_PIXELS));
+            bunnySprite->setPosition(GetRandomPosition(randomNumberGenerator));
+            bunnies.push_back(std::make_shared<OBJECTS::EasterBunny>(bunnySprite));
+        }
+
+        uint64_t boundaryCollisionCount = 0;
+        sf::Clock measurementClock;
+        for (unsigned int repetitionIndex = 0; repetitionIndex < repetitionCount; ++repetitionIndex)
+        {
+            for (const std::shared_ptr<OBJECTS::EasterBunny>& bunny : bunnies)
+            {
+                bool boundaryCollided = collisionSystem.HandleBoundaryCollisions(SCREEN_BOUNDS_IN_PIXELS, *bunny);
+                if (boundaryCollided)
+                {
+                    ++boundaryCollisionCount;
+                }
+            }
+        }
+        WriteMeasurement("CollisionSystem", entityCount, repetitionCount, measurementClock.getElapsedTime(), boundaryCollisionCount, output);
+
+        // MEASURE CONFINING ALL ALIENS AT ONCE.
+        OBJECTS::AlienStore aliens;
+        AddRandomAliens(entityCount, randomNumberGenerator, aliens);
+
+        measurementClock.restart();
+        for (unsigned int repetitionIndex = 0; repetitionIndex < repetitionCount; ++repetitionIndex)
+        {
+            aliens.HandleBoundaryCollisions(collisionSystem, SCREEN_BOUNDS_IN_PIXELS);
+        }
+        sf::Time measurementTime = measurementClock.getElapsedTime();
+
+        // Aliens that hit a boundary are moved, so their final positions reflect the work done.
+        uint64_t alienPositionSum = 0;
+        for (unsigned int alienIndex = 0; alienIndex < aliens.GetCount(); ++alienIndex)
+        {
+            sf::FloatRect alienBounds = aliens.GetBoundingRectangle(alienIndex);
+            alienPositionSum += static_cast<uint64_t>(alienBounds.left + alienBounds.top);
+        }
+        WriteMeasurement("AlienStore", entityCount, repetitionCount, measurementTime, alienPositionSum, output);
+    }
+}
+
+void BENCHMARKS::RunGameplayCollisionBenchmark(const std::vector<unsigned int>& entityCounts, std::ostream& output)
+{
+    output << "Gameplay collision benchmark" << std::endl;
+
+    PHYSICS::COLLISIONS::CollisionSystem collisionSystem(SCREEN_BOUNDS_IN_PIXELS);
+    std::vector<PHYSICS::COLLISIONS::CollisionPair> collisionPairs;
+    for (unsigned int entityCount : entityCounts)
+    {
+        SIMULATION::RandomNumberGenerator randomNumberGenerator(RANDOM_SEED);
+
+        // CREATE THE BUNNY AND EASTER EGGS.
+        // Their number doesn't change with the entity count, just like during gameplay.
+        const int BUNNY_SIZE_IN_PIXELS = 32;
+        std::shared_ptr<sf::Sprite> bunnySprite = std::make_shared<sf::Sprite>(CreateSprite(BUNNY_SIZE_IN_PIXELS, BUNNY_SIZE_IN_PIXELS));
+        bunnySprite->setPosition(GetRandomPosition(randomNumberGenerator));
+        OBJECTS::EasterBunny bunny(bunnySprite);
+
+        const unsigned int EASTER_EGG_COUNT = 4;
+        const int EASTER_EGG_SIZE_IN_PIXELS = 32;
+        std::vector< std::shared_ptr<OBJECTS::EasterEgg> > easterEggs;
+        for (unsigned int easterEggIndex = 0; easterEggIndex < EASTER_EGG_COUNT; ++easterEggIndex)
+        {
+            std::shared_ptr<sf::Sprite> easterEggSprite = std::make_shared<sf::Sprite>(CreateSprite(EASTER_EGG_SIZE_IN_PIXELS, EASTER_EGG_SIZE_IN_PIXELS));
+            easterEggSprite->setPosition(GetRandomPosition(randomNumberGenerator));
+            easterEggs.push_back(std::make_shared<OBJECTS::EasterEgg>(easterEggSprite));
+        }
+
+        // CREATE THE ALIENS AND MISSILES.
+        // Missiles alternate between coming from the bunny and from aliens so that
+        // both kinds of missile collisions are found.
+        OBJECTS::AlienStore aliens;
+        AddRandomAliens(entityCount, randomNumberGenerator, aliens);
+
+        const int MISSILE_WIDTH_IN_PIXELS = 8;
+        const int MISSILE_HEIGHT_IN_PIXELS = 16;
+        const sf::Vector2f MISSILE_VELOCITY(0.0f, 192.0f);
+        OBJECTS::WEAPONS::MissilePool missiles(entityCount);
+        for (unsigned int missileIndex = 0; missileIndex < entityCount; ++missileIndex)
+        {
+            sf::Sprite missileSprite = CreateSprite(MISSILE_WIDTH_IN_PIXELS, MISSILE_HEIGHT_IN_PIXELS);
+            missileSprite.setPosition(GetRandomPosition(randomNumberGenerator));
+            bool firedByBunny = (0 == missileIndex % 2);
+            OBJECTS::WEAPONS::MissileSource missileSource = firedByBunny ?
+                OBJECTS::WEAPONS::MISSILE_SOURCE_EASTER_BUNNY :
+                OBJECTS::WEAPONS::MISSILE_SOURCE_ALIEN;
+            missiles.Add(OBJECTS::WEAPONS::Missile(missileSource, MISSILE_VELOCITY, missileSprite));
+        }
+
+        // FIND COLLISIONS REPEATEDLY THE SAME WAY AS GAMEPLAY.
+        // Each repetition processes every alien and missile, so both count as entities.
+        unsigned int processedEntityCount = 2 * entityCount;
+        unsigned int repetitionCount = GetRepetitionCount(processedEntityCount);
+        uint64_t collisionPairCount = 0;
+        sf::Clock measurementClock;
+        for (unsigned int repetitionIndex = 0; repetitionIndex < repetitionCount; ++repetitionIndex)
+        {
+            // FIND COLLISIONS IN THE BROADPHASE.
+            collisionSystem.ClearBroadphase();
+            const unsigned int BUNNY_COLLISION_ID = 0;
+            collisionSystem.AddToBroadphase(bunny, BUNNY_COLLISION_ID);
+            for (unsigned int easterEggIndex = 0; easterEggIndex < EASTER_EGG_COUNT; ++easterEggIndex)
+            {
+                collisionSystem.AddToBroadphase(*easterEggs[easterEggIndex], easterEggIndex);
+            }
+            missiles.AddToBroadphase(collisionSystem);
+
+            collisionPairs.clear();
+            collisionSystem.FindCollisionPairs(collisionPairs);
+
+            // FIND COLLISIONS WITH THE PACKED ALIENS.
+            const PHYSICS::COLLISIONS::PackedRectangles& alienBoundingRectangles = aliens.GetBoundingRectangles();
+            collisionSystem.FindCollisionPairs(
+                bunny,
+                BUNNY_COLLISION_ID,
+                PHYSICS::COLLISIONS::COLLISION_LAYER_ALIEN,
+                alienBoundingRectangles,
+                collisionPairs);
+            for (unsigned int easterEggIndex = 0; easterEggIndex < EASTER_EGG_COUNT; ++easterEggIndex)
+            {
+                collisionSystem.FindCollisionPairs(
+                    *easterEggs[easterEggIndex],
+                    easterEggIndex,
+                    PHYSICS::COLLISIONS::COLLISION_LAYER_ALIEN,
+                    alienBoundingRectangles,
+                    collisionPairs);
+            }
+            missiles.FindCollisionPairs(
+                collisionSystem,
+                PHYSICS::COLLISIONS::COLLISION_LAYER_ALIEN,
+                alienBoundingRectangles,
+                collisionPairs);
+
+            collisionPairCount += collisionPairs.size();
+        }
+        WriteMeasurement("Find collision pairs", processedEntityCount, repetitionCount, measurementClock.getElapsedTime(), collisionPairCount, output);
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+namespace BENCHMARKS
+{
+    /// @brief          Measures how quickly objects can be confined to the screen boundaries,
+    ///                 both through the collision system directly and for all aliens at once,
+    ///                 for each entity count, and writes a human-readable report.
+    /// @param[in]      entityCounts - The numbers of objects to measure with.
+    /// @param[in,out]  output - The stream to write the report to.
+    void RunBoundaryCollisionBenchmark(const std::vector<unsigned int>& entityCounts, std::ostream& output);
+
+    /// @brief          Measures how quickly colliding pairs can be found among the bunny, Easter eggs,
+    ///                 missiles, and aliens the same way that gameplay finds them each update, for
+    ///                 each entity count, and writes a human-readable report.  Each entity count
+    ///                 is the number of aliens, and the same number of missiles is flying.
+    /// @param[in]      entityCounts - The numbers of aliens and missiles to measure with.
+    /// @param[in,out]  output - The stream to write the report to.
+    void RunGameplayCollisionBenchmark(const std::vector<unsigned int>& entityCounts, std::ostream& output);
+}
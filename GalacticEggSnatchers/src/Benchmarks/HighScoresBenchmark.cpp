@@ -0,0 +1,40 @@
+#include <array>
+#include <SFML/System.hpp>
+#include "Benchmarks/BenchmarkMeasurement.h"
+#include "Benchmarks/HighScoresBenchmark.h"
+#include "SaveData/HighScores.h"
+#include "Simulation/RandomNumberGenerator.h"
+
+void BENCHMARKS::RunHighScoresBenchmark(std::ostream& output)
+{
+    output << "High scores benchmark" << std::endl;
+
+    for (unsigned int highScoreCount = 1; highScoreCount <= SAVE_DATA::HighScores::MAX_HIGH_SCORES_COUNT; ++highScoreCount)
+    {
+        // CREATE HIGH SCORES IN A RANDOM ORDER.
+        // A fixed seed is used so that every run measures the same workload.
+        const uint64_t RANDOM_SEED = 2014;
+        SIMULATION::RandomNumberGenerator randomNumberGenerator(RANDOM_SEED);
+        const unsigned int MAX_SCORE = 65500;
+        SAVE_DATA::HighScores unsortedHighScores;
+        for (unsigned int highScoreIndex = 0; highScoreIndex < highScoreCount; ++highScoreIndex)
+        {
+            uint16_t highScore = static_cast<uint16_t>(randomNumberGenerator.GenerateNumberLessThan(MAX_SCORE));
+            unsortedHighScores.AddHighScore(highScore);
+        }
+
+        // MEASURE SORTING THE HIGH SCORES.
+        // The high scores are sorted in place, so each repetition starts from an unsorted copy,
+        // just as each load of the high scores file does.
+        unsigned int repetitionCount = GetRepetitionCount(highScoreCount);
+        uint64_t topHighScoreSum = 0;
+        sf::Clock measurementClock;
+        for (unsigned int repetitionIndex = 0; repetitionIndex < repetitionCount; ++repetitionIndex)
+        {
+            SAVE_DATA::HighScores highScores(unsortedHighScores);
+            std::array<uint16_t, SAVE_DATA::HighScores::MAX_HIGH_SCORES_COUNT> sortedHighScores = highScores.GetHighScoresInDescendingOrder();
+            topHighScoreSum += sortedHighScores[0];
+        }
+        WriteMeasurement("Sort high scores", highScoreCount, repetitionCount, measurementClock.getElapsedTime(), topHighScoreSum, output);
+    }
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <ostream>
+
+namespace BENCHMARKS
+{
+    /// @brief          Measures how quickly high scores can be sorted for display, for each
+    ///                 number of high scores that may be stored, and writes a human-readable report.
+    ///                 Since only a few high scores are ever stored, the benchmark isn't
+    ///                 parameterized by the entity counts of other benchmarks.
+    /// @param[in,out]  output - The stream to write the report to.
+    void RunHighScoresBenchmark(std::ostream& output);
+}
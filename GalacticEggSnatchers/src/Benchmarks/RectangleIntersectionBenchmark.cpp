@@ -0,0 +1,162 @@
+#include <cstdint>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+#include "Benchmarks/RectangleIntersectionBenchmark.h"
+#include "Physics/Collisions/PackedRectangles.h"
+#include "Physics/Collisions/RectangleIntersection.h"
+
+/// @brief          Fills packed rectangles with randomly placed alien-sized rectangles
+///                 spread across the screen.
+/// @param[in]      rectangleCount - The number of rectangles to create.
+/// @param[in,out]  randomNumberGenerator - The random number generator for placing rectangles.
+/// @param[out]     packedRectangles - The collection to fill.  Cleared first.
+static void CreateAlienRectangles(
+    const unsigned int rectangleCount,
+    std::default_random_engine& randomNumberGenerator,
+    PHYSICS::COLLISIONS::PackedRectangles& packedRectangles)
+{
+    const float SCREEN_WIDTH_IN_PIXELS = 800.0f;
+    const float SCREEN_HEIGHT_IN_PIXELS = 600.0f;
+    const float ALIEN_SIZE_IN_PIXELS = 32.0f;
+    std::uniform_real_distribution<float> leftPositions(0.0f, SCREEN_WIDTH_IN_PIXELS - ALIEN_SIZE_IN_PIXELS);
+    std::uniform_real_distribution<float> topPositions(0.0f, SCREEN_HEIGHT_IN_PIXELS - ALIEN_SIZE_IN_PIXELS);
+
+    packedRectangles.Clear();
+    packedRectangles.Reserve(rectangleCount);
+    for (unsigned int rectangleIndex = 0; rectangleIndex < rectangleCount; ++rectangleIndex)
+    {
+        sf::FloatRect alienRectangle(
+            leftPositions(randomNumberGenerator),
+            topPositions(randomNumberGenerator),
+            ALIEN_SIZE_IN_PIXELS,
+            ALIEN_SIZE_IN_PIXELS);
+        packedRectangles.Add(alienRectangle);
+    }
+}
+
+/// @brief          Creates randomly placed missile-sized rectangles spread across the screen.
+/// @param[in]      rectangleCount - The number of rectangles to create.
+/// @param[in,out]  randomNumberGenerator - The random number generator for placing rectangles.
+/// @return         The missile rectangles.
+static std::vector<sf::FloatRect> CreateMissileRectangles(
+    const unsigned int rectangleCount,
+    std::default_random_engine& randomNumberGenerator)
+{
+    const float SCREEN_WIDTH_IN_PIXELS = 800.0f;
+    const float SCREEN_HEIGHT_IN_PIXELS = 600.0f;
+    const float MISSILE_WIDTH_IN_PIXELS = 8.0f;
+    const float MISSILE_HEIGHT_IN_PIXELS = 16.0f;
+    std::uniform_real_distribution<float> leftPositions(0.0f, SCREEN_WIDTH_IN_PIXELS - MISSILE_WIDTH_IN_PIXELS);
+    std::uniform_real_distribution<float> topPositions(0.0f, SCREEN_HEIGHT_IN_PIXELS - MISSILE_HEIGHT_IN_PIXELS);
+
+    std::vector<sf::FloatRect> missileRectangles;
+    missileRectangles.reserve(rectangleCount);
+    for (unsigned int rectangleIndex = 0; rectangleIndex < rectangleCount; ++rectangleIndex)
+    {
+        sf::FloatRect missileRectangle(
+            leftPositions(randomNumberGenerator),
+            topPositions(randomNumberGenerator),
+            MISSILE_WIDTH_IN_PIXELS,
+            MISSILE_HEIGHT_IN_PIXELS);
+        missileRectangles.push_back(missileRectangle);
+    }
+
+    return missileRectangles;
+}
+
+void BENCHMARKS::RunRectangleIntersectionBenchmark(std::ostream& output)
+{
+    // CREATE THE MISSILES TESTED FOR EACH ALIEN COUNT.
+    // A fixed seed is used so that every run measures the same workload.
+    const unsigned int RANDOM_SEED = 2014;
+    std::default_random_engine randomNumberGenerator(RANDOM_SEED);
+    const unsigned int MISSILE_COUNT = 64;
+    std::vector<sf::FloatRect> missileRectangles = CreateMissileRectangles(MISSILE_COUNT, randomNumberGenerator);
+
+    output << "Rectangle intersection benchmark" << std::endl;
+    output << "  Fastest available implementation: "
+        << PHYSICS::COLLISIONS::GetRectangleIntersectionImplementationName(
+            PHYSICS::COLLISIONS::GetFastestRectangleIntersectionImplementation())
+        << std::endl;
+
+    // MEASURE EACH IMPLEMENTATION FOR EACH ALIEN COUNT.
+    const unsigned int ALIEN_COUNTS[] = { 30, 300, 3000 };
+    const unsigned int ALIEN_COUNT_COUNT = sizeof(ALIEN_COUNTS) / sizeof(ALIEN_COUNTS[0]);
+    // The number of repetitions is scaled so that each measurement tests roughly the same number
+    // of rectangle pairs, keeping measurements long enough to be reliable for small alien counts.
+    const unsigned int RECTANGLE_PAIRS_TESTED_PER_MEASUREMENT = 50000000;
+
+    PHYSICS::COLLISIONS::PackedRectangles alienRectangles;
+    std::vector<uint32_t> hitMask;
+    for (unsigned int alienCountIndex = 0; alienCountIndex < ALIEN_COUNT_COUNT; ++alienCountIndex)
+    {
+        unsigned int alienCount = ALIEN_COUNTS[alienCountIndex];
+        CreateAlienRectangles(alienCount, randomNumberGenerator, alienRectangles);
+
+        unsigned int rectanglePairsPerRepetition = alienCount * MISSILE_COUNT;
+        unsigned int repetitionCount = (RECTANGLE_PAIRS_TESTED_PER_MEASUREMENT / rectanglePairsPerRepetition) + 1;
+
+        output << "  " << alienCount << " aliens x " << MISSILE_COUNT << " missiles, "
+            << repetitionCount << " repetitions" << std::endl;
+
+        float scalarTimeInSeconds = 0.0f;
+        for (unsigned int implementationIndex = 0;
+            implementationIndex < PHYSICS::COLLISIONS::RECTANGLE_INTERSECTION_IMPLEMENTATION_COUNT;
+            ++implementationIndex)
+        {
+            // SKIP IMPLEMENTATIONS THAT WEREN'T COMPILED IN.
+            PHYSICS::COLLISIONS::RectangleIntersectionImplementation implementation =
+                static_cast<PHYSICS::COLLISIONS::RectangleIntersectionImplementation>(implementationIndex);
+            bool implementationAvailable = PHYSICS::COLLISIONS::IsRectangleIntersectionImplementationAvailable(implementation);
+            if (!implementationAvailable)
+            {
+                continue;
+            }
+
+            // TEST ALL MISSILES AGAINST ALL ALIENS REPEATEDLY.
+            // Intersections are counted so that the work can't be optimized away and so that
+            // implementations can be checked against each other.
+            unsigned int missilesWithIntersectionsCount = 0;
+            sf::Clock measurementClock;
+            for (unsigned int repetitionIndex = 0; repetitionIndex < repetitionCount; ++repetitionIndex)
+            {
+                for (const sf::FloatRect& missileRectangle : missileRectangles)
+                {
+                    bool missileIntersectsAliens = PHYSICS::COLLISIONS::FindIntersectingRectangles(
+                        implementation,
+                        missileRectangle,
+                        alienRectangles,
+                        hitMask);
+                    if (missileIntersectsAliens)
+                    {
+                        ++missilesWithIntersectionsCount;
+                    }
+                }
+            }
+            float measurementTimeInSeconds = measurementClock.getElapsedTime().asSeconds();
+
+            // REPORT THE MEASUREMENT RELATIVE TO THE SCALAR IMPLEMENTATION.
+            bool isScalarImplementation = (PHYSICS::COLLISIONS::RECTANGLE_INTERSECTION_SCALAR == implementation);
+            if (isScalarImplementation)
+            {
+                scalarTimeInSeconds = measurementTimeInSeconds;
+            }
+
+            const float NANOSECONDS_PER_SECOND = 1000000000.0f;
+            float testCount = static_cast<float>(repetitionCount) * static_cast<float>(MISSILE_COUNT);
+            float nanosecondsPerMissile = (measurementTimeInSeconds * NANOSECONDS_PER_SECOND) / testCount;
+            float speedup = (measurementTimeInSeconds > 0.0f) ? (scalarTimeInSeconds / measurementTimeInSeconds) : 0.0f;
+
+            output << "    " << std::setw(8) << std::left
+                << PHYSICS::COLLISIONS::GetRectangleIntersectionImplementationName(implementation)
+                << std::right << std::fixed << std::setprecision(1)
+                << std::setw(10) << nanosecondsPerMissile << " ns/missile"
+                << std::setw(8) << std::setprecision(2) << speedup << "x"
+                << "  (" << missilesWithIntersectionsCount << " hits)"
+                << std::endl;
+        }
+    }
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <ostream>
+
+/// @brief  Code related to measuring the performance of isolated parts of the game.
+namespace BENCHMARKS
+{
+    /// @brief          Measures how quickly missile rectangles can be tested against
+    ///                 packed alien rectangles with each available implementation,
+    ///                 for several alien counts, and writes a human-readable report.
+    /// @param[in,out]  output - The stream to write the report to.
+    void RunRectangleIntersectionBenchmark(std::ostream& output);
+}
@@ -0,0 +1,91 @@
+#include <string>
+#include <vector>
+#include <SFML/System.hpp>
+#include "Benchmarks/BenchmarkMeasurement.h"
+#include "Benchmarks/ResourceLookupBenchmark.h"
+#include "Graphics/TextureAtlas.h"
+#include "Resources/AssetArchive.h"
+#include "Resources/AssetFilepaths.h"
+#include "Resources/ResourceManager.h"
+
+void BENCHMARKS::RunResourceLookupBenchmark(const std::vector<unsigned int>& entityCounts, std::ostream& output)
+{
+    output << "Resource lookup benchmark" << std::endl;
+
+    // LOAD ALL ASSETS SO THAT ONLY LOOKUPS ARE MEASURED.
+    RESOURCES::ResourceManager resourceManager;
+    resourceManager.MountArchive(RESOURCES::AssetArchive::DEFAULT_FILEPATH);
+    resourceManager.PreloadAssets(RESOURCES::GetAllAssetFilepaths(), RESOURCES::ResourceManager::GetDefaultPreloadThreadCount());
+
+    // Images are the first assets, ending with the explosion image.
+    const unsigned int IMAGE_COUNT = RESOURCES::ASSET_IMAGE_EXPLOSION + 1;
+
+    // PACK ALL IMAGES INTO A TEXTURE ATLAS.
+    // Gameplay finds the images for its sprites in an atlas like this one.
+    std::vector<RESOURCES::AssetId> imageIds;
+    for (unsigned int imageIndex = 0; imageIndex < IMAGE_COUNT; ++imageIndex)
+    {
+        imageIds.push_back(static_cast<RESOURCES::AssetId>(imageIndex));
+    }
+    GRAPHICS::TextureAtlas textureAtlas(imageIds, resourceManager);
+
+    for (unsigned int entityCount : entityCounts)
+    {
+        unsigned int repetitionCount = GetRepetitionCount(entityCount);
+
+        // MEASURE LOOKUPS OF ATLAS RECTANGLES BY ASSET ID.
+        // This is how gameplay finds the image for each sprite, which only indexes an array.
+        uint64_t foundImageCount = 0;
+        sf::Clock measurementClock;
+        for (unsigned int repetitionIndex = 0; repetitionIndex < repetitionCount; ++repetitionIndex)
+        {
+            for (unsigned int lookupIndex = 0; lookupIndex < entityCount; ++lookupIndex)
+            {
+                RESOURCES::AssetId imageId = static_cast<RESOURCES::AssetId>(lookupIndex % IMAGE_COUNT);
+                bool imageFound = (textureAtlas.GetTextureRectangle(imageId).width > 0);
+                if (imageFound)
+                {
+                    ++foundImageCount;
+                }
+            }
+        }
+        WriteMeasurement("Atlas rectangle by ID", entityCount, repetitionCount, measurementClock.getElapsedTime(), foundImageCount, output);
+
+        // MEASURE LOOKUPS WITH EXISTING FILEPATHS FROM ASSET IDS.
+        // This shows the cost of hashing filepaths without creating any filepath strings.
+        foundImageCount = 0;
+        measurementClock.restart();
+        for (unsigned int repetitionIndex = 0; repetitionIndex < repetitionCount; ++repetitionIndex)
+        {
+            for (unsigned int lookupIndex = 0; lookupIndex < entityCount; ++lookupIndex)
+            {
+                RESOURCES::AssetId imageId = static_cast<RESOURCES::AssetId>(lookupIndex % IMAGE_COUNT);
+                bool imageFound = (nullptr != resourceManager.GetImage(RESOURCES::GetAssetFilepath(imageId)));
+                if (imageFound)
+                {
+                    ++foundImageCount;
+                }
+            }
+        }
+        WriteMeasurement("Image by ID filepath", entityCount, repetitionCount, measurementClock.getElapsedTime(), foundImageCount, output);
+
+        // MEASURE LOOKUPS WITH NEWLY CREATED FILEPATHS.
+        // This shows the cost of code that builds filepath strings for each lookup.
+        foundImageCount = 0;
+        measurementClock.restart();
+        for (unsigned int repetitionIndex = 0; repetitionIndex < repetitionCount; ++repetitionIndex)
+        {
+            for (unsigned int lookupIndex = 0; lookupIndex < entityCount; ++lookupIndex)
+            {
+                RESOURCES::AssetId imageId = static_cast<RESOURCES::AssetId>(lookupIndex % IMAGE_COUNT);
+                std::string imageFilepath(RESOURCES::GetAssetFilepath(imageId).c_str());
+                bool imageFound = (nullptr != resourceManager.GetImage(imageFilepath));
+                if (imageFound)
+                {
+                    ++foundImageCount;
+                }
+            }
+        }
+        WriteMeasurement("Image by new filepath", entityCount, repetitionCount, measurementClock.getElapsedTime(), foundImageCount, output);
+    }
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+namespace BENCHMARKS
+{
+    /// @brief          Measures how quickly already loaded images can be looked up, both in a
+    ///                 texture atlas by asset ID and in the resource manager by filepath, for each
+    ///                 entity count, and writes a human-readable report.  Each entity looks up
+    ///                 one image, cycling through all gameplay images.
+    /// @param[in]      entityCounts - The numbers of lookups to measure with.
+    /// @param[in,out]  output - The stream to write the report to.
+    void RunResourceLookupBenchmark(const std::vector<unsigned int>& entityCounts, std::ostream& output);
+}
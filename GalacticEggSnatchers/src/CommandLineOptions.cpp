@@ -0,0 +1,196 @@
+#include <cctype>
+#include <cerrno>
+#include <cfloat>
+#include <climits>
+#include <cstdlib>
+#include <stdexcept>
+#include "CommandLineOptions.h"
+
+/// @brief      Helper function to get the value following a command line argument.
+/// @param[in]  argumentCount - The number of command line arguments.
+/// @param[in]  arguments - The command line arguments.
+/// @param[in,out]  argumentIndex - The index of the argument expecting a value.
+///             Advanced to the index of the value.
+/// @return     The value following the argument.
+static std::string GetArgumentValue(const int argumentCount, char* arguments[], int& argumentIndex)
+{
+    int valueIndex = argumentIndex + 1;
+    bool valueExists = (valueIndex < argumentCount);
+    if (!valueExists)
+    {
+        throw std::invalid_argument(std::string("Missing value for command line argument: ") + arguments[argumentIndex]);
+    }
+
+    argumentIndex = valueIndex;
+    return arguments[valueIndex];
+}
+
+/// @brief      Helper function to convert a command line value to a positive number.
+///             The value must be a whole number that fits in an unsigned int.
+/// @param[in]  value - The command line value to convert.
+/// @return     The converted number.
+static unsigned int ToPositiveNumber(const std::string& value)
+{
+    // CHECK THAT THE VALUE STARTS WITH A DIGIT.
+    // strtoul() skips leading whitespace and accepts negative numbers by wrapping them
+    // around to large positive numbers, so only digits are allowed.
+    bool valueStartsWithDigit = (!value.empty() && std::isdigit(static_cast<unsigned char>(value[0])));
+    if (!valueStartsWithDigit)
+    {
+        throw std::invalid_argument("Invalid positive number on command line: " + value);
+    }
+
+    errno = 0;
+    char* endOfNumber = nullptr;
+    unsigned long number = std::strtoul(value.c_str(), &endOfNumber, 10);
+    bool entireValueConverted = (nullptr != endOfNumber && '\0' == *endOfNumber);
+    bool numberPositive = (number > 0);
+    bool numberFitsUnsignedInt = (ERANGE != errno && number <= UINT_MAX);
+    if (!entireValueConverted || !numberPositive || !numberFitsUnsignedInt)
+    {
+        throw std::invalid_argument("Invalid positive number on command line: " + value);
+    }
+
+    return static_cast<unsigned int>(number);
+}
+
+/// @brief      Helper function to convert a command line value to a positive number
+///             that may have a fractional part.
+/// @param[in]  value - The command line value to convert.
+/// @return     The converted number.
+static float ToPositiveFractionalNumber(const std::string& value)
+{
+    char* endOfNumber = nullptr;
+    double number = std::strtod(value.c_str(), &endOfNumber);
+    bool entireValueConverted = (nullptr != endOfNumber && '\0' == *endOfNumber);
+    bool numberPositive = (number > 0.0);
+    bool numberFitsFloat = (number <= FLT_MAX);
+    if (!entireValueConverted || !numberPositive || !numberFitsFloat)
+    {
+        throw std::invalid_argument("Invalid positive number on command line: " + value);
+    }
+
+    return static_cast<float>(number);
+}
+
+CommandLineOptions CommandLineOptions::Parse(const int argumentCount, char* arguments[])
+{
+    CommandLineOptions options;
+
+    // PARSE EACH ARGUMENT AFTER THE PROGRAM NAME.
+    const int FIRST_ARGUMENT_INDEX = 1;
+    for (int argumentIndex = FIRST_ARGUMENT_INDEX; argumentIndex < argumentCount; ++argumentIndex)
+    {
+        std::string argument = arguments[argumentIndex];
+        if ("--benchmark" == argument)
+        {
+            options.BenchmarkMode = true;
+        }
+        else if ("--benchmark-entities" == argument)
+        {
+            std::string entityCount = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.BenchmarkEntityCount = ToPositiveNumber(entityCount);
+        }
+        else if ("--pack-assets" == argument)
+        {
+            options.PackAssetsMode = true;
+        }
+        else if ("--headless" == argument)
+        {
+            options.HeadlessMode = true;
+        }
+        else if ("--assert-no-allocations" == argument)
+        {
+            options.AssertNoSteadyStateAllocations = true;
+            options.HeadlessMode = true;
+        }
+        else if ("--ticks" == argument)
+        {
+            std::string tickCount = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.HeadlessTickCount = ToPositiveNumber(tickCount);
+        }
+        else if ("--seed" == argument)
+        {
+            std::string randomSeed = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.HeadlessRandomSeed = ToPositiveNumber(randomSeed);
+        }
+        else if ("--tick-rate" == argument)
+        {
+            std::string ticksPerSecond = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.SimulationTicksPerSecond = ToPositiveNumber(ticksPerSecond);
+        }
+        else if ("--max-catch-up-ticks" == argument)
+        {
+            std::string maxCatchUpTicks = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.MaxCatchUpTicksPerFrame = ToPositiveNumber(maxCatchUpTicks);
+        }
+        else if ("--resource-budget" == argument)
+        {
+            std::string resourceMemoryBudgetInKilobytes = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.ResourceMemoryBudgetInKilobytes = ToPositiveNumber(resourceMemoryBudgetInKilobytes);
+        }
+        else if ("--hitch-budget" == argument)
+        {
+            std::string hitchBudgetInMilliseconds = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.HitchBudgetInMilliseconds = ToPositiveNumber(hitchBudgetInMilliseconds);
+        }
+        else if ("--report" == argument)
+        {
+            options.HeadlessReportFilepath = GetArgumentValue(argumentCount, arguments, argumentIndex);
+        }
+        else if ("--trace" == argument)
+        {
+            options.TraceFilepath = GetArgumentValue(argumentCount, arguments, argumentIndex);
+        }
+        else if ("--record" == argument)
+        {
+            options.InputRecordingFilepath = GetArgumentValue(argumentCount, arguments, argumentIndex);
+        }
+        else if ("--replay" == argument)
+        {
+            options.InputReplayFilepath = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.HeadlessMode = true;
+        }
+        else if ("--stress" == argument)
+        {
+            options.StressTestMode = true;
+            options.HeadlessMode = true;
+        }
+        else if ("--stress-stages" == argument)
+        {
+            std::string stageCount = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.StressTestParameters.StageCount = ToPositiveNumber(stageCount);
+        }
+        else if ("--stress-stage-ticks" == argument)
+        {
+            std::string ticksPerStage = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.StressTestParameters.TicksPerStage = ToPositiveNumber(ticksPerStage);
+        }
+        else if ("--stress-rows" == argument)
+        {
+            std::string alienRowCount = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.StressTestParameters.InitialAlienRowCount = ToPositiveNumber(alienRowCount);
+        }
+        else if ("--stress-columns" == argument)
+        {
+            std::string alienColumnCount = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.StressTestParameters.InitialAlienColumnCount = ToPositiveNumber(alienColumnCount);
+        }
+        else if ("--stress-missile-interval" == argument)
+        {
+            std::string timeBetweenMissileFiresInSeconds = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.StressTestParameters.TimeBetweenMissileFiresInSeconds = ToPositiveFractionalNumber(timeBetweenMissileFiresInSeconds);
+        }
+        else if ("--stress-explosions" == argument)
+        {
+            std::string explosionsPerMissileHit = GetArgumentValue(argumentCount, arguments, argumentIndex);
+            options.StressTestParameters.ExplosionsPerMissileHit = ToPositiveNumber(explosionsPerMissileHit);
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown command line argument: " + argument);
+        }
+    }
+
+    return options;
+}
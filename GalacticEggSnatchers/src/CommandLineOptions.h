@@ -0,0 +1,109 @@
+#pragma once
+
+#include <string>
+#include "Simulation/StressTest.h"
+
+////////////////////////////////////////////////////////
+/// @brief  Options for running the game that may be
+///         supplied on the command line.
+////////////////////////////////////////////////////////
+struct CommandLineOptions
+{
+    /// @brief  The default number of simulation ticks to run in headless mode.
+    static const unsigned int DEFAULT_HEADLESS_TICK_COUNT = 100000;
+    /// @brief  The default rate of fixed simulation ticks.
+    ///         This matches the rate that a typical display would refresh at.
+    static const unsigned int DEFAULT_SIMULATION_TICKS_PER_SECOND = 60;
+    /// @brief  The default maximum number of simulation ticks run to catch up in a single rendered frame.
+    ///         This prevents a long hitch from causing a spiral of ever-longer frames.
+    static const unsigned int DEFAULT_MAX_CATCH_UP_TICKS_PER_FRAME = 5;
+    /// @brief  The default random seed for headless mode.
+    ///         A fixed seed is used so that headless runs are reproducible by default.
+    static const unsigned int DEFAULT_HEADLESS_RANDOM_SEED = 1;
+
+    bool BenchmarkMode; ///< True if only performance benchmarks should be run.
+    unsigned int BenchmarkEntityCount;  ///< The number of entities to run gameplay hot path benchmarks with.  0 for several default counts.
+    bool PackAssetsMode;    ///< True if only the asset archive and decoded image cache should be built from individual asset files.
+    bool HeadlessMode;  ///< True if the gameplay should be simulated without a window or audio device.
+    bool StressTestMode;    ///< True if a headless stress test should be run instead of normal gameplay sessions.
+    bool AssertNoSteadyStateAllocations;    ///< True if a headless run should fail if steady-state gameplay allocates from the heap.
+    unsigned int HeadlessTickCount; ///< The number of simulation ticks to run in headless mode.
+    unsigned int HeadlessRandomSeed;    ///< The seed for all randomness in headless mode.
+    unsigned int SimulationTicksPerSecond;  ///< The number of fixed simulation ticks per second of game time.
+    unsigned int MaxCatchUpTicksPerFrame;   ///< The maximum number of simulation ticks run in a single rendered frame.
+    unsigned int ResourceMemoryBudgetInKilobytes;   ///< The memory budget for cached resources no longer in use.  0 for no budget.
+    unsigned int HitchBudgetInMilliseconds; ///< The frame time over which recent frames are recorded to a file.  0 for the default budget.
+    std::string HeadlessReportFilepath; ///< A file to write the headless report to, in addition to the console.  May be empty.
+    std::string TraceFilepath;  ///< A file to write a Chrome trace event timeline to.  May be empty for no tracing.
+    std::string InputRecordingFilepath; ///< A file to record gameplay input to.  May be empty for no recording.
+    std::string InputReplayFilepath;    ///< A file of recorded input to replay in headless mode.  May be empty for automated input.
+    SIMULATION::StressTestParameters StressTestParameters;  ///< Parameters controlling how the stress test ramps up the workload.
+
+    /// @brief  Constructor.  Initializes options for running the normal game.
+    CommandLineOptions() :
+        BenchmarkMode(false),
+        BenchmarkEntityCount(0),
+        PackAssetsMode(false),
+        HeadlessMode(false),
+        StressTestMode(false),
+        AssertNoSteadyStateAllocations(false),
+        HeadlessTickCount(DEFAULT_HEADLESS_TICK_COUNT),
+        HeadlessRandomSeed(DEFAULT_HEADLESS_RANDOM_SEED),
+        SimulationTicksPerSecond(DEFAULT_SIMULATION_TICKS_PER_SECOND),
+        MaxCatchUpTicksPerFrame(DEFAULT_MAX_CATCH_UP_TICKS_PER_FRAME),
+        ResourceMemoryBudgetInKilobytes(0),
+        HitchBudgetInMilliseconds(0),
+        HeadlessReportFilepath(),
+        TraceFilepath(),
+        InputRecordingFilepath(),
+        InputReplayFilepath(),
+        StressTestParameters()
+    {}
+
+    /// @brief      Parses options from command line arguments.
+    ///             Supported arguments:
+    ///             - --benchmark - Run performance benchmarks instead of the game.
+    ///             - --benchmark-entities <count> - The single number of entities to benchmark
+    ///               gameplay hot paths with, instead of several default counts.
+    ///             - --pack-assets - Pack all asset files into the asset archive and decode all images
+    ///               into the decoded image cache instead of running the game.
+    ///             - --headless - Simulate gameplay without a window or audio device.
+    ///             - --ticks <count> - The number of headless simulation ticks to run.
+    ///             - --seed <number> - The positive random seed for headless mode.  Runs with
+    ///               the same seed and tick settings simulate identical gameplay.
+    ///             - --tick-rate <ticks per second> - The rate of fixed simulation ticks.
+    ///             - --max-catch-up-ticks <count> - The maximum simulation ticks run per rendered frame.
+    ///             - --resource-budget <kilobytes> - The memory budget for cached resources.
+    ///               Resources no longer in use are evicted when it is exceeded.
+    ///             - --hitch-budget <milliseconds> - The frame time over which the timings and
+    ///               markers of the last few hundred frames are written to a hitch recording file.
+    ///               Only supported in builds with profiling enabled; other builds exit with an error.
+    ///             - --report <filepath> - A file to also write the headless report to.
+    ///             - --trace <filepath> - A file to write a trace event timeline to.
+    ///               Only supported in builds with profiling enabled; other builds exit with an error.
+    ///             - --record <filepath> - A file to record the input and random seed of each
+    ///               gameplay session to.  Each session is recorded to its own file, named by
+    ///               inserting the session number before the extension (session.rec becomes
+    ///               session.1.rec, session.2.rec, and so on).
+    ///             - --replay <filepath> - A recording to replay in headless mode, which is implied.
+    ///               The recording's random seed, tick rate, and tick count are used instead of
+    ///               any specified on the command line.
+    ///             - --stress - Run a headless stress test that doubles the number of aliens in each
+    ///               stage until the average tick time exceeds 16.6 ms, reporting the game object
+    ///               count at each stage.  Headless mode is implied.
+    ///             - --stress-stages <count> - The maximum number of stress test stages.
+    ///             - --stress-stage-ticks <count> - The number of ticks simulated in each stage.
+    ///             - --stress-rows <count> - The rows in each alien formation in the first stage.
+    ///             - --stress-columns <count> - The columns in each alien formation in the first stage.
+    ///             - --stress-missile-interval <seconds> - The time between each alien's missiles in the
+    ///               first stage, which may be fractional.  It is halved in each later stage, down to a minimum.
+    ///             - --stress-explosions <count> - The explosions per missile hit added in each stage.
+    ///             - --assert-no-allocations - Fail a headless run if gameplay allocates from the heap
+    ///               once each session has warmed up.  Headless mode is implied.
+    ///               Only supported in builds with profiling enabled; other builds exit with an error.
+    ///             An exception is thrown if an unknown or malformed argument is provided.
+    /// @param[in]  argumentCount - The number of command line arguments.
+    /// @param[in]  arguments - The command line arguments, starting with the program name.
+    /// @return     The options specified by the arguments.
+    static CommandLineOptions Parse(const int argumentCount, char* arguments[]);
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+/// @brief  Code related to general-purpose containers.
+namespace CONTAINERS
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  A stable reference to an element in a container.
+    ///         The generation is incremented each time the slot
+    ///         it refers to is reused, allowing references to
+    ///         removed elements to be detected rather than
+    ///         silently referring to whatever element replaced them.
+    ////////////////////////////////////////////////////////
+    struct GenerationalHandle
+    {
+        /// @brief  The slot index of a handle that does not refer to any element.
+        static const unsigned int INVALID_SLOT_INDEX = 0xFFFFFFFF;
+
+        unsigned int SlotIndex; ///< The index of the slot in the handle table.
+        unsigned int Generation;    ///< The generation of the slot when the handle was created.
+
+        /// @brief  Constructor.  Creates a handle that does not refer to any element.
+        GenerationalHandle() :
+            SlotIndex(INVALID_SLOT_INDEX),
+            Generation(0)
+        {}
+
+        /// @brief      Constructor.
+        /// @param[in]  slotIndex - The index of the slot in the handle table.
+        /// @param[in]  generation - The generation of the slot.
+        GenerationalHandle(const unsigned int slotIndex, const unsigned int generation) :
+            SlotIndex(slotIndex),
+            Generation(generation)
+        {}
+
+        /// @brief      Equality operator.
+        /// @param[in]  rhsHandle - The handle on the right-hand side of the operator.
+        /// @return     True if both handles refer to the same slot and generation; false otherwise.
+        bool operator== (const GenerationalHandle& rhsHandle) const
+        {
+            return (SlotIndex == rhsHandle.SlotIndex) && (Generation == rhsHandle.Generation);
+        }
+
+        /// @brief      Inequality operator.
+        /// @param[in]  rhsHandle - The handle on the right-hand side of the operator.
+        /// @return     True if the handles refer to different slots or generations; false otherwise.
+        bool operator!= (const GenerationalHandle& rhsHandle) const
+        {
+            return !(*this == rhsHandle);
+        }
+    };
+}
@@ -0,0 +1,104 @@
+#include "Containers/HandleTable.h"
+
+using namespace CONTAINERS;
+
+HandleTable::HandleTable() :
+    m_slots(),
+    m_freeSlotIndices()
+{
+    // Nothing else to do.
+}
+
+HandleTable::~HandleTable()
+{
+    // Nothing to do.
+}
+
+void HandleTable::Reserve(const unsigned int handleCount)
+{
+    m_slots.reserve(handleCount);
+    m_freeSlotIndices.reserve(handleCount);
+}
+
+GenerationalHandle HandleTable::Allocate(const unsigned int denseIndex)
+{
+    // CHECK IF A FREED SLOT CAN BE REUSED.
+    bool freeSlotExists = !m_freeSlotIndices.empty();
+    if (freeSlotExists)
+    {
+        unsigned int slotIndex = m_freeSlotIndices.back();
+        m_freeSlotIndices.pop_back();
+
+        Slot& slot = m_slots[slotIndex];
+        slot.DenseIndex = denseIndex;
+        slot.InUse = true;
+        return GenerationalHandle(slotIndex, slot.Generation);
+    }
+
+    // CREATE A NEW SLOT.
+    Slot slot;
+    slot.DenseIndex = denseIndex;
+    slot.Generation = 0;
+    slot.InUse = true;
+
+    unsigned int slotIndex = static_cast<unsigned int>(m_slots.size());
+    m_slots.push_back(slot);
+    return GenerationalHandle(slotIndex, slot.Generation);
+}
+
+void HandleTable::Free(const GenerationalHandle& handle)
+{
+    // CHECK IF THE HANDLE IS STILL VALID.
+    bool handleValid = Contains(handle);
+    if (!handleValid)
+    {
+        return;
+    }
+
+    // FREE THE SLOT FOR REUSE.
+    // The generation is incremented so that any copies of the handle become stale.
+    Slot& slot = m_slots[handle.SlotIndex];
+    slot.InUse = false;
+    ++slot.Generation;
+    m_freeSlotIndices.push_back(handle.SlotIndex);
+}
+
+bool HandleTable::Contains(const GenerationalHandle& handle) const
+{
+    bool slotExists = (handle.SlotIndex < m_slots.size());
+    if (!slotExists)
+    {
+        return false;
+    }
+
+    const Slot& slot = m_slots[handle.SlotIndex];
+    bool handleCurrent = (slot.InUse && slot.Generation == handle.Generation);
+    return handleCurrent;
+}
+
+unsigned int HandleTable::GetDenseIndex(const GenerationalHandle& handle) const
+{
+    return m_slots[handle.SlotIndex].DenseIndex;
+}
+
+void HandleTable::SetDenseIndex(const GenerationalHandle& handle, const unsigned int denseIndex)
+{
+    m_slots[handle.SlotIndex].DenseIndex = denseIndex;
+}
+
+void HandleTable::Clear()
+{
+    // FREE ALL SLOTS IN USE.
+    // Slots are kept rather than discarded so that generations keep increasing,
+    // ensuring that handles from before clearing remain stale.
+    for (unsigned int slotIndex = 0; slotIndex < m_slots.size(); ++slotIndex)
+    {
+        Slot& slot = m_slots[slotIndex];
+        if (slot.InUse)
+        {
+            slot.InUse = false;
+            ++slot.Generation;
+            m_freeSlotIndices.push_back(slotIndex);
+        }
+    }
+}
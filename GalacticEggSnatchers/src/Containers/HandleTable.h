@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+#include "Containers/GenerationalHandle.h"
+
+namespace CONTAINERS
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Maps stable generational handles to the current
+    ///         indices of elements in a densely packed container.
+    ///         This allows containers to move elements around
+    ///         (such as when swap-removing) without invalidating
+    ///         handles held elsewhere.  Freed slots are reused,
+    ///         with their generation incremented so that stale
+    ///         handles no longer resolve.
+    ////////////////////////////////////////////////////////
+    class HandleTable
+    {
+    public:
+        /// @brief  Constructor.  Creates an empty table.
+        explicit HandleTable();
+
+        /// @brief  Destructor.
+        ~HandleTable();
+
+        /// @brief      Reserves memory for the specified number of handles.
+        /// @param[in]  handleCount - The number of handles to reserve memory for.
+        void Reserve(const unsigned int handleCount);
+
+        /// @brief      Allocates a new handle for an element.
+        /// @param[in]  denseIndex - The current index of the element in its container.
+        /// @return     The handle for the element.
+        GenerationalHandle Allocate(const unsigned int denseIndex);
+
+        /// @brief      Frees a handle so that it no longer refers to an element.
+        ///             Does nothing if the handle is already invalid.
+        /// @param[in]  handle - The handle to free.
+        void Free(const GenerationalHandle& handle);
+
+        /// @brief      Checks if a handle still refers to an element.
+        /// @param[in]  handle - The handle to check.
+        /// @return     True if the handle is valid; false if it was freed or never allocated.
+        bool Contains(const GenerationalHandle& handle) const;
+
+        /// @brief      Gets the current index of an element in its container.
+        ///             The handle must be valid.
+        /// @param[in]  handle - The handle of the element.
+        /// @return     The index of the element.
+        unsigned int GetDenseIndex(const GenerationalHandle& handle) const;
+
+        /// @brief      Updates the index of an element that has moved in its container.
+        ///             The handle must be valid.
+        /// @param[in]  handle - The handle of the element.
+        /// @param[in]  denseIndex - The new index of the element.
+        void SetDenseIndex(const GenerationalHandle& handle, const unsigned int denseIndex);
+
+        /// @brief  Frees all handles.
+        void Clear();
+
+    private:
+        ////////////////////////////////////////////////////////
+        /// @brief  A single entry in the table.
+        ////////////////////////////////////////////////////////
+        struct Slot
+        {
+            unsigned int DenseIndex;    ///< The index of the element in its container.
+            unsigned int Generation;    ///< The current generation of the slot.
+            bool InUse; ///< Whether the slot currently refers to an element.
+        };
+
+        std::vector<Slot> m_slots;  ///< The slots for all handles that have ever been allocated.
+        std::vector<unsigned int> m_freeSlotIndices;    ///< Indices of slots available for reuse.
+    };
+}
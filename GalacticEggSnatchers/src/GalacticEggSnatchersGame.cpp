@@ -1,4 +1,8 @@
+#include <sstream>
 #include "GalacticEggSnatchersGame.h"
+#include "Input/KeyboardController.h"
+#include "Input/RecordingController.h"
+#include "Profiling/Profiling.h"
 #include "States/AllStates.h"
 
 // STATIC CONSTANT INITIALIZATION.
@@ -6,11 +10,51 @@ const unsigned int GalacticEggSnatchersGame::SCREEN_WIDTH_IN_PIXELS = 448;
 const unsigned int GalacticEggSnatchersGame::SCREEN_HEIGHT_IN_PIXELS = 512;
 const sf::String GalacticEggSnatchersGame::GAME_TITLE = "Galactic Egg Snatchers";
 
+/// @brief      Helper function to get the filepath for recording the input of a single gameplay session.
+///             The session number is inserted before the file extension so that later sessions
+///             don't overwrite the recordings of earlier ones.
+/// @param[in]  recordingFilepath - The filepath requested for recording input.
+/// @param[in]  sessionNumber - The number of the gameplay session, starting at 1.
+/// @return     The filepath to record the session to.
+static std::string GetSessionRecordingFilepath(const std::string& recordingFilepath, const unsigned int sessionNumber)
+{
+    // FIND WHERE THE FILE EXTENSION STARTS.
+    // Only a period in the filename itself starts an extension, not one in a directory name.
+    std::size_t extensionStartIndex = recordingFilepath.find_last_of('.');
+    std::size_t lastDirectorySeparatorIndex = recordingFilepath.find_last_of("/\\");
+    bool extensionExists = (
+        std::string::npos != extensionStartIndex &&
+        (std::string::npos == lastDirectorySeparatorIndex || extensionStartIndex > lastDirectorySeparatorIndex));
+    if (!extensionExists)
+    {
+        extensionStartIndex = recordingFilepath.size();
+    }
+
+    // INSERT THE SESSION NUMBER.
+    std::ostringstream sessionRecordingFilepath;
+    sessionRecordingFilepath << recordingFilepath.substr(0, extensionStartIndex)
+        << "." << sessionNumber
+        << recordingFilepath.substr(extensionStartIndex);
+    return sessionRecordingFilepath.str();
+}
+
 // METHOD IMPLEMENTATION.
 
-GalacticEggSnatchersGame::GalacticEggSnatchersGame() :
-    m_gameStates()
+GalacticEggSnatchersGame::GalacticEggSnatchersGame(
+    const std::size_t resourceMemoryBudgetInBytes,
+    const unsigned int simulationTicksPerSecond,
+    const std::string& inputRecordingFilepath) :
+    m_resourceManager(std::make_shared<RESOURCES::ResourceManager>(resourceMemoryBudgetInBytes)),
+    m_gameStates(),
+    m_simulationTicksPerSecond(simulationTicksPerSecond),
+    m_inputRecordingFilepath(inputRecordingFilepath),
+    m_gameplaySessionCount(0)
 {
+    // LOAD ALL ASSETS UP FRONT.
+    // States then find their assets already loaded instead of decoding them one at a time.
+    const bool HEADLESS_MODE = false;
+    m_resourceManager->LoadAllAssets(HEADLESS_MODE);
+
     InitializeFirstGameState();
 }
     
@@ -21,6 +65,8 @@ GalacticEggSnatchersGame::~GalacticEggSnatchersGame()
 
 void GalacticEggSnatchersGame::Update(const sf::Time& elapsedTime)
 {
+    PROFILE_PHASE(PROFILED_PHASE_UPDATE);
+
     // UPDATE THE CURRENT STATE.
     std::shared_ptr<STATES::IGameState>& currentState = m_gameStates.top();
     currentState->Update(elapsedTime);
@@ -34,11 +80,13 @@ void GalacticEggSnatchersGame::Update(const sf::Time& elapsedTime)
     }
 }
 
-void GalacticEggSnatchersGame::Render(sf::RenderTarget& renderTarget)
+void GalacticEggSnatchersGame::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
 {
+    PROFILE_PHASE(PROFILED_PHASE_RENDER);
+
     // Render the current state.
     std::shared_ptr<STATES::IGameState>& currentState = m_gameStates.top();
-    currentState->Render(renderTarget);
+    currentState->Render(renderTarget, interpolationRatio);
 }
 
 void GalacticEggSnatchersGame::HandleKeyPress(const sf::Keyboard::Key key)
@@ -48,7 +96,7 @@ void GalacticEggSnatchersGame::HandleKeyPress(const sf::Keyboard::Key key)
     currentState->HandleKeyPress(key);
 }
 
-sf::FloatRect GalacticEggSnatchersGame::GetScreenBoundsInPixels() const
+sf::FloatRect GalacticEggSnatchersGame::GetScreenBoundsInPixels()
 {
     sf::FloatRect screenBoundsInPixels(
         0.0f,
@@ -64,12 +112,16 @@ void GalacticEggSnatchersGame::InitializeFirstGameState()
     sf::FloatRect screenBoundsInPixels = GetScreenBoundsInPixels();
     std::shared_ptr<STATES::IGameState> initialState = std::make_shared<STATES::TitleState>(
         GAME_TITLE,
-        screenBoundsInPixels);
+        screenBoundsInPixels,
+        m_resourceManager);
     m_gameStates.push(initialState);
 }
 
 void GalacticEggSnatchersGame::SwitchToNextGameState(const STATES::GameStateType nextStateType)
 {
+    TRACE_SCOPE("states", "SwitchToNextGameState");
+    PROFILE_MARKER("SwitchToNextGameState");
+
     // REMOVE THE CURRENT STATE.
     /// @todo   The state is only currently removed to conserve memory.  Once a system is properly
     ///         implemented to go "back" to previous states, we can properly use the stack.
@@ -87,21 +139,45 @@ void GalacticEggSnatchersGame::SwitchToNextGameState(const STATES::GameStateType
     case STATES::GAME_STATE_TYPE_TITLE:
         nextGameState = std::make_shared<STATES::TitleState>(
             GAME_TITLE,
-            screenBoundsInPixels);
+            screenBoundsInPixels,
+            m_resourceManager);
         break;
     case STATES::GAME_STATE_TYPE_HIGH_SCORES:
         nextGameState = std::make_shared<STATES::HighScoresState>(
-            screenBoundsInPixels);
+            screenBoundsInPixels,
+            m_resourceManager);
         break;
     case STATES::GAME_STATE_TYPE_CREDITS:
         nextGameState = std::make_shared<STATES::CreditsState>(
-            screenBoundsInPixels);
+            screenBoundsInPixels,
+            m_resourceManager);
         break;
     case STATES::GAME_STATE_TYPE_GAMEPLAY:
+    {
+        STATES::GameplaySettings settings;
+        std::shared_ptr<INPUT::IInputController> playerController = std::make_shared<INPUT::KeyboardController>();
+        ++m_gameplaySessionCount;
+
+        // RECORD THE PLAYER'S INPUT IF REQUESTED.
+        // The recording is saved once the gameplay state is done with the controller.
+        bool inputRecordingRequested = !m_inputRecordingFilepath.empty();
+        if (inputRecordingRequested)
+        {
+            playerController = std::make_shared<INPUT::RecordingController>(
+                playerController,
+                settings.RandomSeed,
+                m_simulationTicksPerSecond,
+                GetSessionRecordingFilepath(m_inputRecordingFilepath, m_gameplaySessionCount));
+        }
+
         nextGameState = std::make_shared<STATES::GameplayState>(
-            screenBoundsInPixels);
+            screenBoundsInPixels,
+            settings,
+            playerController,
+            m_resourceManager);
         break;
     }
+    }
 
     m_gameStates.push(nextGameState);
 }
\ No newline at end of file
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <stack>
+#include <string>
 #include <SFML/Graphics.hpp>
+#include "Resources/ResourceManager.h"
 #include "States/IGameState.h"
 
 ////////////////////////////////////////////////////////
@@ -17,8 +20,19 @@ public:
     static const unsigned int SCREEN_HEIGHT_IN_PIXELS;  ///< The height of the game screen, in pixels.
     static const sf::String GAME_TITLE; ///< The title of the game.
 
-    /// @brief  Constructor.
-    explicit GalacticEggSnatchersGame();
+    /// @brief      Constructor.
+    /// @param[in]  resourceMemoryBudgetInBytes - The estimated memory, in bytes, that resources
+    ///             no longer used by the current state may remain cached within.
+    ///             RESOURCES::ResourceManager::UNLIMITED_MEMORY_BUDGET to keep all resources cached.
+    /// @param[in]  simulationTicksPerSecond - The number of fixed simulation ticks per second of game time.
+    /// @param[in]  inputRecordingFilepath - The file to record the input of gameplay sessions to,
+    ///             allowing them to be replayed.  Each session is recorded to its own file, named
+    ///             by inserting the session number before the file extension.  May be empty for
+    ///             no recording.
+    explicit GalacticEggSnatchersGame(
+        const std::size_t resourceMemoryBudgetInBytes,
+        const unsigned int simulationTicksPerSecond,
+        const std::string& inputRecordingFilepath);
     
     /// @brief  Destructor.
     ~GalacticEggSnatchersGame();
@@ -30,20 +44,23 @@ public:
 
     /// @brief          Renders the current state of the game.
     /// @param[in,out]  renderTarget - The render target to render to.
-    void Render(sf::RenderTarget& renderTarget);
+    /// @param[in]      interpolationRatio - How far (from 0 to 1) the rendered frame lies between
+    ///                 the previous and current simulation updates.  Used to smooth movement
+    ///                 when rendering occurs at a different rate than simulation.
+    void Render(sf::RenderTarget& renderTarget, const float interpolationRatio);
 
     /// @brief      Handles a key being pressed.
     /// @param[in]  key - The key that was pressed.
     void HandleKeyPress(const sf::Keyboard::Key key);
 
+    /// @brief  Gets the screen bounds in pixels.
+    /// @return The screen bounds in pixels.
+    static sf::FloatRect GetScreenBoundsInPixels();
+
 private:
     GalacticEggSnatchersGame(const GalacticEggSnatchersGame& gameToCopy);   ///< Private to disallow copying.
     GalacticEggSnatchersGame& operator= (const GalacticEggSnatchersGame& rhsGame);  ///< Private to disallow assignment.
 
-    /// @brief  Helper method to get the screen bounds in pixels.
-    /// @return The screen bounds in pixels.
-    sf::FloatRect GetScreenBoundsInPixels() const;
-
     /// @brief  Helper method to initialize the first state of the game.
     void InitializeFirstGameState();
 
@@ -51,5 +68,9 @@ private:
     /// @param[in]  nextStateType - The type of the state to switch to.
     void SwitchToNextGameState(const STATES::GameStateType nextStateType);
 
+    std::shared_ptr<RESOURCES::ResourceManager> m_resourceManager;  ///< The resources shared by all states for the lifetime of the game.
     std::stack< std::shared_ptr<STATES::IGameState> > m_gameStates; ///< The states in the game, with the current state on top.
+    unsigned int m_simulationTicksPerSecond;    ///< The number of fixed simulation ticks per second of game time.
+    std::string m_inputRecordingFilepath;   ///< The file to record gameplay input to.  Empty for no recording.
+    unsigned int m_gameplaySessionCount;    ///< The number of gameplay sessions started, used to give each recording its own file.
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Graphics/Gui/GameplayEndedLabel.h"
+#include "Profiling/Profiling.h"
 
 using namespace GRAPHICS::GUI;
 
@@ -32,13 +33,15 @@ GameplayEndedLabel::~GameplayEndedLabel()
     // Nothing to do.
 }
 
-void GameplayEndedLabel::Render(sf::RenderTarget& renderTarget)
+void GameplayEndedLabel::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
 {
     // REQUIRE THAT THE LABEL IS VISIBLE.
     if (IsVisible())
     {
         renderTarget.draw(m_mainMessageText);
+        PROFILE_DRAW_CALL();
         renderTarget.draw(m_secondaryInstructionText);
+        PROFILE_DRAW_CALL();
     }
 }
 
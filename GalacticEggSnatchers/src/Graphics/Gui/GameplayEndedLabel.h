@@ -30,8 +30,8 @@ namespace GUI
         /// @brief  Destructor.
         virtual ~GameplayEndedLabel();
 
-        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget)
-        virtual void Render(sf::RenderTarget& renderTarget);
+        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
+        virtual void Render(sf::RenderTarget& renderTarget, const float interpolationRatio);
 
         /// @brief  Returns whether or not the label is visible for rendering.
         /// @return The visibility of the label.
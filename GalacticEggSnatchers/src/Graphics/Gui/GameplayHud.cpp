@@ -14,7 +14,13 @@ GameplayHud::GameplayHud(const sf::FloatRect& screenBoundsInPixels, const std::s
     m_livesLabel(DEFAULT_FONT_SIZE_IN_PIXELS, DEFAULT_TEXT_COLOR, textFont),
     m_scoreLabel(DEFAULT_FONT_SIZE_IN_PIXELS, DEFAULT_TEXT_COLOR, textFont),
     m_highScoreLabel(DEFAULT_FONT_SIZE_IN_PIXELS, DEFAULT_TEXT_COLOR, textFont),
-    m_gameplayEndedLabel(screenBoundsInPixels, DEFAULT_TEXT_COLOR, textFont)
+    m_gameplayEndedLabel(screenBoundsInPixels, DEFAULT_TEXT_COLOR, textFont),
+    // The performance overlay is placed below the top row of labels so that it doesn't hide them.
+    m_performanceOverlay(
+        sf::Vector2f(screenBoundsInPixels.left, screenBoundsInPixels.top + static_cast<float>(2 * DEFAULT_FONT_SIZE_IN_PIXELS)),
+        DEFAULT_FONT_SIZE_IN_PIXELS,
+        DEFAULT_TEXT_COLOR,
+        textFont)
 {
     // POSITION EACH OF THE LABELS.
     PositionLabels(screenBoundsInPixels);
@@ -25,16 +31,20 @@ GameplayHud::~GameplayHud()
     // Nothing to do.
 }
 
-void GameplayHud::Render(sf::RenderTarget& renderTarget)
+void GameplayHud::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
 {
-    m_livesLabel.Render(renderTarget);
-    m_scoreLabel.Render(renderTarget);
-    m_highScoreLabel.Render(renderTarget);
+    m_livesLabel.Render(renderTarget, interpolationRatio);
+    m_scoreLabel.Render(renderTarget, interpolationRatio);
+    m_highScoreLabel.Render(renderTarget, interpolationRatio);
 
     if (m_gameplayEndedLabel.IsVisible())
     {
-        m_gameplayEndedLabel.Render(renderTarget);
+        m_gameplayEndedLabel.Render(renderTarget, interpolationRatio);
     }
+
+    // The performance overlay is always rendered so that it can measure frame times,
+    // but it is only drawn when visible.  It is drawn last to be on top of everything else.
+    m_performanceOverlay.Render(renderTarget, interpolationRatio);
 }
 
 void GameplayHud::SetLivesCount(const uint8_t livesCount)
@@ -66,6 +76,21 @@ void GameplayHud::ShowPlayerLostText()
     m_gameplayEndedLabel.SetVisible(true);
 }
 
+bool GameplayHud::IsPerformanceOverlayVisible() const
+{
+    return m_performanceOverlay.IsVisible();
+}
+
+void GameplayHud::SetPerformanceOverlayVisible(const bool visibility)
+{
+    m_performanceOverlay.SetVisible(visibility);
+}
+
+void GameplayHud::SetGameObjectCounts(const GameObjectCounts& gameObjectCounts)
+{
+    m_performanceOverlay.SetGameObjectCounts(gameObjectCounts);
+}
+
 void GameplayHud::PositionLabels(const sf::FloatRect& screenBoundsInPixels)
 {
     // POSITION THE LIVES LABEL.
@@ -3,6 +3,7 @@
 #include "Graphics/Gui/GameplayEndedLabel.h"
 #include "Graphics/Gui/HighScoreLabel.h"
 #include "Graphics/Gui/LivesLabel.h"
+#include "Graphics/Gui/PerformanceOverlay.h"
 #include "Graphics/Gui/ScoreLabel.h"
 #include "Graphics/IRenderable.h"
 
@@ -12,6 +13,7 @@ namespace GUI
 {
     ////////////////////////////////////////////////////////
     /// @brief  The heads-up-display (HUD) displayed during main gameplay.
+    ///         A performance overlay may also be shown beneath the labels.
     ////////////////////////////////////////////////////////
     class GameplayHud : public GRAPHICS::IRenderable
     {
@@ -27,8 +29,8 @@ namespace GUI
         /// @brief  Destructor.
         virtual ~GameplayHud();
 
-        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget)
-        virtual void Render(sf::RenderTarget& renderTarget);
+        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
+        virtual void Render(sf::RenderTarget& renderTarget, const float interpolationRatio);
 
         /// @brief      Sets the number of lives displayed in the HUD.
         /// @param[in]  livesCount - The number of lives to display in the HUD.
@@ -48,6 +50,18 @@ namespace GUI
         /// @brief  Displays a message indicating that the player has lost the game.
         void ShowPlayerLostText();
 
+        /// @brief  Returns whether or not the performance overlay is visible.
+        /// @return The visibility of the performance overlay.
+        bool IsPerformanceOverlayVisible() const;
+
+        /// @brief      Sets the visibility of the performance overlay.
+        /// @param[in]  visibility - True to make visible; false to make invisible.
+        void SetPerformanceOverlayVisible(const bool visibility);
+
+        /// @brief      Sets the game object counts displayed in the performance overlay.
+        /// @param[in]  gameObjectCounts - The number of each kind of game object in play.
+        void SetGameObjectCounts(const GameObjectCounts& gameObjectCounts);
+
     private:
         GameplayHud(const GameplayHud& hudToCopy);  ///< Private to disallow copying.
         GameplayHud& operator= (const GameplayHud& rhsHud); ///< Private to disallow assignment.
@@ -60,6 +74,7 @@ namespace GUI
         ScoreLabel m_scoreLabel;    ///< The label displaying the current score.
         HighScoreLabel m_highScoreLabel;    ///< The label displaying the all-time high score.
         GameplayEndedLabel m_gameplayEndedLabel;    ///< The label displaying either win or loss message to the player.
+        PerformanceOverlay m_performanceOverlay;    ///< The overlay displaying performance statistics.
     };
 }
 }
\ No newline at end of file
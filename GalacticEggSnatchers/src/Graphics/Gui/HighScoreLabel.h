@@ -27,8 +27,8 @@ namespace GUI
         /// @brief  Destructor.
         ~HighScoreLabel();
 
-        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget)
-        virtual void Render(sf::RenderTarget& renderTarget);
+        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
+        virtual void Render(sf::RenderTarget& renderTarget, const float interpolationRatio);
 
         /// @brief      Sets the high score displayed in the label.
         /// @param[in]  highScore - The high score to display in the label.
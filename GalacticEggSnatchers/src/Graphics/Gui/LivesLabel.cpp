@@ -1,5 +1,6 @@
 #include <sstream>
 #include "Graphics/Gui/LivesLabel.h"
+#include "Profiling/Profiling.h"
 
 using namespace GRAPHICS::GUI;
 
@@ -22,13 +23,16 @@ LivesLabel::~LivesLabel()
     // Nothing else to do.
 }
 
-void LivesLabel::Render(sf::RenderTarget& renderTarget)
+void LivesLabel::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
 {
     renderTarget.draw(m_labelText);
+    PROFILE_DRAW_CALL();
 }
 
 void LivesLabel::SetLivesCount(const uint8_t livesCount)
 {
+    PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_TEXT);
+
     // CREATE THE STRING TO DISPLAY IN THE LABEL.
     std::ostringstream livesStringConverter;
     // The cast is necessary to prevent the 8-bit lives count from being interpretted as a char.
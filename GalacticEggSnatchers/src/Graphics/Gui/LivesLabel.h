@@ -28,8 +28,8 @@ namespace GUI
         /// @brief  Destructor.
         virtual ~LivesLabel();
 
-        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget)
-        virtual void Render(sf::RenderTarget& renderTarget);
+        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
+        virtual void Render(sf::RenderTarget& renderTarget, const float interpolationRatio);
 
         /// @brief      Sets the number of lives displayed in the label.
         /// @param[in]  livesCount - The number of lives to display in the label.
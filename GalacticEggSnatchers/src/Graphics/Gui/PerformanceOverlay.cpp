@@ -0,0 +1,325 @@
+#include <algorithm>
+#include "Graphics/Gui/PerformanceOverlay.h"
+#include "Profiling/Profiling.h"
+
+using namespace GRAPHICS::GUI;
+
+// STATIC CONSTANT INITIALIZATION.
+const sf::Time PerformanceOverlay::FRAME_TIME_BUDGET = sf::microseconds(1000000 / 60);
+
+// Helper constants for laying out the overlay.
+static const float PADDING_IN_PIXELS = 4.0f;
+static const float FRAME_TIME_GRAPH_BAR_WIDTH_IN_PIXELS = 2.0f;
+static const float FRAME_TIME_GRAPH_HEIGHT_IN_PIXELS = 48.0f;
+static const float NUMBER_COLUMN_OFFSET_IN_PIXELS = 176.0f;
+static const unsigned int VERTICES_PER_QUAD = 4;
+
+// The font texture reserves a white square at its top-left corner for drawing solid shapes
+// (such as underlines), so texturing with the center of that square leaves colors unchanged.
+static const sf::Vector2f WHITE_TEXTURE_COORDINATES(1.0f, 1.0f);
+
+PerformanceOverlay::PerformanceOverlay(
+    const sf::Vector2f& topLeftPositionInPixels,
+    const unsigned int fontSizeInPixels,
+    const sf::Color& textColor,
+    const std::shared_ptr<sf::Font>& font) :
+    m_topLeftPositionInPixels(topLeftPositionInPixels),
+    m_fontSizeInPixels(fontSizeInPixels),
+    m_textColor(textColor),
+    m_font(font),
+    m_isVisible(false),
+    m_previouslyRendered(false),
+    m_frameClock(),
+    m_frameTimes(),
+    m_nextFrameTimeIndex(0),
+    m_recordedFrameTimeCount(0),
+    m_gameObjectCounts(),
+    m_vertices(sf::Quads),
+    m_textPositionInPixels(topLeftPositionInPixels)
+{
+    m_frameTimes.fill(sf::Time::Zero);
+}
+
+PerformanceOverlay::~PerformanceOverlay()
+{
+    // Nothing to do.
+}
+
+void PerformanceOverlay::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
+{
+    // RECORD THE TIME OF THE FRAME.
+    // This is done even if the overlay isn't visible so that the graph is full once it is shown.
+    RecordFrameTime();
+
+    // REQUIRE THAT THE OVERLAY IS VISIBLE.
+    if (!IsVisible())
+    {
+        return;
+    }
+
+    // DRAW THE ENTIRE OVERLAY AT ONCE.
+    BuildVertices();
+    sf::RenderStates renderStates(&m_font->getTexture(m_fontSizeInPixels));
+    renderTarget.draw(m_vertices, renderStates);
+    PROFILE_DRAW_CALL();
+}
+
+bool PerformanceOverlay::IsVisible() const
+{
+    return m_isVisible;
+}
+
+void PerformanceOverlay::SetVisible(const bool visibility)
+{
+    m_isVisible = visibility;
+}
+
+void PerformanceOverlay::SetGameObjectCounts(const GameObjectCounts& gameObjectCounts)
+{
+    m_gameObjectCounts = gameObjectCounts;
+}
+
+void PerformanceOverlay::RecordFrameTime()
+{
+    // CHECK IF A PREVIOUS RENDER EXISTS TO MEASURE FROM.
+    sf::Time frameTime = m_frameClock.restart();
+    if (!m_previouslyRendered)
+    {
+        m_previouslyRendered = true;
+        return;
+    }
+
+    // RECORD THE FRAME TIME, REPLACING THE OLDEST ONE.
+    m_frameTimes[m_nextFrameTimeIndex] = frameTime;
+    m_nextFrameTimeIndex = (m_nextFrameTimeIndex + 1) % FRAME_TIME_GRAPH_SAMPLE_COUNT;
+
+    bool frameTimesFull = (m_recordedFrameTimeCount >= FRAME_TIME_GRAPH_SAMPLE_COUNT);
+    if (!frameTimesFull)
+    {
+        ++m_recordedFrameTimeCount;
+    }
+}
+
+void PerformanceOverlay::BuildVertices()
+{
+    // The vertex array keeps its memory when cleared, so rebuilding doesn't allocate.
+    m_vertices.clear();
+    m_textPositionInPixels = sf::Vector2f(
+        m_topLeftPositionInPixels.x + PADDING_IN_PIXELS,
+        m_topLeftPositionInPixels.y + PADDING_IN_PIXELS);
+
+    // ADD THE BACKGROUND.
+    // It must be added first to be drawn beneath everything else, but its height isn't known
+    // until everything else has been added, so it is positioned last.
+    const unsigned int BACKGROUND_VERTEX_INDEX = 0;
+    const sf::Color BACKGROUND_COLOR(0, 0, 0, 192);
+    AddRectangle(sf::FloatRect(), BACKGROUND_COLOR);
+
+    // ADD THE FRAME RATE.
+    sf::Time totalFrameTime = sf::Time::Zero;
+    for (const sf::Time& frameTime : m_frameTimes)
+    {
+        totalFrameTime += frameTime;
+    }
+    uint64_t totalFrameTimeInMicroseconds = static_cast<uint64_t>(totalFrameTime.asMicroseconds());
+    bool frameTimesRecorded = (totalFrameTimeInMicroseconds > 0);
+    const uint64_t MICROSECONDS_PER_SECOND = 1000000;
+    uint64_t framesPerSecond = frameTimesRecorded ? (m_recordedFrameTimeCount * MICROSECONDS_PER_SECOND / totalFrameTimeInMicroseconds) : 0;
+    AddNumberLine("FPS", framesPerSecond, "");
+
+    unsigned int latestFrameTimeIndex = (m_nextFrameTimeIndex + FRAME_TIME_GRAPH_SAMPLE_COUNT - 1) % FRAME_TIME_GRAPH_SAMPLE_COUNT;
+    uint64_t latestFrameTimeInMicroseconds = static_cast<uint64_t>(m_frameTimes[latestFrameTimeIndex].asMicroseconds());
+    AddNumberLine("Frame", latestFrameTimeInMicroseconds, " us");
+
+    // ADD THE FRAME TIME GRAPH.
+    AddFrameTimeGraph();
+
+#if defined PROFILING_ENABLED
+    // ADD THE TIME OF EACH PHASE.
+    // Phases nested within updating or rendering are indented beneath them, as in the profiling report.
+    PROFILING::FrameProfiler& frameProfiler = PROFILING::FrameProfiler::GetInstance();
+    for (unsigned int phaseIndex = 0; phaseIndex < PROFILING::PROFILED_PHASE_COUNT; ++phaseIndex)
+    {
+        PROFILING::ProfiledPhase phase = static_cast<PROFILING::ProfiledPhase>(phaseIndex);
+        bool topLevelPhase = (
+            PROFILING::PROFILED_PHASE_UPDATE == phase ||
+            PROFILING::PROFILED_PHASE_RENDER == phase ||
+            PROFILING::PROFILED_PHASE_DISPLAY == phase);
+        if (!topLevelPhase)
+        {
+            AddText("  ");
+        }
+
+        uint64_t phaseTimeInMicroseconds = static_cast<uint64_t>(frameProfiler.GetPreviousFramePhaseTime(phase).asMicroseconds());
+        AddNumberLine(PROFILING::FrameProfiler::GetPhaseName(phase), phaseTimeInMicroseconds, " us");
+    }
+#endif
+
+    // ADD THE GAME OBJECT COUNTS.
+    AddNumberLine("Aliens", m_gameObjectCounts.AlienCount, "");
+    AddNumberLine("Missiles", m_gameObjectCounts.MissileCount, "");
+    AddNumberLine("Explosions", m_gameObjectCounts.ExplosionCount, "");
+    AddNumberLine("Eggs", m_gameObjectCounts.EasterEggCount, "");
+
+#if defined PROFILING_ENABLED
+    // ADD THE DRAW CALLS AND ALLOCATIONS OF THE PREVIOUS FRAME.
+    AddNumberLine("Draw calls", frameProfiler.GetPreviousFrameDrawCallCount(), "");
+
+    const PROFILING::AllocationCounts& allocationCounts = PROFILING::AllocationTracker::GetInstance().GetPreviousFrameCounts();
+    AddNumberLine("Allocations", allocationCounts.AllocationCount, "");
+    AddNumberLine("Allocated", allocationCounts.ByteCount, " bytes");
+#endif
+
+    // POSITION THE BACKGROUND BEHIND EVERYTHING ADDED.
+    float backgroundWidth = (2.0f * PADDING_IN_PIXELS) + (FRAME_TIME_GRAPH_SAMPLE_COUNT * FRAME_TIME_GRAPH_BAR_WIDTH_IN_PIXELS);
+    float backgroundHeight = (m_textPositionInPixels.y - m_topLeftPositionInPixels.y) + PADDING_IN_PIXELS;
+    sf::FloatRect backgroundRectangle(m_topLeftPositionInPixels.x, m_topLeftPositionInPixels.y, backgroundWidth, backgroundHeight);
+    SetQuadPositions(BACKGROUND_VERTEX_INDEX, backgroundRectangle);
+}
+
+void PerformanceOverlay::AddFrameTimeGraph()
+{
+    // DETERMINE THE SCALE OF THE GRAPH.
+    // The full height of the graph covers twice the budget so that frames over budget stand out
+    // while still leaving room to see how far over budget they are.  Longer frames are clipped.
+    float maxGraphedFrameTimeInMicroseconds = 2.0f * static_cast<float>(FRAME_TIME_BUDGET.asMicroseconds());
+    float pixelsPerMicrosecond = FRAME_TIME_GRAPH_HEIGHT_IN_PIXELS / maxGraphedFrameTimeInMicroseconds;
+    float graphBottom = m_textPositionInPixels.y + FRAME_TIME_GRAPH_HEIGHT_IN_PIXELS;
+
+    // ADD A BAR FOR EACH FRAME TIME.
+    // The oldest frame time is on the left, so the graph scrolls to the left over time.
+    const sf::Color WITHIN_BUDGET_COLOR = sf::Color::Green;
+    const sf::Color OVER_BUDGET_COLOR = sf::Color::Red;
+    for (unsigned int sampleIndex = 0; sampleIndex < FRAME_TIME_GRAPH_SAMPLE_COUNT; ++sampleIndex)
+    {
+        unsigned int frameTimeIndex = (m_nextFrameTimeIndex + sampleIndex) % FRAME_TIME_GRAPH_SAMPLE_COUNT;
+        const sf::Time& frameTime = m_frameTimes[frameTimeIndex];
+        bool frameTimeRecorded = (frameTime > sf::Time::Zero);
+        if (!frameTimeRecorded)
+        {
+            continue;
+        }
+
+        float barHeight = pixelsPerMicrosecond * static_cast<float>(frameTime.asMicroseconds());
+        bool barClipped = (barHeight > FRAME_TIME_GRAPH_HEIGHT_IN_PIXELS);
+        if (barClipped)
+        {
+            barHeight = FRAME_TIME_GRAPH_HEIGHT_IN_PIXELS;
+        }
+
+        bool overBudget = (frameTime > FRAME_TIME_BUDGET);
+        sf::FloatRect barRectangle(
+            m_textPositionInPixels.x + (sampleIndex * FRAME_TIME_GRAPH_BAR_WIDTH_IN_PIXELS),
+            graphBottom - barHeight,
+            FRAME_TIME_GRAPH_BAR_WIDTH_IN_PIXELS,
+            barHeight);
+        AddRectangle(barRectangle, overBudget ? OVER_BUDGET_COLOR : WITHIN_BUDGET_COLOR);
+    }
+
+    // ADD A LINE MARKING THE BUDGET.
+    const float BUDGET_LINE_HEIGHT_IN_PIXELS = 1.0f;
+    const sf::Color BUDGET_LINE_COLOR = sf::Color::Yellow;
+    float budgetLineTop = graphBottom - (pixelsPerMicrosecond * static_cast<float>(FRAME_TIME_BUDGET.asMicroseconds()));
+    sf::FloatRect budgetLineRectangle(
+        m_textPositionInPixels.x,
+        budgetLineTop,
+        FRAME_TIME_GRAPH_SAMPLE_COUNT * FRAME_TIME_GRAPH_BAR_WIDTH_IN_PIXELS,
+        BUDGET_LINE_HEIGHT_IN_PIXELS);
+    AddRectangle(budgetLineRectangle, BUDGET_LINE_COLOR);
+
+    // MOVE PAST THE GRAPH.
+    m_textPositionInPixels.y = graphBottom + PADDING_IN_PIXELS;
+}
+
+void PerformanceOverlay::AddNumberLine(const char* label, const uint64_t number, const char* units)
+{
+    AddText(label);
+
+    // Numbers are aligned in a column unless the label is too long.
+    float numberColumnX = m_topLeftPositionInPixels.x + PADDING_IN_PIXELS + NUMBER_COLUMN_OFFSET_IN_PIXELS;
+    m_textPositionInPixels.x = std::max(m_textPositionInPixels.x, numberColumnX);
+    AddNumber(number);
+    AddText(units);
+
+    StartNextLine();
+}
+
+void PerformanceOverlay::AddText(const char* text)
+{
+    const bool NOT_BOLD = false;
+    for (const char* character = text; *character != '\0'; ++character)
+    {
+        // ADD THE GLYPH FOR THE CHARACTER.
+        // Glyphs are positioned relative to the baseline of the text, as SFML positions them for text.
+        const sf::Glyph& glyph = m_font->getGlyph(static_cast<sf::Uint32>(*character), m_fontSizeInPixels, NOT_BOLD);
+        bool glyphVisible = (glyph.textureRect.width > 0) && (glyph.textureRect.height > 0);
+        if (glyphVisible)
+        {
+            float baselineY = m_textPositionInPixels.y + static_cast<float>(m_fontSizeInPixels);
+            float left = m_textPositionInPixels.x + static_cast<float>(glyph.bounds.left);
+            float top = baselineY + static_cast<float>(glyph.bounds.top);
+            float right = left + static_cast<float>(glyph.bounds.width);
+            float bottom = top + static_cast<float>(glyph.bounds.height);
+
+            float textureLeft = static_cast<float>(glyph.textureRect.left);
+            float textureRight = textureLeft + static_cast<float>(glyph.textureRect.width);
+            float textureTop = static_cast<float>(glyph.textureRect.top);
+            float textureBottom = textureTop + static_cast<float>(glyph.textureRect.height);
+
+            m_vertices.append(sf::Vertex(sf::Vector2f(left, top), m_textColor, sf::Vector2f(textureLeft, textureTop)));
+            m_vertices.append(sf::Vertex(sf::Vector2f(left, bottom), m_textColor, sf::Vector2f(textureLeft, textureBottom)));
+            m_vertices.append(sf::Vertex(sf::Vector2f(right, bottom), m_textColor, sf::Vector2f(textureRight, textureBottom)));
+            m_vertices.append(sf::Vertex(sf::Vector2f(right, top), m_textColor, sf::Vector2f(textureRight, textureTop)));
+        }
+
+        // ADVANCE TO THE NEXT CHARACTER.
+        m_textPositionInPixels.x += static_cast<float>(glyph.advance);
+    }
+}
+
+void PerformanceOverlay::AddNumber(uint64_t number)
+{
+    // CONVERT THE NUMBER TO DIGITS.
+    // Digits are converted from least to most significant, so they're filled in from the end of
+    // the buffer.  A fixed buffer is used to avoid allocating a string.
+    const unsigned int MAX_DIGIT_COUNT = 20;
+    char digits[MAX_DIGIT_COUNT + 1];
+    char* firstDigit = digits + MAX_DIGIT_COUNT;
+    *firstDigit = '\0';
+    do
+    {
+        --firstDigit;
+        *firstDigit = static_cast<char>('0' + (number % 10));
+        number /= 10;
+    } while (number > 0);
+
+    // ADD THE DIGITS.
+    AddText(firstDigit);
+}
+
+void PerformanceOverlay::AddRectangle(const sf::FloatRect& rectangle, const sf::Color& color)
+{
+    unsigned int firstVertexIndex = static_cast<unsigned int>(m_vertices.getVertexCount());
+    for (unsigned int vertexIndex = 0; vertexIndex < VERTICES_PER_QUAD; ++vertexIndex)
+    {
+        m_vertices.append(sf::Vertex(sf::Vector2f(), color, WHITE_TEXTURE_COORDINATES));
+    }
+
+    SetQuadPositions(firstVertexIndex, rectangle);
+}
+
+void PerformanceOverlay::SetQuadPositions(const unsigned int firstVertexIndex, const sf::FloatRect& rectangle)
+{
+    float right = rectangle.left + rectangle.width;
+    float bottom = rectangle.top + rectangle.height;
+    m_vertices[firstVertexIndex].position = sf::Vector2f(rectangle.left, rectangle.top);
+    m_vertices[firstVertexIndex + 1].position = sf::Vector2f(rectangle.left, bottom);
+    m_vertices[firstVertexIndex + 2].position = sf::Vector2f(right, bottom);
+    m_vertices[firstVertexIndex + 3].position = sf::Vector2f(right, rectangle.top);
+}
+
+void PerformanceOverlay::StartNextLine()
+{
+    m_textPositionInPixels.x = m_topLeftPositionInPixels.x + PADDING_IN_PIXELS;
+    m_textPositionInPixels.y += static_cast<float>(m_font->getLineSpacing(m_fontSizeInPixels));
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <SFML/Graphics.hpp>
+#include "Graphics/IRenderable.h"
+
+namespace GRAPHICS
+{
+namespace GUI
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  The number of each kind of gameplay object currently in play.
+    ////////////////////////////////////////////////////////
+    struct GameObjectCounts
+    {
+        unsigned int AlienCount;    ///< The number of aliens.
+        unsigned int MissileCount;  ///< The number of missiles from both the bunny and aliens.
+        unsigned int ExplosionCount;    ///< The number of explosions.
+        unsigned int EasterEggCount;    ///< The number of easter eggs.
+
+        /// @brief  Constructor.  Initializes counts for no game objects.
+        GameObjectCounts() :
+            AlienCount(0),
+            MissileCount(0),
+            ExplosionCount(0),
+            EasterEggCount(0)
+        {}
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  An overlay displaying performance statistics during gameplay:
+    ///         frames per second, a rolling graph of frame times, the time of
+    ///         each profiled phase, game object counts, and the draw calls and
+    ///         heap allocations of the previous frame.  Phase timings, draw calls,
+    ///         and allocations are only available in builds with profiling enabled.
+    ///
+    ///         So that it doesn't noticeably perturb what it measures, all text
+    ///         and graph bars are built into a single vertex array textured by
+    ///         the font (whose texture contains a white square for solid shapes),
+    ///         which is drawn with a single draw call.  Text is built directly from
+    ///         glyphs without formatting strings, so the overlay doesn't allocate
+    ///         once its vertex array has grown large enough.
+    ///
+    ///         Frame times are recorded whenever the overlay is rendered, even when
+    ///         it is invisible, so that the graph is full as soon as it is shown.
+    ////////////////////////////////////////////////////////
+    class PerformanceOverlay : public GRAPHICS::IRenderable
+    {
+    public:
+        /// @brief  The number of recent frames shown in the frame time graph.
+        static const unsigned int FRAME_TIME_GRAPH_SAMPLE_COUNT = 120;
+        /// @brief  The time available for each frame at 60 frames per second.
+        ///         Frames longer than this are highlighted in the frame time graph.
+        static const sf::Time FRAME_TIME_BUDGET;
+
+        /// @brief      Constructor.  The overlay is initially invisible.
+        /// @param[in]  topLeftPositionInPixels - The screen position of the top-left corner of the overlay.
+        /// @param[in]  fontSizeInPixels - The font size for text in the overlay.
+        /// @param[in]  textColor - The color for text in the overlay.
+        /// @param[in]  font - The font for text in the overlay.
+        explicit PerformanceOverlay(
+            const sf::Vector2f& topLeftPositionInPixels,
+            const unsigned int fontSizeInPixels,
+            const sf::Color& textColor,
+            const std::shared_ptr<sf::Font>& font);
+
+        /// @brief  Destructor.
+        virtual ~PerformanceOverlay();
+
+        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
+        ///             The time since the previous render is always recorded, but the overlay
+        ///             is only drawn if visible.
+        virtual void Render(sf::RenderTarget& renderTarget, const float interpolationRatio);
+
+        /// @brief  Returns whether or not the overlay is visible for rendering.
+        /// @return The visibility of the overlay.
+        bool IsVisible() const;
+
+        /// @brief      Sets the visibility of the overlay.
+        /// @param[in]  visibility - True to make visible; false to make invisible.
+        void SetVisible(const bool visibility);
+
+        /// @brief      Sets the game object counts displayed in the overlay.
+        /// @param[in]  gameObjectCounts - The number of each kind of game object in play.
+        void SetGameObjectCounts(const GameObjectCounts& gameObjectCounts);
+
+    private:
+        PerformanceOverlay(const PerformanceOverlay& overlayToCopy);    ///< Private to disallow copying.
+        PerformanceOverlay& operator= (const PerformanceOverlay& rhsOverlay);   ///< Private to disallow assignment.
+
+        /// @brief  Records the time since the overlay was previously rendered as a frame time.
+        void RecordFrameTime();
+
+        /// @brief  Rebuilds the vertices for all statistics in the overlay.
+        void BuildVertices();
+
+        /// @brief  Adds the bars of the frame time graph at the current line, along with
+        ///         a line marking the frame time budget, and moves to the line after it.
+        void AddFrameTimeGraph();
+
+        /// @brief      Adds a line of text labeling a number, with the number aligned
+        ///             in a column, and moves to the next line.
+        /// @param[in]  label - The label text.
+        /// @param[in]  number - The number to display after the label.
+        /// @param[in]  units - Text displayed after the number.  May be empty.
+        void AddNumberLine(const char* label, const uint64_t number, const char* units);
+
+        /// @brief      Adds text at the current text position, advancing past it.
+        /// @param[in]  text - The text to add.
+        void AddText(const char* text);
+
+        /// @brief      Adds the decimal digits of a number at the current text position, advancing past it.
+        /// @param[in]  number - The number to add.
+        void AddNumber(uint64_t number);
+
+        /// @brief      Adds a solid rectangle, textured by the white square of the font texture.
+        /// @param[in]  rectangle - The screen rectangle to fill, in pixels.
+        /// @param[in]  color - The color of the rectangle.
+        void AddRectangle(const sf::FloatRect& rectangle, const sf::Color& color);
+
+        /// @brief      Sets the positions of a quad already in the vertex array.
+        /// @param[in]  firstVertexIndex - The index of the first vertex of the quad.
+        /// @param[in]  rectangle - The screen rectangle covered by the quad, in pixels.
+        void SetQuadPositions(const unsigned int firstVertexIndex, const sf::FloatRect& rectangle);
+
+        /// @brief  Moves the current text position to the start of the next line.
+        void StartNextLine();
+
+        sf::Vector2f m_topLeftPositionInPixels; ///< The screen position of the top-left corner of the overlay.
+        unsigned int m_fontSizeInPixels;    ///< The font size for text in the overlay.
+        sf::Color m_textColor;  ///< The color for text in the overlay.
+        std::shared_ptr<sf::Font> m_font;   ///< The font for text in the overlay.
+        bool m_isVisible;   ///< Whether or not the overlay is visible.
+        bool m_previouslyRendered;  ///< Whether or not the overlay has been rendered before, so that a frame time can be measured.
+        sf::Clock m_frameClock; ///< Measures the time between each render of the overlay.
+        std::array<sf::Time, FRAME_TIME_GRAPH_SAMPLE_COUNT> m_frameTimes;   ///< The most recent frame times, used as a ring buffer.
+        unsigned int m_nextFrameTimeIndex;  ///< The index in the ring buffer for the next frame time.
+        unsigned int m_recordedFrameTimeCount;  ///< The number of frame times in the ring buffer.
+        GameObjectCounts m_gameObjectCounts;    ///< The game object counts to display.
+        sf::VertexArray m_vertices; ///< The quads for all text and shapes in the overlay.
+        sf::Vector2f m_textPositionInPixels;    ///< The screen position of the next text added to the overlay.
+    };
+}
+}
@@ -1,5 +1,6 @@
 #include <sstream>
 #include "Graphics/Gui/ScoreLabel.h"
+#include "Profiling/Profiling.h"
 
 using namespace GRAPHICS::GUI;
 
@@ -22,13 +23,16 @@ ScoreLabel::~ScoreLabel()
     // Nothing else to do.
 }
 
-void ScoreLabel::Render(sf::RenderTarget& renderTarget)
+void ScoreLabel::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
 {
     renderTarget.draw(m_labelText);
+    PROFILE_DRAW_CALL();
 }
 
 void ScoreLabel::SetScore(const uint16_t score)
 {
+    PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_TEXT);
+
     // CREATE THE STRING TO DISPLAY IN THE LABEL.
     std::ostringstream scoreStringConverter;
     // Pad the score with zeroes on the left.
@@ -27,8 +27,8 @@ namespace GUI
         /// @brief  Destructor.
         virtual ~ScoreLabel();
 
-        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget)
-        virtual void Render(sf::RenderTarget& renderTarget);
+        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
+        virtual void Render(sf::RenderTarget& renderTarget, const float interpolationRatio);
 
         /// @brief      Sets the score displayed in the label.
         /// @param[in]  score - The score to display in the label.
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Graphics/SpriteBatch.h"
+
+namespace GRAPHICS
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  An interface for objects that render by adding their
+    ///         sprites to a shared sprite batch rather than drawing
+    ///         directly to a render target.
+    ////////////////////////////////////////////////////////
+    class IBatchRenderable
+    {
+    public:
+        /// @brief  Virtual destructor to ensure proper destruction of implementing classes.
+        virtual ~IBatchRenderable() {};
+
+        /// @brief          Adds the object's sprites for a frame to a sprite batch.
+        /// @param[in,out]  spriteBatch - The sprite batch to add sprites to.
+        /// @param[in]      interpolationRatio - How far (from 0 to 1) the rendered frame lies between
+        ///                 the previous and current simulation updates.  Used to smooth movement
+        ///                 when rendering occurs at a different rate than simulation.
+        virtual void Render(SpriteBatch& spriteBatch, const float interpolationRatio) = 0;
+    };
+}
@@ -15,6 +15,9 @@ namespace GRAPHICS
 
         /// @brief          Renders a frame for the object.
         /// @param[in,out]  renderTarget - The render target to render to.
-        virtual void Render(sf::RenderTarget& renderTarget) = 0;
+        /// @param[in]      interpolationRatio - How far (from 0 to 1) the rendered frame lies between
+        ///                 the previous and current simulation updates.  Used to smooth movement
+        ///                 when rendering occurs at a different rate than simulation.
+        virtual void Render(sf::RenderTarget& renderTarget, const float interpolationRatio) = 0;
     };
 }
\ No newline at end of file
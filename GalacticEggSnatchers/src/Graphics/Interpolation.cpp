@@ -0,0 +1,17 @@
+#include "Graphics/Interpolation.h"
+
+sf::RenderStates GRAPHICS::GetInterpolatedRenderStates(
+    const sf::Vector2f& previousPosition,
+    const sf::Vector2f& currentPosition,
+    const float interpolationRatio)
+{
+    // CALCULATE THE INTERPOLATED POSITION.
+    sf::Vector2f movementSincePreviousPosition = currentPosition - previousPosition;
+    sf::Vector2f interpolatedPosition = previousPosition + (interpolationRatio * movementSincePreviousPosition);
+
+    // OFFSET THE OBJECT FROM ITS CURRENT POSITION TO THE INTERPOLATED POSITION.
+    sf::Vector2f offsetFromCurrentPosition = interpolatedPosition - currentPosition;
+    sf::RenderStates interpolatedRenderStates;
+    interpolatedRenderStates.transform.translate(offsetFromCurrentPosition);
+    return interpolatedRenderStates;
+}
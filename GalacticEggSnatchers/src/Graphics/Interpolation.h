@@ -0,0 +1,20 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+namespace GRAPHICS
+{
+    /// @brief      Gets render states that draw a transformable object at a position interpolated
+    ///             between where it was before the latest simulation update and where it is now.
+    ///             This allows objects to move smoothly when rendering occurs between fixed
+    ///             simulation updates without modifying the object's simulated position.
+    /// @param[in]  previousPosition - The position of the object before the latest simulation update.
+    /// @param[in]  currentPosition - The current position of the object.
+    /// @param[in]  interpolationRatio - How far (from 0 to 1) to render the object between
+    ///             its previous and current positions.
+    /// @return     The render states for drawing the object at its interpolated position.
+    sf::RenderStates GetInterpolatedRenderStates(
+        const sf::Vector2f& previousPosition,
+        const sf::Vector2f& currentPosition,
+        const float interpolationRatio);
+}
@@ -0,0 +1,75 @@
+#include "Graphics/SpriteBatch.h"
+#include "Profiling/Profiling.h"
+
+using namespace GRAPHICS;
+
+SpriteBatch::SpriteBatch() :
+    m_vertices(sf::Quads)
+{
+    // Nothing else to do.
+}
+
+SpriteBatch::~SpriteBatch()
+{
+    // Nothing to do.
+}
+
+void SpriteBatch::Clear()
+{
+    m_vertices.clear();
+}
+
+void SpriteBatch::Add(const sf::Sprite& sprite)
+{
+    Add(sprite, sf::RenderStates::Default);
+}
+
+void SpriteBatch::Add(const sf::Sprite& sprite, const sf::RenderStates& renderStates)
+{
+    // DETERMINE THE TRANSFORMATION FOR THE SPRITE.
+    sf::Transform transform = renderStates.transform * sprite.getTransform();
+
+    // CALCULATE THE CORNERS OF THE SPRITE.
+    // This mirrors how a sprite positions its own vertices, with its local bounds
+    // starting at the origin and its texture coordinates covering its texture rectangle.
+    sf::FloatRect localBounds = sprite.getLocalBounds();
+    sf::Vector2f topLeftPosition = transform.transformPoint(0.0f, 0.0f);
+    sf::Vector2f bottomLeftPosition = transform.transformPoint(0.0f, localBounds.height);
+    sf::Vector2f bottomRightPosition = transform.transformPoint(localBounds.width, localBounds.height);
+    sf::Vector2f topRightPosition = transform.transformPoint(localBounds.width, 0.0f);
+
+    const sf::IntRect& textureRectangle = sprite.getTextureRect();
+    float textureLeft = static_cast<float>(textureRectangle.left);
+    float textureRight = textureLeft + static_cast<float>(textureRectangle.width);
+    float textureTop = static_cast<float>(textureRectangle.top);
+    float textureBottom = textureTop + static_cast<float>(textureRectangle.height);
+
+    // ADD THE CORNERS OF THE SPRITE.
+    const sf::Color& color = sprite.getColor();
+    m_vertices.append(sf::Vertex(topLeftPosition, color, sf::Vector2f(textureLeft, textureTop)));
+    m_vertices.append(sf::Vertex(bottomLeftPosition, color, sf::Vector2f(textureLeft, textureBottom)));
+    m_vertices.append(sf::Vertex(bottomRightPosition, color, sf::Vector2f(textureRight, textureBottom)));
+    m_vertices.append(sf::Vertex(topRightPosition, color, sf::Vector2f(textureRight, textureTop)));
+}
+
+unsigned int SpriteBatch::GetSpriteCount() const
+{
+    const unsigned int VERTICES_PER_SPRITE = 4;
+    unsigned int spriteCount = static_cast<unsigned int>(m_vertices.getVertexCount()) / VERTICES_PER_SPRITE;
+    return spriteCount;
+}
+
+void SpriteBatch::Render(sf::RenderTarget& renderTarget, const sf::Texture& texture) const
+{
+    // CHECK IF ANY SPRITES NEED TO BE DRAWN.
+    bool spritesExist = (m_vertices.getVertexCount() > 0);
+    if (!spritesExist)
+    {
+        return;
+    }
+
+    // DRAW ALL SPRITES AT ONCE.
+    sf::RenderStates renderStates(&texture);
+    renderTarget.draw(m_vertices, renderStates);
+    PROFILE_DRAW_CALL();
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+namespace GRAPHICS
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Collects many sprites that share a single texture
+    ///         (typically a texture atlas) into one vertex array so
+    ///         that they can all be drawn with a single draw call.
+    ///
+    ///         Sprites are drawn in the order they were added, so
+    ///         sprites added later appear on top.  The vertex array
+    ///         keeps its memory between frames, so adding sprites
+    ///         doesn't allocate once the batch has grown large enough.
+    ////////////////////////////////////////////////////////
+    class SpriteBatch
+    {
+    public:
+        /// @brief  Constructor.  Creates an empty batch.
+        explicit SpriteBatch();
+
+        /// @brief  Destructor.
+        ~SpriteBatch();
+
+        /// @brief  Removes all sprites from the batch so that a new frame may be batched.
+        void Clear();
+
+        /// @brief      Adds a sprite to the batch.  Its texture is ignored - the sprite is
+        ///             assumed to use the same texture as all other sprites in the batch.
+        /// @param[in]  sprite - The sprite to add, with its current transform and color.
+        void Add(const sf::Sprite& sprite);
+
+        /// @brief      Adds a sprite to the batch with an additional transformation applied.
+        ///             Its texture is ignored - the sprite is assumed to use the same
+        ///             texture as all other sprites in the batch.
+        /// @param[in]  sprite - The sprite to add, with its current transform and color.
+        /// @param[in]  renderStates - The render states whose transform is applied on top of
+        ///             the sprite's own transform, such as an interpolation offset.
+        void Add(const sf::Sprite& sprite, const sf::RenderStates& renderStates);
+
+        /// @brief  Gets the number of sprites in the batch.
+        /// @return The number of sprites added since the batch was last cleared.
+        unsigned int GetSpriteCount() const;
+
+        /// @brief          Draws all sprites in the batch with a single draw call.
+        /// @param[in,out]  renderTarget - The render target to draw to.
+        /// @param[in]      texture - The texture shared by all sprites in the batch.
+        void Render(sf::RenderTarget& renderTarget, const sf::Texture& texture) const;
+
+    private:
+        SpriteBatch(const SpriteBatch& batchToCopy);    ///< Private to disallow copying.
+        SpriteBatch& operator= (const SpriteBatch& rhsBatch);   ///< Private to disallow assignment.
+
+        sf::VertexArray m_vertices; ///< The four corners of each sprite in the batch.
+    };
+}
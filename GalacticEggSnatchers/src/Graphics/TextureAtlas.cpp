@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include "Graphics/TextureAtlas.h"
+
+using namespace GRAPHICS;
+
+/// @brief      Gets the smallest power of two that is at least the specified value.
+///             Power-of-two texture sizes are supported by all graphics devices.
+/// @param[in]  value - The minimum value.
+/// @return     The smallest power of two that is at least the value.
+static unsigned int GetNextPowerOfTwo(const unsigned int value)
+{
+    unsigned int powerOfTwo = 1;
+    while (powerOfTwo < value)
+    {
+        powerOfTwo *= 2;
+    }
+
+    return powerOfTwo;
+}
+
+TextureAtlas::TextureAtlas(const std::vector<RESOURCES::AssetId>& imageIds, RESOURCES::ResourceManager& resourceManager) :
+    m_image(),
+    m_texture(),
+    m_imagesPacked(),
+    m_textureRectangles()
+{
+    // LOAD ALL IMAGES TO BE PACKED.
+    // Duplicate images are only packed once.
+    m_imagesPacked.fill(false);
+    std::vector<RESOURCES::AssetId> uniqueImageIds;
+    std::vector< std::shared_ptr<sf::Image> > images;
+    unsigned int maxPaddedImageWidth = 0;
+    unsigned int totalPaddedImageArea = 0;
+    for (RESOURCES::AssetId imageId : imageIds)
+    {
+        bool imageAlreadyLoaded = m_imagesPacked[imageId];
+        if (imageAlreadyLoaded)
+        {
+            continue;
+        }
+
+        const std::string& imageFilepath = RESOURCES::GetAssetFilepath(imageId);
+        std::shared_ptr<sf::Image> image = resourceManager.GetImage(imageFilepath);
+        bool imageLoaded = (nullptr != image);
+        if (!imageLoaded)
+        {
+            throw std::runtime_error("Error loading image for texture atlas: " + imageFilepath);
+        }
+
+        m_imagesPacked[imageId] = true;
+        uniqueImageIds.push_back(imageId);
+        images.push_back(image);
+
+        sf::Vector2u imageSize = image->getSize();
+        unsigned int paddedImageWidth = imageSize.x + PADDING_IN_PIXELS;
+        unsigned int paddedImageHeight = imageSize.y + PADDING_IN_PIXELS;
+        maxPaddedImageWidth = std::max(maxPaddedImageWidth, paddedImageWidth);
+        totalPaddedImageArea += (paddedImageWidth * paddedImageHeight);
+    }
+
+    // SORT THE IMAGES FROM TALLEST TO SHORTEST.
+    // Packing similarly tall images into the same shelf minimizes wasted space.
+    std::vector<unsigned int> packingOrder(images.size());
+    for (unsigned int imageIndex = 0; imageIndex < packingOrder.size(); ++imageIndex)
+    {
+        packingOrder[imageIndex] = imageIndex;
+    }
+    std::stable_sort(
+        packingOrder.begin(),
+        packingOrder.end(),
+        [&images](const unsigned int firstImageIndex, const unsigned int secondImageIndex)
+        {
+            return images[firstImageIndex]->getSize().y > images[secondImageIndex]->getSize().y;
+        });
+
+    // DETERMINE THE WIDTH OF THE ATLAS.
+    // A roughly square atlas is targeted, but it must be wide enough for the widest image.
+    unsigned int squareAtlasWidth = static_cast<unsigned int>(std::ceil(std::sqrt(static_cast<float>(totalPaddedImageArea))));
+    unsigned int atlasWidth = GetNextPowerOfTwo(std::max(squareAtlasWidth, maxPaddedImageWidth + PADDING_IN_PIXELS));
+
+    // PACK THE IMAGES INTO SHELVES.
+    // Padding is left before the first image in each shelf and above the first shelf as well
+    // so that every image is surrounded by transparent pixels.
+    unsigned int currentShelfLeft = PADDING_IN_PIXELS;
+    unsigned int currentShelfTop = PADDING_IN_PIXELS;
+    unsigned int currentShelfHeight = 0;
+    for (unsigned int imageIndex : packingOrder)
+    {
+        // Start a new shelf if the image doesn't fit in the remaining width of the current one.
+        sf::Vector2u imageSize = images[imageIndex]->getSize();
+        bool imageFitsInCurrentShelf = ((currentShelfLeft + imageSize.x + PADDING_IN_PIXELS) <= atlasWidth);
+        if (!imageFitsInCurrentShelf)
+        {
+            currentShelfTop += currentShelfHeight + PADDING_IN_PIXELS;
+            currentShelfLeft = PADDING_IN_PIXELS;
+            currentShelfHeight = 0;
+        }
+
+        sf::IntRect textureRectangle(currentShelfLeft, currentShelfTop, imageSize.x, imageSize.y);
+        m_textureRectangles[uniqueImageIds[imageIndex]] = textureRectangle;
+
+        currentShelfLeft += imageSize.x + PADDING_IN_PIXELS;
+        currentShelfHeight = std::max(currentShelfHeight, imageSize.y);
+    }
+    unsigned int atlasHeight = GetNextPowerOfTwo(currentShelfTop + currentShelfHeight + PADDING_IN_PIXELS);
+
+    // COPY THE IMAGES INTO THE ATLAS.
+    // The atlas starts out fully transparent so that padding is never visible.
+    m_image.create(atlasWidth, atlasHeight, sf::Color::Transparent);
+    for (unsigned int imageIndex = 0; imageIndex < images.size(); ++imageIndex)
+    {
+        const sf::IntRect& textureRectangle = m_textureRectangles[uniqueImageIds[imageIndex]];
+        m_image.copy(*images[imageIndex], textureRectangle.left, textureRectangle.top);
+    }
+}
+
+TextureAtlas::~TextureAtlas()
+{
+    // Nothing to do.
+}
+
+void TextureAtlas::CreateTexture()
+{
+    bool textureCreated = m_texture.loadFromImage(m_image);
+    if (!textureCreated)
+    {
+        throw std::runtime_error("Error creating texture atlas texture.");
+    }
+}
+
+const sf::Texture& TextureAtlas::GetTexture() const
+{
+    return m_texture;
+}
+
+const sf::Image& TextureAtlas::GetImage() const
+{
+    return m_image;
+}
+
+bool TextureAtlas::Contains(const RESOURCES::AssetId imageId) const
+{
+    bool imagePacked = m_imagesPacked[imageId];
+    return imagePacked;
+}
+
+const sf::IntRect& TextureAtlas::GetTextureRectangle(const RESOURCES::AssetId imageId) const
+{
+    bool imagePacked = m_imagesPacked[imageId];
+    if (!imagePacked)
+    {
+        throw std::runtime_error("Image not in texture atlas: " + RESOURCES::GetAssetFilepath(imageId));
+    }
+
+    return m_textureRectangles[imageId];
+}
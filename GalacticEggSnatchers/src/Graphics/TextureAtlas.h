@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "Resources/AssetFilepaths.h"
+#include "Resources/ResourceManager.h"
+
+namespace GRAPHICS
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Packs many images into a single larger image so that
+    ///         sprites using any of them can share one texture.  This
+    ///         allows sprites with different images to be drawn together
+    ///         in a single draw call.
+    ///
+    ///         Images are packed into rows ("shelves") from tallest to
+    ///         shortest, which wastes little space for the similarly
+    ///         sized sprites in the game.  Images are separated by
+    ///         transparent padding so that filtering never bleeds
+    ///         neighboring images into each other.
+    ///
+    ///         Packed images are identified by asset ID, so finding
+    ///         an image's area of the atlas is a single array lookup.
+    ////////////////////////////////////////////////////////
+    class TextureAtlas
+    {
+    public:
+        /// @brief  The transparent space between packed images, in pixels.
+        static const unsigned int PADDING_IN_PIXELS = 1;
+
+        /// @brief      Constructor.  Packs all of the specified images.
+        ///             An exception is thrown if any image cannot be loaded.
+        /// @param[in]  imageIds - The asset IDs of the images to pack.
+        /// @param[in,out]  resourceManager - The resource manager for loading images.
+        explicit TextureAtlas(const std::vector<RESOURCES::AssetId>& imageIds, RESOURCES::ResourceManager& resourceManager);
+
+        /// @brief  Destructor.
+        ~TextureAtlas();
+
+        /// @brief  Creates the texture for the packed image, which requires a graphics device.
+        ///         An exception is thrown if the texture cannot be created.
+        void CreateTexture();
+
+        /// @brief  Gets the texture for the packed image.  Only valid after CreateTexture().
+        /// @return The atlas texture.
+        const sf::Texture& GetTexture() const;
+
+        /// @brief  Gets the image containing all packed images.
+        /// @return The atlas image.
+        const sf::Image& GetImage() const;
+
+        /// @brief      Checks if an image was packed into the atlas.
+        /// @param[in]  imageId - The asset ID of the image to check.
+        /// @return     True if the image is in the atlas; false otherwise.
+        bool Contains(const RESOURCES::AssetId imageId) const;
+
+        /// @brief      Gets the area of the atlas containing a packed image.
+        ///             An exception is thrown if the image was not packed into the atlas.
+        /// @param[in]  imageId - The asset ID of the packed image.
+        /// @return     The rectangle of the image within the atlas, in pixels.
+        const sf::IntRect& GetTextureRectangle(const RESOURCES::AssetId imageId) const;
+
+    private:
+        TextureAtlas(const TextureAtlas& atlasToCopy);  ///< Private to disallow copying.
+        TextureAtlas& operator= (const TextureAtlas& rhsAtlas); ///< Private to disallow assignment.
+
+        sf::Image m_image;  ///< The image containing all packed images.
+        sf::Texture m_texture;  ///< The texture created from the packed image.
+        std::array<bool, RESOURCES::ASSET_ID_COUNT> m_imagesPacked; ///< Whether each asset was packed, by asset ID.
+        std::array<sf::IntRect, RESOURCES::ASSET_ID_COUNT> m_textureRectangles;    ///< The area of each packed image, by asset ID.
+    };
+}
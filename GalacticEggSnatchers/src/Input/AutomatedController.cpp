@@ -0,0 +1,47 @@
+#include "Input/AutomatedController.h"
+
+using namespace INPUT;
+
+// STATIC CONSTANT INITIALIZATION.
+// This is long enough for the bunny to cross most of the screen.
+const float AutomatedController::TIME_PER_DIRECTION_IN_SECONDS = 2.0f;
+
+AutomatedController::AutomatedController() :
+    m_timeInCurrentDirection(sf::Time::Zero),
+    m_movingLeft(true)
+{
+    // Nothing else to do.
+}
+        
+AutomatedController::~AutomatedController()
+{
+    // Nothing else to do.
+}
+
+void AutomatedController::Update(const sf::Time& elapsedTime)
+{
+    // SWITCH DIRECTIONS IF ENOUGH TIME HAS PASSED IN THE CURRENT DIRECTION.
+    m_timeInCurrentDirection += elapsedTime;
+    bool directionTimeExceeded = (m_timeInCurrentDirection.asSeconds() > TIME_PER_DIRECTION_IN_SECONDS);
+    if (directionTimeExceeded)
+    {
+        m_movingLeft = !m_movingLeft;
+        m_timeInCurrentDirection = sf::Time::Zero;
+    }
+}
+
+bool AutomatedController::LeftButtonPressed() const
+{
+    return m_movingLeft;
+}
+
+bool AutomatedController::RightButtonPressed() const
+{
+    return !m_movingLeft;
+}
+
+bool AutomatedController::FireButtonPressed() const
+{
+    // The fire button is always held so that missiles are fired as often as allowed.
+    return true;
+}
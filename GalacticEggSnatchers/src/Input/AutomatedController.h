@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Input/IInputController.h"
+
+namespace INPUT
+{
+    //////////////////////////////////////////////////////////////////
+    /// @brief  A controller supplying scripted input without any hardware,
+    ///         allowing gameplay to be driven in headless simulations.
+    ///         It sweeps back and forth between left and right while
+    ///         continuously holding the fire button.
+    //////////////////////////////////////////////////////////////////
+    class AutomatedController : public IInputController
+    {
+    public:
+        /// @brief  The time spent moving in a single direction before switching directions.
+        static const float TIME_PER_DIRECTION_IN_SECONDS;
+
+        /// @brief  Constructor.
+        explicit AutomatedController();
+        
+        /// @brief  Destructor.
+        virtual ~AutomatedController();
+
+        /// @copydoc    IInputController::Update(const sf::Time& elapsedTime)
+        virtual void Update(const sf::Time& elapsedTime);
+
+        /// @copydoc    IInputController::LeftButtonPressed() const
+        virtual bool LeftButtonPressed() const;
+
+        /// @copydoc    IInputController::RightButtonPressed() const
+        virtual bool RightButtonPressed() const;
+
+        /// @copydoc    IInputController::FireButtonPressed() const
+        virtual bool FireButtonPressed() const;
+
+    private:
+        AutomatedController(const AutomatedController& controllerToCopy);    ///< Private to disallow copying.
+        AutomatedController& operator=(const AutomatedController& rhsController);   ///< Private to disallow copying.
+
+        sf::Time m_timeInCurrentDirection;  ///< The time spent moving in the current direction.
+        bool m_movingLeft;  ///< True if the controller is currently moving left; false if moving right.
+    };
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <SFML/System.hpp>
+
 /// @brief  Holds code related to handling user input.
 namespace INPUT
 {
@@ -12,6 +14,10 @@ namespace INPUT
         /// @brief  Virtual destructor to allow proper destruction of implementing classes.
         virtual ~IInputController() {};
 
+        /// @brief      Updates any internal state of the controller for the next frame of processing.
+        /// @param[in]  elapsedTime - The elapsed time since the last frame of updating.
+        virtual void Update(const sf::Time& elapsedTime) = 0;
+
         /// @brief  Checks if the left button is currently pressed.
         /// @return True if the left button is pressed; false otherwise.
         virtual bool LeftButtonPressed() const = 0;
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <fstream>
+#include <utility>
+#include "Input/InputRecording.h"
+
+using namespace INPUT;
+
+/// @brief  The bytes at the start of every recording file that identify it as an input recording.
+static const char RECORDING_IDENTIFIER[] = { 'G', 'E', 'S', 'I', 'N', 'P', '0', '1' };
+
+/// @brief          Writes a number to a recording file.
+/// @param[in]      number - The number to write.
+/// @param[in,out]  file - The file to write to.
+template <typename NumberType>
+static void WriteNumber(const NumberType number, std::ofstream& file)
+{
+    file.write(reinterpret_cast<const char*>(&number), sizeof(number));
+}
+
+/// @brief          Reads a number from a recording file.
+/// @param[in,out]  file - The file to read from.
+/// @param[out]     number - The number that was read.
+/// @return         True if the number was read; false if the file ended first.
+template <typename NumberType>
+static bool ReadNumber(std::ifstream& file, NumberType& number)
+{
+    file.read(reinterpret_cast<char*>(&number), sizeof(number));
+    bool numberRead = file.good();
+    return numberRead;
+}
+
+// STATIC METHODS.
+
+std::shared_ptr<InputRecording> InputRecording::Load(const std::string& filepath)
+{
+    // OPEN THE RECORDING.
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file)
+    {
+        return nullptr;
+    }
+
+    // VERIFY THAT THE FILE IS AN INPUT RECORDING.
+    char identifier[sizeof(RECORDING_IDENTIFIER)];
+    file.read(identifier, sizeof(identifier));
+    bool identifierMatches = file.good() && std::equal(identifier, identifier + sizeof(identifier), RECORDING_IDENTIFIER);
+    if (!identifierMatches)
+    {
+        return nullptr;
+    }
+
+    // READ THE SETTINGS OF THE RECORDED SESSION.
+    uint64_t randomSeed = 0;
+    uint32_t ticksPerSecond = 0;
+    uint32_t runCount = 0;
+    bool headerRead = ReadNumber(file, randomSeed) && ReadNumber(file, ticksPerSecond) && ReadNumber(file, runCount);
+    bool ticksPerSecondValid = (ticksPerSecond > 0);
+    if (!headerRead || !ticksPerSecondValid)
+    {
+        return nullptr;
+    }
+
+    // READ EACH RUN OF TICKS WITH THE SAME BUTTON STATES.
+    std::shared_ptr<InputRecording> recording = std::make_shared<InputRecording>(randomSeed, ticksPerSecond);
+    for (uint32_t runIndex = 0; runIndex < runCount; ++runIndex)
+    {
+        uint8_t buttonStates = 0;
+        uint32_t runTickCount = 0;
+        bool runRead = ReadNumber(file, buttonStates) && ReadNumber(file, runTickCount);
+        if (!runRead)
+        {
+            return nullptr;
+        }
+
+        recording->m_buttonStatesByTick.insert(recording->m_buttonStatesByTick.end(), runTickCount, buttonStates);
+    }
+
+    return recording;
+}
+
+// INSTANCE METHODS.
+
+InputRecording::InputRecording(const uint64_t randomSeed, const unsigned int ticksPerSecond) :
+    m_randomSeed(randomSeed),
+    m_ticksPerSecond(ticksPerSecond),
+    m_buttonStatesByTick()
+{
+    // RESERVE SPACE FOR A TYPICAL SESSION.
+    // This prevents recording from regularly reallocating memory during gameplay.
+    const unsigned int TYPICAL_SESSION_LENGTH_IN_SECONDS = 10 * 60;
+    m_buttonStatesByTick.reserve(TYPICAL_SESSION_LENGTH_IN_SECONDS * ticksPerSecond);
+}
+
+InputRecording::~InputRecording()
+{
+    // Nothing else to do.
+}
+
+bool InputRecording::Save(const std::string& filepath) const
+{
+    // FIND EACH RUN OF TICKS WITH THE SAME BUTTON STATES.
+    // Each run is stored as its button states followed by its number of ticks.
+    std::vector< std::pair<uint8_t, uint32_t> > runs;
+    for (uint8_t buttonStates : m_buttonStatesByTick)
+    {
+        bool continuesRun = !runs.empty() && (runs.back().first == buttonStates);
+        if (continuesRun)
+        {
+            ++runs.back().second;
+        }
+        else
+        {
+            runs.push_back(std::make_pair(buttonStates, 1u));
+        }
+    }
+
+    // WRITE THE RECORDING.
+    std::ofstream file(filepath, std::ios::binary);
+    file.write(RECORDING_IDENTIFIER, sizeof(RECORDING_IDENTIFIER));
+    WriteNumber(m_randomSeed, file);
+    WriteNumber(static_cast<uint32_t>(m_ticksPerSecond), file);
+    WriteNumber(static_cast<uint32_t>(runs.size()), file);
+    for (const std::pair<uint8_t, uint32_t>& run : runs)
+    {
+        WriteNumber(run.first, file);
+        WriteNumber(run.second, file);
+    }
+
+    bool recordingSaved = file.good();
+    return recordingSaved;
+}
+
+void InputRecording::AddTick(const IInputController& controller)
+{
+    uint8_t buttonStates = 0;
+    if (controller.LeftButtonPressed())
+    {
+        buttonStates |= INPUT_BUTTON_LEFT;
+    }
+    if (controller.RightButtonPressed())
+    {
+        buttonStates |= INPUT_BUTTON_RIGHT;
+    }
+    if (controller.FireButtonPressed())
+    {
+        buttonStates |= INPUT_BUTTON_FIRE;
+    }
+
+    m_buttonStatesByTick.push_back(buttonStates);
+}
+
+uint64_t InputRecording::GetRandomSeed() const
+{
+    return m_randomSeed;
+}
+
+unsigned int InputRecording::GetTicksPerSecond() const
+{
+    return m_ticksPerSecond;
+}
+
+unsigned int InputRecording::GetTickCount() const
+{
+    return static_cast<unsigned int>(m_buttonStatesByTick.size());
+}
+
+uint8_t InputRecording::GetButtonStates(const unsigned int tickIndex) const
+{
+    return m_buttonStatesByTick[tickIndex];
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Input/IInputController.h"
+
+namespace INPUT
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Flags identifying each button of a controller,
+    ///         which are combined to store the state of all
+    ///         buttons in a single byte.
+    ////////////////////////////////////////////////////////
+    enum InputButton
+    {
+        INPUT_BUTTON_LEFT = 0x1,    ///< The left button.
+        INPUT_BUTTON_RIGHT = 0x2,   ///< The right button.
+        INPUT_BUTTON_FIRE = 0x4     ///< The fire button.
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  The input supplied by a controller during each
+    ///         simulation tick of a gameplay session, along with
+    ///         everything else needed to replay the session
+    ///         exactly: the random seed and the tick rate.
+    ///
+    ///         In memory, the state of all buttons is stored as
+    ///         one byte per tick for quick access during replay.
+    ///         In files, consecutive ticks with the same button
+    ///         states are stored as a single run, since input
+    ///         rarely changes from one tick to the next.  Numbers
+    ///         are stored in the byte order of the machine the
+    ///         recording was saved on.
+    ////////////////////////////////////////////////////////
+    class InputRecording
+    {
+    public:
+        /// @brief      Loads a previously saved recording.
+        /// @param[in]  filepath - The filepath of the recording.
+        /// @return     The recording, if it was loaded; null if it doesn't exist or isn't valid.
+        static std::shared_ptr<InputRecording> Load(const std::string& filepath);
+
+        /// @brief      Constructor.  Creates a recording without any ticks.
+        /// @param[in]  randomSeed - The seed for all randomness in the recorded session.
+        /// @param[in]  ticksPerSecond - The number of simulation ticks per second of game time.
+        explicit InputRecording(const uint64_t randomSeed, const unsigned int ticksPerSecond);
+
+        /// @brief  Destructor.
+        ~InputRecording();
+
+        /// @brief      Saves the recording to a file.
+        /// @param[in]  filepath - The filepath to save to.
+        /// @return     True if the recording was saved; false otherwise.
+        bool Save(const std::string& filepath) const;
+
+        /// @brief      Records the current state of a controller's buttons as the next tick.
+        /// @param[in]  controller - The controller to record, already updated for the tick.
+        void AddTick(const IInputController& controller);
+
+        /// @brief  Gets the seed for all randomness in the recorded session.
+        /// @return The random seed.
+        uint64_t GetRandomSeed() const;
+
+        /// @brief  Gets the rate of simulation ticks in the recorded session.
+        /// @return The number of ticks per second of game time.
+        unsigned int GetTicksPerSecond() const;
+
+        /// @brief  Gets the number of recorded ticks.
+        /// @return The number of ticks with recorded input.
+        unsigned int GetTickCount() const;
+
+        /// @brief      Gets the state of all buttons during a tick.
+        /// @param[in]  tickIndex - The index of the tick.  Must be less than GetTickCount().
+        /// @return     The InputButton flags of all buttons that were pressed.
+        uint8_t GetButtonStates(const unsigned int tickIndex) const;
+
+    private:
+        InputRecording(const InputRecording& recordingToCopy);  ///< Private to disallow copying.
+        InputRecording& operator= (const InputRecording& rhsRecording); ///< Private to disallow assignment.
+
+        uint64_t m_randomSeed;  ///< The seed for all randomness in the recorded session.
+        unsigned int m_ticksPerSecond;  ///< The number of simulation ticks per second of game time.
+        std::vector<uint8_t> m_buttonStatesByTick;  ///< The InputButton flags of all pressed buttons during each tick.
+    };
+}
@@ -13,6 +13,11 @@ KeyboardController::~KeyboardController()
     // Nothing else to do.
 }
 
+void KeyboardController::Update(const sf::Time& /*elapsedTime*/)
+{
+    // Nothing else to do.
+}
+
 bool KeyboardController::LeftButtonPressed() const
 {
     return sf::Keyboard::isKeyPressed(sf::Keyboard::Left);
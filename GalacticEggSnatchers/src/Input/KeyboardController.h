@@ -18,6 +18,10 @@ namespace INPUT
         /// @brief  Destructor.
         virtual ~KeyboardController();
 
+        /// @copydoc    IInputController::Update(const sf::Time& elapsedTime)
+        /// @brief      Does nothing since the keyboard state is read directly from hardware.
+        virtual void Update(const sf::Time& elapsedTime);
+
         /// @copydoc    IInputController::LeftButtonPressed() const
         virtual bool LeftButtonPressed() const;
 
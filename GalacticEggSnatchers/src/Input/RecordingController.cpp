@@ -0,0 +1,69 @@
+#include <iostream>
+#include "Input/RecordingController.h"
+
+using namespace INPUT;
+
+RecordingController::RecordingController(
+    const std::shared_ptr<IInputController>& recordedController,
+    const uint64_t randomSeed,
+    const unsigned int ticksPerSecond,
+    const std::string& recordingFilepath) :
+    m_recordedController(recordedController),
+    m_recording(randomSeed, ticksPerSecond),
+    m_recordingFilepath(recordingFilepath),
+    m_buttonStates(0)
+{
+    // Nothing else to do.
+}
+        
+RecordingController::~RecordingController()
+{
+    bool recordingSaved = m_recording.Save(m_recordingFilepath);
+    if (!recordingSaved)
+    {
+        std::cerr << "Error writing input recording: " << m_recordingFilepath << std::endl;
+    }
+}
+
+void RecordingController::Update(const sf::Time& elapsedTime)
+{
+    // READ THE BUTTONS FOR THE CURRENT TICK.
+    // They are only read once so that buttons changing later in the tick
+    // can't make gameplay see different input than was recorded.
+    m_recordedController->Update(elapsedTime);
+    m_buttonStates = 0;
+    if (m_recordedController->LeftButtonPressed())
+    {
+        m_buttonStates |= INPUT_BUTTON_LEFT;
+    }
+    if (m_recordedController->RightButtonPressed())
+    {
+        m_buttonStates |= INPUT_BUTTON_RIGHT;
+    }
+    if (m_recordedController->FireButtonPressed())
+    {
+        m_buttonStates |= INPUT_BUTTON_FIRE;
+    }
+
+    // RECORD THE TICK.
+    // The button states are recorded through this controller's own getters.
+    m_recording.AddTick(*this);
+}
+
+bool RecordingController::LeftButtonPressed() const
+{
+    bool leftButtonPressed = (0 != (m_buttonStates & INPUT_BUTTON_LEFT));
+    return leftButtonPressed;
+}
+
+bool RecordingController::RightButtonPressed() const
+{
+    bool rightButtonPressed = (0 != (m_buttonStates & INPUT_BUTTON_RIGHT));
+    return rightButtonPressed;
+}
+
+bool RecordingController::FireButtonPressed() const
+{
+    bool fireButtonPressed = (0 != (m_buttonStates & INPUT_BUTTON_FIRE));
+    return fireButtonPressed;
+}
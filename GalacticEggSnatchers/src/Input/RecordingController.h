@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "Input/IInputController.h"
+#include "Input/InputRecording.h"
+
+namespace INPUT
+{
+    //////////////////////////////////////////////////////////////////
+    /// @brief  A controller that passes through input from another
+    ///         controller while recording it, so that the session
+    ///         can later be replayed.  Each update of the controller
+    ///         is recorded as a single simulation tick.  Buttons are read
+    ///         from the other controller once per update, and those same
+    ///         button states are both recorded and supplied to gameplay,
+    ///         so the recording matches what gameplay saw.  The recording
+    ///         is saved to a file once the controller is destroyed.
+    //////////////////////////////////////////////////////////////////
+    class RecordingController : public IInputController
+    {
+    public:
+        /// @brief      Constructor.
+        /// @param[in]  recordedController - The controller supplying the input to record.
+        /// @param[in]  randomSeed - The seed for all randomness in the recorded session.
+        /// @param[in]  ticksPerSecond - The number of simulation ticks per second of game time.
+        /// @param[in]  recordingFilepath - The filepath to save the recording to.
+        explicit RecordingController(
+            const std::shared_ptr<IInputController>& recordedController,
+            const uint64_t randomSeed,
+            const unsigned int ticksPerSecond,
+            const std::string& recordingFilepath);
+        
+        /// @brief  Destructor.  Saves the recording.  Saving is best-effort
+        ///         since recording is only a development aid.
+        virtual ~RecordingController();
+
+        /// @copydoc    IInputController::Update(const sf::Time& elapsedTime)
+        virtual void Update(const sf::Time& elapsedTime);
+
+        /// @copydoc    IInputController::LeftButtonPressed() const
+        virtual bool LeftButtonPressed() const;
+
+        /// @copydoc    IInputController::RightButtonPressed() const
+        virtual bool RightButtonPressed() const;
+
+        /// @copydoc    IInputController::FireButtonPressed() const
+        virtual bool FireButtonPressed() const;
+
+    private:
+        RecordingController(const RecordingController& controllerToCopy);    ///< Private to disallow copying.
+        RecordingController& operator=(const RecordingController& rhsController);   ///< Private to disallow copying.
+
+        std::shared_ptr<IInputController> m_recordedController;  ///< The controller supplying the input to record.
+        InputRecording m_recording; ///< The input recorded so far.
+        std::string m_recordingFilepath;    ///< The filepath to save the recording to.
+        uint8_t m_buttonStates; ///< The InputButton flags of all buttons pressed during the current tick.
+    };
+}
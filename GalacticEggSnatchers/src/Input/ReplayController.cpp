@@ -0,0 +1,49 @@
+#include "Input/ReplayController.h"
+
+using namespace INPUT;
+
+ReplayController::ReplayController(const std::shared_ptr<const InputRecording>& recording) :
+    m_recording(recording),
+    m_nextTickIndex(0),
+    m_buttonStates(0)
+{
+    // Nothing else to do.
+}
+        
+ReplayController::~ReplayController()
+{
+    // Nothing else to do.
+}
+
+void ReplayController::Update(const sf::Time& /*elapsedTime*/)
+{
+    // CHECK IF ANY RECORDED INPUT REMAINS.
+    bool recordingFinished = (m_nextTickIndex >= m_recording->GetTickCount());
+    if (recordingFinished)
+    {
+        m_buttonStates = 0;
+        return;
+    }
+
+    // MOVE TO THE NEXT RECORDED TICK.
+    m_buttonStates = m_recording->GetButtonStates(m_nextTickIndex);
+    ++m_nextTickIndex;
+}
+
+bool ReplayController::LeftButtonPressed() const
+{
+    bool leftButtonPressed = (0 != (m_buttonStates & INPUT_BUTTON_LEFT));
+    return leftButtonPressed;
+}
+
+bool ReplayController::RightButtonPressed() const
+{
+    bool rightButtonPressed = (0 != (m_buttonStates & INPUT_BUTTON_RIGHT));
+    return rightButtonPressed;
+}
+
+bool ReplayController::FireButtonPressed() const
+{
+    bool fireButtonPressed = (0 != (m_buttonStates & INPUT_BUTTON_FIRE));
+    return fireButtonPressed;
+}
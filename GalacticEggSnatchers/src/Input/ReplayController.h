@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include "Input/IInputController.h"
+#include "Input/InputRecording.h"
+
+namespace INPUT
+{
+    //////////////////////////////////////////////////////////////////
+    /// @brief  A controller supplying previously recorded input,
+    ///         one recorded tick per update.  Combined with the
+    ///         recording's random seed and tick rate, this reproduces
+    ///         the recorded session exactly, allowing identical
+    ///         workloads to be simulated across different builds.
+    ///         No buttons are pressed once the recording runs out.
+    //////////////////////////////////////////////////////////////////
+    class ReplayController : public IInputController
+    {
+    public:
+        /// @brief      Constructor.
+        /// @param[in]  recording - The recorded input to replay from the start.
+        explicit ReplayController(const std::shared_ptr<const InputRecording>& recording);
+        
+        /// @brief  Destructor.
+        virtual ~ReplayController();
+
+        /// @copydoc    IInputController::Update(const sf::Time& elapsedTime)
+        virtual void Update(const sf::Time& elapsedTime);
+
+        /// @copydoc    IInputController::LeftButtonPressed() const
+        virtual bool LeftButtonPressed() const;
+
+        /// @copydoc    IInputController::RightButtonPressed() const
+        virtual bool RightButtonPressed() const;
+
+        /// @copydoc    IInputController::FireButtonPressed() const
+        virtual bool FireButtonPressed() const;
+
+    private:
+        ReplayController(const ReplayController& controllerToCopy);    ///< Private to disallow copying.
+        ReplayController& operator=(const ReplayController& rhsController);   ///< Private to disallow copying.
+
+        std::shared_ptr<const InputRecording> m_recording;  ///< The recorded input being replayed.
+        unsigned int m_nextTickIndex;   ///< The index of the next recorded tick to replay.
+        uint8_t m_buttonStates; ///< The InputButton flags of all buttons pressed during the current tick.
+    };
+}
@@ -1,35 +1,27 @@
-#include <chrono>
-#include <random>
 #include "Objects/AlienFactory.h"
 
 using namespace OBJECTS;
 
 // INITIALIZE THE STATIC MEMBERS.
-const std::array<char*, AlienFactory::ALIEN_TEXTURE_COUNT> AlienFactory::ALIEN_TEXTURE_FILEPATHS =
+const std::array<RESOURCES::AssetId, AlienFactory::ALIEN_TEXTURE_COUNT> AlienFactory::ALIEN_TEXTURE_IDS =
 {
-    "res/Images/alien1.png",
-    "res/Images/alien2.png"
+    RESOURCES::ASSET_IMAGE_ALIEN_1,
+    RESOURCES::ASSET_IMAGE_ALIEN_2
 };
 
 // STATIC METHODS.
 
-std::string AlienFactory::GetRandomAlienTextureFilepath()
+RESOURCES::AssetId AlienFactory::GetRandomAlienTextureId(SIMULATION::RandomNumberGenerator& randomNumberGenerator)
 {
-    // MAKE SURE THAT THE RANDOM NUMBER GENERATOR HAS BEEN INITIALIZED.
-    static bool randomNumberGeneratorInitialized = false;
-    static std::default_random_engine randomNumberGenerator;
-    if (!randomNumberGeneratorInitialized)
-    {
-        // Initialize the random number generator with a seed based on the current time.
-        unsigned long seed = static_cast<unsigned long>(std::chrono::system_clock::now().time_since_epoch().count());
-        randomNumberGenerator.seed(seed);
-
-        randomNumberGeneratorInitialized = true;
-    }
-
     // SELECT A RANDOM ALIEN TEXTURE.
     // An random index is selected that is restricted to the valid range of indices
     // into the alien texture array.
-    unsigned int randomAlienTextureIndex = ( randomNumberGenerator() % ALIEN_TEXTURE_FILEPATHS.size() );
-    return ALIEN_TEXTURE_FILEPATHS[randomAlienTextureIndex];
+    unsigned int randomAlienTextureIndex = randomNumberGenerator.GenerateNumberLessThan(static_cast<unsigned int>(ALIEN_TEXTURE_IDS.size()));
+    return ALIEN_TEXTURE_IDS[randomAlienTextureIndex];
+}
+
+std::vector<RESOURCES::AssetId> AlienFactory::GetAllAlienTextureIds()
+{
+    std::vector<RESOURCES::AssetId> textureIds(ALIEN_TEXTURE_IDS.begin(), ALIEN_TEXTURE_IDS.end());
+    return textureIds;
 }
\ No newline at end of file
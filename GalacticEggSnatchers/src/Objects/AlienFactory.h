@@ -1,7 +1,9 @@
 #pragma once
 
 #include <array>
-#include <string>
+#include <vector>
+#include "Resources/AssetFilepaths.h"
+#include "Simulation/RandomNumberGenerator.h"
 
 namespace OBJECTS
 {
@@ -14,9 +16,14 @@ namespace OBJECTS
     {
     public:
 
-        /// @brief  Randomly selects an alien texture.
-        /// @return The filepath to the randomly selected alien texture.
-        static std::string GetRandomAlienTextureFilepath();
+        /// @brief          Randomly selects an alien texture.
+        /// @param[in,out]  randomNumberGenerator - The random number generator for the selection.
+        /// @return         The asset ID of the randomly selected alien texture.
+        static RESOURCES::AssetId GetRandomAlienTextureId(SIMULATION::RandomNumberGenerator& randomNumberGenerator);
+
+        /// @brief  Gets every alien texture that may be selected.
+        /// @return The asset IDs of all available alien textures.
+        static std::vector<RESOURCES::AssetId> GetAllAlienTextureIds();
 
     private:
         AlienFactory(); ///< Private constructor to prevent instantiation.
@@ -25,6 +32,6 @@ namespace OBJECTS
         AlienFactory& operator= (const AlienFactory& factoryToCopy);    ///< Private to disallow assignment.
 
         static const unsigned int ALIEN_TEXTURE_COUNT = 2;  ///< The number of available alien textures.
-        static const std::array<char*, ALIEN_TEXTURE_COUNT> ALIEN_TEXTURE_FILEPATHS; ///< The available alien texture filepaths.
+        static const std::array<RESOURCES::AssetId, ALIEN_TEXTURE_COUNT> ALIEN_TEXTURE_IDS; ///< The asset IDs of the available alien textures.
     };
 }
\ No newline at end of file
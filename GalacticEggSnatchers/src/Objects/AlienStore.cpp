@@ -0,0 +1,340 @@
+#include "Graphics/Interpolation.h"
+#include "Objects/AlienStore.h"
+
+using namespace OBJECTS;
+
+// STATIC CONSTANT INITIALIZATION.
+const float AlienStore::DEFAULT_MOVE_SPEED_IN_PIXELS_PER_SECOND = 64.0f;
+
+// INSTANCE METHODS.
+
+AlienStore::AlienStore() :
+    m_positions(),
+    m_previousPositions(),
+    m_velocities(),
+    m_sizes(),
+    m_boundingRectangles(),
+    m_brains(),
+    m_spriteIds(),
+    m_handles(),
+    m_sprites(),
+    m_handleTable()
+{
+    // Nothing else to do.
+}
+
+AlienStore::~AlienStore()
+{
+    // Nothing else to do.
+}
+
+void AlienStore::Reserve(const unsigned int alienCount)
+{
+    m_positions.reserve(alienCount);
+    m_previousPositions.reserve(alienCount);
+    m_velocities.reserve(alienCount);
+    m_sizes.reserve(alienCount);
+    m_boundingRectangles.Reserve(alienCount);
+    m_brains.reserve(alienCount);
+    m_spriteIds.reserve(alienCount);
+    m_handles.reserve(alienCount);
+    m_handleTable.Reserve(alienCount);
+}
+
+unsigned int AlienStore::GetSpriteId(const sf::Sprite& sprite)
+{
+    // CHECK IF THE APPEARANCE ALREADY EXISTS.
+    // Only a handful of distinct appearances are expected, so a linear search is sufficient.
+    for (unsigned int spriteId = 0; spriteId < m_sprites.size(); ++spriteId)
+    {
+        const sf::Sprite& existingSprite = m_sprites[spriteId];
+        bool sameTexture = (existingSprite.getTexture() == sprite.getTexture());
+        bool sameTextureRectangle = (existingSprite.getTextureRect() == sprite.getTextureRect());
+        if (sameTexture && sameTextureRectangle)
+        {
+            return spriteId;
+        }
+    }
+
+    // ADD THE NEW APPEARANCE.
+    unsigned int newSpriteId = static_cast<unsigned int>(m_sprites.size());
+    m_sprites.push_back(sprite);
+    return newSpriteId;
+}
+
+CONTAINERS::GenerationalHandle AlienStore::Add(
+    const sf::Vector2f& topLeftPosition,
+    const unsigned int spriteId,
+    const float moveSpeedInPixelsPerSecond,
+    const float minTimeBetweenMissileFiresInSeconds,
+    const float maxTimeBetweenMissileFiresInSeconds,
+    SIMULATION::RandomNumberGenerator& randomNumberGenerator)
+{
+    // ADD THE ALIEN'S ATTRIBUTES TO THE END OF EACH ARRAY.
+    unsigned int newIndex = GetCount();
+    m_positions.push_back(topLeftPosition);
+    m_previousPositions.push_back(topLeftPosition);
+    // The velocity is initialized so that the alien moves right initially.
+    m_velocities.push_back(sf::Vector2f(moveSpeedInPixelsPerSecond, 0.0f));
+
+    sf::FloatRect spriteBounds = m_sprites[spriteId].getGlobalBounds();
+    sf::Vector2f size(spriteBounds.width, spriteBounds.height);
+    m_sizes.push_back(size);
+    m_boundingRectangles.Add(sf::FloatRect(topLeftPosition, size));
+
+    m_brains.push_back(ARTIFICIAL_INTELLIGENCE::AlienAiBrain(
+        minTimeBetweenMissileFiresInSeconds,
+        maxTimeBetweenMissileFiresInSeconds,
+        randomNumberGenerator));
+    m_spriteIds.push_back(spriteId);
+
+    // CREATE THE STABLE HANDLE FOR THE ALIEN.
+    CONTAINERS::GenerationalHandle handle = m_handleTable.Allocate(newIndex);
+    m_handles.push_back(handle);
+    return handle;
+}
+
+void AlienStore::Remove(const CONTAINERS::GenerationalHandle& handle)
+{
+    // CHECK IF THE ALIEN STILL EXISTS.
+    bool alienExists = m_handleTable.Contains(handle);
+    if (!alienExists)
+    {
+        return;
+    }
+
+    unsigned int index = m_handleTable.GetDenseIndex(handle);
+    RemoveAt(index);
+}
+
+void AlienStore::RemoveAt(const unsigned int index)
+{
+    // FREE THE REMOVED ALIEN'S HANDLE.
+    m_handleTable.Free(m_handles[index]);
+
+    // MOVE THE LAST ALIEN INTO THE REMOVED ALIEN'S INDEX.
+    // This keeps all arrays densely packed without shifting every following alien.
+    unsigned int lastIndex = GetCount() - 1;
+    bool removingLastAlien = (lastIndex == index);
+    if (!removingLastAlien)
+    {
+        m_positions[index] = m_positions[lastIndex];
+        m_previousPositions[index] = m_previousPositions[lastIndex];
+        m_velocities[index] = m_velocities[lastIndex];
+        m_sizes[index] = m_sizes[lastIndex];
+        m_brains[index] = m_brains[lastIndex];
+        m_spriteIds[index] = m_spriteIds[lastIndex];
+        m_handles[index] = m_handles[lastIndex];
+
+        // Keep the moved alien's handle pointing at its new index.
+        m_handleTable.SetDenseIndex(m_handles[index], index);
+    }
+
+    // REMOVE THE NOW UNUSED LAST ELEMENT OF EACH ARRAY.
+    m_positions.pop_back();
+    m_previousPositions.pop_back();
+    m_velocities.pop_back();
+    m_sizes.pop_back();
+    m_boundingRectangles.RemoveAt(index);
+    m_brains.pop_back();
+    m_spriteIds.pop_back();
+    m_handles.pop_back();
+}
+
+void AlienStore::Clear()
+{
+    m_positions.clear();
+    m_previousPositions.clear();
+    m_velocities.clear();
+    m_sizes.clear();
+    m_boundingRectangles.Clear();
+    m_brains.clear();
+    m_spriteIds.clear();
+    m_handles.clear();
+    m_handleTable.Clear();
+}
+
+bool AlienStore::Contains(const CONTAINERS::GenerationalHandle& handle) const
+{
+    return m_handleTable.Contains(handle);
+}
+
+unsigned int AlienStore::GetIndex(const CONTAINERS::GenerationalHandle& handle) const
+{
+    return m_handleTable.GetDenseIndex(handle);
+}
+
+CONTAINERS::GenerationalHandle AlienStore::GetHandle(const unsigned int index) const
+{
+    return m_handles[index];
+}
+
+unsigned int AlienStore::GetCount() const
+{
+    return static_cast<unsigned int>(m_positions.size());
+}
+
+bool AlienStore::IsEmpty() const
+{
+    return m_positions.empty();
+}
+
+sf::FloatRect AlienStore::GetBoundingRectangle(const unsigned int index) const
+{
+    return m_boundingRectangles.GetRectangle(index);
+}
+
+const PHYSICS::COLLISIONS::PackedRectangles& AlienStore::GetBoundingRectangles() const
+{
+    return m_boundingRectangles;
+}
+
+void AlienStore::SavePreviousPositions()
+{
+    m_previousPositions = m_positions;
+}
+
+void AlienStore::Update(const sf::Time& elapsedTime)
+{
+    // MOVE ALL ALIENS BASED ON THEIR VELOCITIES.
+    float elapsedTimeInSeconds = elapsedTime.asSeconds();
+    unsigned int alienCount = GetCount();
+    for (unsigned int index = 0; index < alienCount; ++index)
+    {
+        m_positions[index] += elapsedTimeInSeconds * m_velocities[index];
+        UpdateBoundingRectangle(index);
+    }
+}
+
+sf::Time AlienStore::GetTimeUntilNextMissileFire(const unsigned int index, SIMULATION::RandomNumberGenerator& randomNumberGenerator) const
+{
+    return m_brains[index].GetTimeUntilNextMissileFire(randomNumberGenerator);
+}
+
+sf::Vector2f AlienStore::GetMissileLaunchPosition(const unsigned int index) const
+{
+    // Missiles are fired from the horizontal center of the bottom of the alien.
+    const sf::Vector2f& position = m_positions[index];
+    const sf::Vector2f& size = m_sizes[index];
+    sf::Vector2f launchPosition(position.x + (size.x / 2.0f), position.y + size.y);
+    return launchPosition;
+}
+
+void AlienStore::HandleBoundaryCollisions(
+    const PHYSICS::COLLISIONS::CollisionSystem& collisionSystem,
+    const sf::FloatRect& boundsInPixels)
+{
+    unsigned int alienCount = GetCount();
+    for (unsigned int index = 0; index < alienCount; ++index)
+    {
+        // The return value is intentionally ignored since the alien
+        // itself responds to any boundary collisions.
+        CollidableAlien alien(*this, index);
+        collisionSystem.HandleBoundaryCollisions(boundsInPixels, alien);
+    }
+}
+
+void AlienStore::Render(GRAPHICS::SpriteBatch& spriteBatch, const float interpolationRatio)
+{
+    unsigned int alienCount = GetCount();
+    for (unsigned int index = 0; index < alienCount; ++index)
+    {
+        // POSITION THE ALIEN'S SHARED SPRITE AT THE ALIEN.
+        sf::Sprite& sprite = m_sprites[m_spriteIds[index]];
+        const sf::Vector2f& currentPosition = m_positions[index];
+        sprite.setPosition(currentPosition);
+
+        // DRAW THE ALIEN BETWEEN ITS PREVIOUS AND CURRENT POSITIONS.
+        sf::RenderStates interpolatedRenderStates = GRAPHICS::GetInterpolatedRenderStates(
+            m_previousPositions[index],
+            currentPosition,
+            interpolationRatio);
+        spriteBatch.Add(sprite, interpolatedRenderStates);
+    }
+}
+
+void AlienStore::UpdateBoundingRectangle(const unsigned int index)
+{
+    // Aliens are positioned based on their top-left corner, and their size never changes.
+    m_boundingRectangles.SetPosition(index, m_positions[index], m_sizes[index]);
+}
+
+AlienStore::CollidableAlien::CollidableAlien(AlienStore& store, const unsigned int index) :
+    m_store(store),
+    m_index(index),
+    m_boundingRectangle(store.GetBoundingRectangle(index))
+{
+    // Nothing else to do.
+}
+
+AlienStore::CollidableAlien::~CollidableAlien()
+{
+    // Nothing else to do.
+}
+
+const sf::FloatRect& AlienStore::CollidableAlien::GetBoundingRectangle() const
+{
+    return m_boundingRectangle;
+}
+
+PHYSICS::COLLISIONS::CollisionLayer AlienStore::CollidableAlien::GetCollisionLayer() const
+{
+    return PHYSICS::COLLISIONS::COLLISION_LAYER_ALIEN;
+}
+
+void AlienStore::CollidableAlien::SetTopPosition(const float topPositionInPixels)
+{
+    // The alien is positioned based on its top-left corner, so we can
+    // change just its top position directly.
+    sf::Vector2f newPosition(m_store.m_positions[m_index].x, topPositionInPixels);
+    SetPosition(newPosition);
+}
+
+void AlienStore::CollidableAlien::SetBottomPosition(const float bottomPositionInPixels)
+{
+    // The alien is positioned based on its top-left corner, so we need
+    // to calculate a new top position for it.
+    float alienHeight = m_boundingRectangle.height;
+    sf::Vector2f newPosition(m_store.m_positions[m_index].x, bottomPositionInPixels - alienHeight);
+    SetPosition(newPosition);
+}
+
+void AlienStore::CollidableAlien::SetLeftPosition(const float leftPositionInPixels)
+{
+    // The alien is positioned based on its top-left corner, so we can
+    // change just its left position directly.
+    sf::Vector2f newPosition(leftPositionInPixels, m_store.m_positions[m_index].y);
+    SetPosition(newPosition);
+}
+
+void AlienStore::CollidableAlien::SetRightPosition(float rightPositionInPixels)
+{
+    // The alien is positioned based on its top-left corner, so we need
+    // to calculate a new left position for it.
+    float alienWidth = m_boundingRectangle.width;
+    sf::Vector2f newPosition(rightPositionInPixels - alienWidth, m_store.m_positions[m_index].y);
+    SetPosition(newPosition);
+}
+
+void AlienStore::CollidableAlien::OnWorldBoundaryCollide()
+{
+    // MOVE THE ALIEN CLOSER TO THE GROUND.
+    // The alien has reached either the left/right boundary, so move it further down
+    // so that it gets closer to the player/eggs/bottom of the screen.
+    const float ALIEN_VERTICAL_MOVEMENT_IN_PIXELS_PER_COLLISION = 8.0f;
+    sf::Vector2f newPosition = m_store.m_positions[m_index];
+    newPosition.y += ALIEN_VERTICAL_MOVEMENT_IN_PIXELS_PER_COLLISION;
+    SetPosition(newPosition);
+
+    // MAKE THE ALIEN MOVE IN THE OPPOSITE DIRECTION.
+    // We simply flip the velocity.
+    m_store.m_velocities[m_index] *= -1.0f;
+}
+
+void AlienStore::CollidableAlien::SetPosition(const sf::Vector2f& topLeftPosition)
+{
+    m_store.m_positions[m_index] = topLeftPosition;
+    m_store.UpdateBoundingRectangle(m_index);
+    m_boundingRectangle.left = topLeftPosition.x;
+    m_boundingRectangle.top = topLeftPosition.y;
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "ArtificialIntelligence/AlienAiBrain.h"
+#include "Containers/GenerationalHandle.h"
+#include "Containers/HandleTable.h"
+#include "Graphics/IBatchRenderable.h"
+#include "Physics/Collisions/PackedRectangles.h"
+#include "Physics/Collisions/CollisionSystem.h"
+#include "Physics/Collisions/ICollidable.h"
+#include "Simulation/RandomNumberGenerator.h"
+
+namespace OBJECTS
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Stores all enemy aliens.  Aliens fire down toward the
+    ///         player in an attempt to defeat the player
+    ///         and abduct Easter eggs.
+    ///
+    ///         Alien data is stored as a structure of arrays, with
+    ///         each attribute of every alien packed contiguously so
+    ///         that updating, colliding, and rendering all aliens
+    ///         walks linear memory.  Aliens are referred to either by
+    ///         their current index (valid until the next removal) or
+    ///         by a handle that remains stable across removals.
+    ///         Removal swaps the last alien into the removed alien's
+    ///         index, so the order of aliens is not preserved.
+    ////////////////////////////////////////////////////////
+    class AlienStore : public GRAPHICS::IBatchRenderable
+    {
+    public:
+        /// @brief  The default movement speed of an alien in pixels for second.
+        ///         The actual value has been determined based on experimentation to
+        ///         decide what feels right and what would help balance the gameplay.
+        static const float DEFAULT_MOVE_SPEED_IN_PIXELS_PER_SECOND;
+
+        /// @brief  Constructor.  Creates an empty store.
+        explicit AlienStore();
+
+        /// @brief  Destructor.
+        virtual ~AlienStore();
+
+        /// @brief      Reserves memory for the specified number of aliens.
+        /// @param[in]  alienCount - The number of aliens to reserve memory for.
+        void Reserve(const unsigned int alienCount);
+
+        /// @brief      Gets the identifier for the appearance of an alien, adding the appearance
+        ///             to the store if no alien has used it before.  Appearances are shared
+        ///             by all aliens with the same texture and texture rectangle.
+        /// @param[in]  sprite - The sprite defining the appearance.  Its position is ignored.
+        /// @return     The identifier of the sprite's appearance.
+        unsigned int GetSpriteId(const sf::Sprite& sprite);
+
+        /// @brief          Adds a new alien.
+        ///
+        ///                 The provided missile time ranges can help be used to tune the difficulty
+        ///                 of the artificial intelligence.  However, they are not strictly
+        ///                 guaranteed to be absolute minimums and maximums - randomness
+        ///                 is involved, so an alien may fire more or less often than
+        ///                 the time range provided.
+        ///
+        /// @param[in]      topLeftPosition - The initial top-left position of the alien (in pixels).
+        /// @param[in]      spriteId - The identifier of the alien's appearance from GetSpriteId().
+        /// @param[in]      moveSpeedInPixelsPerSecond - The horizontal movement speed of
+        ///                 the alien in pixels per second.
+        /// @param[in]      minTimeBetweenMissileFiresInSeconds - The miminum possible time
+        ///                 between the alien deciding that it wants to fire a missile.
+        /// @param[in]      maxTimeBetweenMissileFiresInSeconds - The maximum possible time
+        ///                 between the alien deciding that it wants to fire a missile.
+        /// @param[in,out]  randomNumberGenerator - The random number generator for the alien's decisions.
+        /// @return         The stable handle for the new alien.
+        CONTAINERS::GenerationalHandle Add(
+            const sf::Vector2f& topLeftPosition,
+            const unsigned int spriteId,
+            const float moveSpeedInPixelsPerSecond,
+            const float minTimeBetweenMissileFiresInSeconds,
+            const float maxTimeBetweenMissileFiresInSeconds,
+            SIMULATION::RandomNumberGenerator& randomNumberGenerator);
+
+        /// @brief      Removes an alien.  Does nothing if the handle no longer refers to an alien.
+        /// @param[in]  handle - The handle of the alien to remove.
+        void Remove(const CONTAINERS::GenerationalHandle& handle);
+
+        /// @brief      Removes the alien at the specified index.  The last alien is moved
+        ///             into the index, so iteration that removes aliens should re-examine
+        ///             the same index rather than advancing.
+        /// @param[in]  index - The index of the alien to remove.  Must be less than GetCount().
+        void RemoveAt(const unsigned int index);
+
+        /// @brief  Removes all aliens.  Handles to removed aliens become stale.
+        void Clear();
+
+        /// @brief      Checks if a handle still refers to an alien.
+        /// @param[in]  handle - The handle to check.
+        /// @return     True if the alien exists; false if it was removed.
+        bool Contains(const CONTAINERS::GenerationalHandle& handle) const;
+
+        /// @brief      Gets the current index of an alien.
+        /// @param[in]  handle - The handle of the alien.  Must refer to an existing alien.
+        /// @return     The index of the alien.
+        unsigned int GetIndex(const CONTAINERS::GenerationalHandle& handle) const;
+
+        /// @brief      Gets the stable handle of an alien.
+        /// @param[in]  index - The index of the alien.  Must be less than GetCount().
+        /// @return     The handle of the alien.
+        CONTAINERS::GenerationalHandle GetHandle(const unsigned int index) const;
+
+        /// @brief  Gets the number of aliens.
+        /// @return The number of aliens in the store.
+        unsigned int GetCount() const;
+
+        /// @brief  Checks if the store has no aliens.
+        /// @return True if no aliens exist; false otherwise.
+        bool IsEmpty() const;
+
+        /// @brief      Gets the bounding rectangle of an alien, in screen coordinates.
+        /// @param[in]  index - The index of the alien.  Must be less than GetCount().
+        /// @return     The bounding rectangle of the alien on the screen (in pixels).
+        sf::FloatRect GetBoundingRectangle(const unsigned int index) const;
+
+        /// @brief  Gets the bounding rectangles of all aliens, packed for testing many at once.
+        /// @return The bounding rectangles of all aliens, in the same order as alien indices.
+        const PHYSICS::COLLISIONS::PackedRectangles& GetBoundingRectangles() const;
+
+        /// @brief  Saves the current positions of all aliens as their positions before the next
+        ///         simulation update, allowing rendering to interpolate between the two.
+        void SavePreviousPositions();
+
+        /// @brief      Updates all aliens for a single update frame, moving them.
+        /// @param[in]  elapsedTime - The elapsed time since the last frame of updating.
+        void Update(const sf::Time& elapsedTime);
+
+        /// @brief          Decides how long an alien waits before firing its next missile,
+        ///                 starting from when it was added or last fired.
+        /// @param[in]      index - The index of the alien.  Must be less than GetCount().
+        /// @param[in,out]  randomNumberGenerator - The random number generator for the alien's decisions.
+        /// @return         The simulation time until the alien wants to fire a missile.
+        sf::Time GetTimeUntilNextMissileFire(const unsigned int index, SIMULATION::RandomNumberGenerator& randomNumberGenerator) const;
+
+        /// @brief      Gets the position that an alien fires missiles from.
+        /// @param[in]  index - The index of the alien.  Must be less than GetCount().
+        /// @return     The horizontal center of the bottom of the alien (in pixels).
+        sf::Vector2f GetMissileLaunchPosition(const unsigned int index) const;
+
+        /// @brief          Handles collisions of all aliens with screen boundaries.  An alien that
+        ///                 hits the left or right boundary moves closer to the ground and then
+        ///                 reverses its horizontal direction.
+        /// @param[in]      collisionSystem - The collision system for confining aliens.
+        /// @param[in]      boundsInPixels - The boundaries for which to confine aliens.
+        void HandleBoundaryCollisions(
+            const PHYSICS::COLLISIONS::CollisionSystem& collisionSystem,
+            const sf::FloatRect& boundsInPixels);
+
+        /// @copydoc    IBatchRenderable::Render(SpriteBatch& spriteBatch, const float interpolationRatio)
+        virtual void Render(GRAPHICS::SpriteBatch& spriteBatch, const float interpolationRatio);
+
+    private:
+        AlienStore(const AlienStore& storeToCopy);  ///< Private to disallow copying.
+        AlienStore& operator= (const AlienStore& rhsStore); ///< Private to disallow assignment.
+
+        /// @brief      Moves an alien's cached bounding rectangle to its current position.
+        ///             Must be called whenever an alien's position changes.
+        /// @param[in]  index - The index of the alien.
+        void UpdateBoundingRectangle(const unsigned int index);
+
+        ////////////////////////////////////////////////////////
+        /// @brief  Exposes a single stored alien as a collidable object
+        ///         so that the general collision system can confine it.
+        ////////////////////////////////////////////////////////
+        class CollidableAlien : public PHYSICS::COLLISIONS::ICollidable
+        {
+        public:
+            /// @brief      Constructor.
+            /// @param[in]  store - The store containing the alien.
+            /// @param[in]  index - The index of the alien in the store.
+            explicit CollidableAlien(AlienStore& store, const unsigned int index);
+
+            /// @brief  Destructor.
+            virtual ~CollidableAlien();
+
+            /// @copydoc    ICollidable::GetBoundingRectangle() const
+            virtual const sf::FloatRect& GetBoundingRectangle() const;
+
+            /// @copydoc    ICollidable::GetCollisionLayer() const
+            virtual PHYSICS::COLLISIONS::CollisionLayer GetCollisionLayer() const;
+
+            /// @copydoc    ICollidable::SetTopPosition(const float topPositionInPixels)
+            virtual void SetTopPosition(const float topPositionInPixels);
+
+            /// @copydoc    ICollidable::SetBottomPosition(const float bottomPositionInPixels)
+            virtual void SetBottomPosition(const float bottomPositionInPixels);
+
+            /// @copydoc    ICollidable::SetLeftPosition(const float leftPositionInPixels)
+            virtual void SetLeftPosition(const float leftPositionInPixels);
+
+            /// @copydoc    ICollidable::SetRightPosition(const float rightPositionInPixels)
+            virtual void SetRightPosition(float rightPositionInPixels);
+
+            /// @copydoc    ICollidable::OnWorldBoundaryCollide()
+            virtual void OnWorldBoundaryCollide();
+
+        private:
+            CollidableAlien(const CollidableAlien& alienToCopy);    ///< Private to disallow copying.
+            CollidableAlien& operator= (const CollidableAlien& rhsAlien);   ///< Private to disallow assignment.
+
+            /// @brief      Moves the alien, keeping the store's bounding rectangles in sync.
+            /// @param[in]  topLeftPosition - The new top-left position of the alien.
+            void SetPosition(const sf::Vector2f& topLeftPosition);
+
+            AlienStore& m_store;    ///< The store containing the alien.
+            unsigned int m_index;   ///< The index of the alien in the store.
+            sf::FloatRect m_boundingRectangle;  ///< The alien's bounding rectangle, copied out of the store's packed rectangles.
+        };
+
+        // ALIEN ATTRIBUTES.
+        // Each vector has one element per alien, all at the same index.
+        std::vector<sf::Vector2f> m_positions;  ///< The top-left position of each alien.
+        std::vector<sf::Vector2f> m_previousPositions;  ///< The position of each alien before the latest simulation update.
+        std::vector<sf::Vector2f> m_velocities; ///< The current velocity of each alien.
+        std::vector<sf::Vector2f> m_sizes;  ///< The width and height of each alien.
+        PHYSICS::COLLISIONS::PackedRectangles m_boundingRectangles; ///< The cached bounding rectangle of each alien, kept in sync with its position.
+        std::vector<ARTIFICIAL_INTELLIGENCE::AlienAiBrain> m_brains;    ///< The AI brain (including missile firing delay) of each alien.
+        std::vector<unsigned int> m_spriteIds;  ///< The identifier of each alien's appearance.
+        std::vector<CONTAINERS::GenerationalHandle> m_handles;  ///< The stable handle of each alien.
+
+        // SHARED DATA.
+        std::vector<sf::Sprite> m_sprites;  ///< The distinct alien appearances, indexed by sprite identifier.
+        CONTAINERS::HandleTable m_handleTable;  ///< Maps stable handles to alien indices.
+    };
+}
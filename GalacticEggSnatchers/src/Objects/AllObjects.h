@@ -3,8 +3,9 @@
 // A header file to quickly include all types of game objects.
 
 #include "Objects/IGameObject.h"
-#include "Objects/Alien.h"
+#include "Objects/AlienStore.h"
 #include "Objects/EasterBunny.h"
 #include "Objects/EasterEgg.h"
 #include "Objects/Explosion.h"
-#include "Objects/Weapons/Missile.h"
\ No newline at end of file
+#include "Objects/Weapons/Missile.h"
+#include "Objects/Weapons/MissilePool.h"
\ No newline at end of file
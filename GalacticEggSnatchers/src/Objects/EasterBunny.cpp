@@ -1,3 +1,4 @@
+#include "Graphics/Interpolation.h"
 #include "Objects/EasterBunny.h"
 
 using namespace OBJECTS;
@@ -10,6 +11,8 @@ const float EasterBunny::MOVE_SPEED_IN_PIXELS_PER_SECOND = 128.0f;
 
 EasterBunny::EasterBunny(const std::shared_ptr<sf::Sprite>& sprite) :
     m_sprite(sprite),
+    m_boundingRectangle(sprite->getGlobalBounds()),
+    m_previousPosition(sprite->getPosition()),
     m_lives(DEFAULT_LIVES_COUNT)
 {
     // Nothing else to do.
@@ -44,12 +47,17 @@ void EasterBunny::Update(const sf::Time& elapsedTime)
     // Nothing else to do yet.
 }
 
-sf::FloatRect EasterBunny::GetBoundingRectangle() const
+const sf::FloatRect& EasterBunny::GetBoundingRectangle() const
 {
-    return m_sprite->getGlobalBounds();
+    return m_boundingRectangle;
 }
 
 
+PHYSICS::COLLISIONS::CollisionLayer EasterBunny::GetCollisionLayer() const
+{
+    return PHYSICS::COLLISIONS::COLLISION_LAYER_BUNNY;
+}
+
 void EasterBunny::SetTopPosition(const float topPositionInPixels)
 {
     // Preserve the same horizontal position.
@@ -58,6 +66,7 @@ void EasterBunny::SetTopPosition(const float topPositionInPixels)
     // The bunny is positioned based on its top-left corner, so we can
     // change just its top position directly.
     m_sprite->setPosition(currentXPosition, topPositionInPixels);
+    UpdateBoundingRectangle();
 }
 
 void EasterBunny::SetBottomPosition(const float bottomPositionInPixels)
@@ -67,9 +76,10 @@ void EasterBunny::SetBottomPosition(const float bottomPositionInPixels)
     
     // The bunny is positioned based on its top-left corner, so we need
     // to calculate a new top position for it.
-    sf::FloatRect boundingRectangle = GetBoundingRectangle();
+    const sf::FloatRect& boundingRectangle = GetBoundingRectangle();
     float newTopPosition = bottomPositionInPixels - boundingRectangle.height;
     m_sprite->setPosition(currentXPosition, newTopPosition);
+    UpdateBoundingRectangle();
 }
 
 void EasterBunny::SetLeftPosition(const float leftPositionInPixels)
@@ -80,6 +90,7 @@ void EasterBunny::SetLeftPosition(const float leftPositionInPixels)
     // The bunny is positioned based on its top-left corner, so we can
     // change just its left position directly.
     m_sprite->setPosition(leftPositionInPixels, currentYPosition);
+    UpdateBoundingRectangle();
 }
 
 void EasterBunny::SetRightPosition(float rightPositionInPixels)
@@ -89,9 +100,10 @@ void EasterBunny::SetRightPosition(float rightPositionInPixels)
 
     // The bunny is positioned based on its top-left corner, so we need
     // to calculate a new left position for it.
-    sf::FloatRect boundingRectangle = GetBoundingRectangle();
+    const sf::FloatRect& boundingRectangle = GetBoundingRectangle();
     float newLeftPosition = rightPositionInPixels - boundingRectangle.width;
     m_sprite->setPosition(newLeftPosition, currentYPosition);
+    UpdateBoundingRectangle();
 }
 
 void EasterBunny::OnWorldBoundaryCollide()
@@ -102,9 +114,19 @@ void EasterBunny::OnWorldBoundaryCollide()
     // to the bunny when it collides with a screen boundary.
 }
 
-void EasterBunny::Render(sf::RenderTarget& renderTarget)
+void EasterBunny::SavePreviousPosition()
 {
-    renderTarget.draw(*m_sprite);
+    m_previousPosition = m_sprite->getPosition();
+}
+
+void EasterBunny::Render(GRAPHICS::SpriteBatch& spriteBatch, const float interpolationRatio)
+{
+    // DRAW THE BUNNY BETWEEN ITS PREVIOUS AND CURRENT POSITIONS.
+    sf::RenderStates interpolatedRenderStates = GRAPHICS::GetInterpolatedRenderStates(
+        m_previousPosition,
+        m_sprite->getPosition(),
+        interpolationRatio);
+    spriteBatch.Add(*m_sprite, interpolatedRenderStates);
 }
 
 void EasterBunny::MoveLeft(const sf::Time& elapsedTime)
@@ -113,6 +135,7 @@ void EasterBunny::MoveLeft(const sf::Time& elapsedTime)
     float leftMovementInPixels = -1.0f * MOVE_SPEED_IN_PIXELS_PER_SECOND * elapsedTime.asSeconds();
 
     m_sprite->move(leftMovementInPixels, NO_VERTICAL_MOVEMENT);
+    UpdateBoundingRectangle();
 }
 
 void EasterBunny::MoveRight(const sf::Time& elapsedTime)
@@ -121,29 +144,28 @@ void EasterBunny::MoveRight(const sf::Time& elapsedTime)
     float rightMovementInPixels = MOVE_SPEED_IN_PIXELS_PER_SECOND * elapsedTime.asSeconds();
 
     m_sprite->move(rightMovementInPixels, NO_VERTICAL_MOVEMENT);
+    UpdateBoundingRectangle();
 }
 
-std::shared_ptr<OBJECTS::WEAPONS::Missile> EasterBunny::FireMissile(
-    const std::shared_ptr<sf::Sprite>& missileSprite,
-    const std::shared_ptr<sf::Sound>& missileSound)
+OBJECTS::WEAPONS::Missile EasterBunny::FireMissile(const sf::Sprite& missileSprite) const
 {
     // POSITION THE MISSILE SPRITE SO THAT IT FIRES FROM THE BUNNY.
     const sf::Vector2f& bunnyPosition = m_sprite->getPosition();
     float bunnyXPosition = bunnyPosition.x;
-    float missileHeight = missileSprite->getGlobalBounds().height;
+    float missileHeight = missileSprite.getGlobalBounds().height;
     float yPositionAboveBunny = (bunnyPosition.y - missileHeight);
-    missileSprite->setPosition(bunnyXPosition, yPositionAboveBunny);
+    sf::Sprite positionedMissileSprite(missileSprite);
+    positionedMissileSprite.setPosition(bunnyXPosition, yPositionAboveBunny);
 
     // FIRE THE MISSILE UPWARD FROM THE BUNNY.
     const float NO_HORIZONTAL_MOVEMENT = 0.0f;
     const float MISSILE_Y_VELOCITY_IN_PIXELS_PER_SECOND = -192.0f;
     sf::Vector2f missileVelocity(NO_HORIZONTAL_MOVEMENT, MISSILE_Y_VELOCITY_IN_PIXELS_PER_SECOND);
     
-    std::shared_ptr<OBJECTS::WEAPONS::Missile> bunnyMissile = std::make_shared<OBJECTS::WEAPONS::Missile>(
+    OBJECTS::WEAPONS::Missile bunnyMissile(
         OBJECTS::WEAPONS::MISSILE_SOURCE_EASTER_BUNNY,
         missileVelocity,
-        missileSprite,
-        missileSound);
+        positionedMissileSprite);
 
     return bunnyMissile;
 }
@@ -166,5 +188,15 @@ void EasterBunny::LoseLife()
 void EasterBunny::Copy(const EasterBunny& bunnyToCopy)
 {
     this->m_sprite = bunnyToCopy.m_sprite;
+    this->m_boundingRectangle = bunnyToCopy.m_boundingRectangle;
+    this->m_previousPosition = bunnyToCopy.m_previousPosition;
     this->m_lives = bunnyToCopy.m_lives;
 }
+
+void EasterBunny::UpdateBoundingRectangle()
+{
+    // The bunny is positioned based on its top-left corner, and its size never changes.
+    const sf::Vector2f& position = m_sprite->getPosition();
+    m_boundingRectangle.left = position.x;
+    m_boundingRectangle.top = position.y;
+}
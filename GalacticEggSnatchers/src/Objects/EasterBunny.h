@@ -4,7 +4,7 @@
 #include <memory>
 #include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
-#include "Graphics/IRenderable.h"
+#include "Graphics/IBatchRenderable.h"
 #include "Objects/IGameObject.h"
 #include "Objects/Weapons/Missile.h"
 #include "Physics/Collisions/ICollidable.h"
@@ -17,7 +17,7 @@ namespace OBJECTS
     ///
     /// @todo   Remove the copy constructor and assignment operator if they aren't needed.
     ////////////////////////////////////////////////////////
-    class EasterBunny : public IGameObject, public PHYSICS::COLLISIONS::ICollidable, public GRAPHICS::IRenderable
+    class EasterBunny : public IGameObject, public PHYSICS::COLLISIONS::ICollidable, public GRAPHICS::IBatchRenderable
     {
     public:
         static const uint8_t DEFAULT_LIVES_COUNT;   ///< The default number of lives for a bunny.
@@ -48,7 +48,10 @@ namespace OBJECTS
         virtual void Update(const sf::Time& elapsedTime);
 
         /// @copydoc    ICollidable::GetBoundingRectangle() const
-        virtual sf::FloatRect GetBoundingRectangle() const;
+        virtual const sf::FloatRect& GetBoundingRectangle() const;
+
+        /// @copydoc    ICollidable::GetCollisionLayer() const
+        virtual PHYSICS::COLLISIONS::CollisionLayer GetCollisionLayer() const;
 
         /// @copydoc    ICollidable::SetTopPosition(const float topPositionInPixels)
         virtual void SetTopPosition(const float topPositionInPixels);
@@ -66,8 +69,12 @@ namespace OBJECTS
         /// @brief      Does nothing for the bunny.
         virtual void OnWorldBoundaryCollide();
 
-        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget)
-        virtual void Render(sf::RenderTarget& renderTarget);
+        /// @brief  Saves the current position of the bunny as its position before the next
+        ///         simulation update, allowing rendering to interpolate between the two.
+        void SavePreviousPosition();
+
+        /// @copydoc    IBatchRenderable::Render(SpriteBatch& spriteBatch, const float interpolationRatio)
+        virtual void Render(GRAPHICS::SpriteBatch& spriteBatch, const float interpolationRatio);
 
         /// @brief      Moves the bunny left based on the amount of elapsed time.
         /// @param[in]  elapsedTime - The amount of time to move the bunny, intended
@@ -79,16 +86,13 @@ namespace OBJECTS
         ///             to be the elapsed time since the last update frame.
         void MoveRight(const sf::Time& elapsedTime);
 
-        /// @brief  Has the bunny fire a missile.
-        /// @param  missileSprite - The sprite to use for the missile.
-        ///         It's position does not already need to be set - it will
-        ///         be properly set within this method to make the missile appear
-        ///         to fire from the bunny.
-        /// @param  missileSound - The sound to play for firing the missile.
-        /// @return The newly fired missile from the bunny.
-        std::shared_ptr<OBJECTS::WEAPONS::Missile> FireMissile(
-            const std::shared_ptr<sf::Sprite>& missileSprite,
-            const std::shared_ptr<sf::Sound>& missileSound);
+        /// @brief      Has the bunny fire a missile.
+        /// @param[in]  missileSprite - The sprite to copy for the missile.
+        ///             It's position does not already need to be set - it will
+        ///             be properly set within this method to make the missile appear
+        ///             to fire from the bunny.
+        /// @return     The newly fired missile from the bunny.
+        OBJECTS::WEAPONS::Missile FireMissile(const sf::Sprite& missileSprite) const;
 
         /// @brief  Gets the number of lives the bunny has.
         /// @return The bunny's number of lives.
@@ -102,7 +106,13 @@ namespace OBJECTS
         /// @param[in]  bunnyToCopy - The bunny to copy.
         void Copy(const EasterBunny& bunnyToCopy);
 
+        /// @brief  Moves the cached bounding rectangle to the bunny's current position.
+        ///         Must be called whenever the bunny's sprite is moved.
+        void UpdateBoundingRectangle();
+
         std::shared_ptr<sf::Sprite> m_sprite;   ///< The bunny's graphical sprite.
+        sf::FloatRect m_boundingRectangle;  ///< The cached bounding rectangle of the bunny, in screen coordinates.
+        sf::Vector2f m_previousPosition;    ///< The position of the bunny before the latest simulation update.
         uint8_t m_lives;    ///< The number of lives of the bunny.
     };
 }
\ No newline at end of file
@@ -9,6 +9,7 @@ const uint8_t EasterEgg::DEFAULT_HEALTH = 4;
 
 EasterEgg::EasterEgg(const std::shared_ptr<sf::Sprite>& sprite) :
     m_sprite(sprite),
+    m_boundingRectangle(sprite->getGlobalBounds()),
     m_health(DEFAULT_HEALTH)
 {
     // Nothing else to do.
@@ -50,17 +51,22 @@ void EasterEgg::Update(const sf::Time& elapsedTime)
     m_sprite->setColor(fadedColor);
 }
 
-void EasterEgg::Render(sf::RenderTarget& renderTarget)
+void EasterEgg::Render(GRAPHICS::SpriteBatch& spriteBatch, const float interpolationRatio)
 {
-    renderTarget.draw(*m_sprite);
+    spriteBatch.Add(*m_sprite);
 }
 
-sf::FloatRect EasterEgg::GetBoundingRectangle() const
+const sf::FloatRect& EasterEgg::GetBoundingRectangle() const
 {
-    return m_sprite->getGlobalBounds();
+    return m_boundingRectangle;
 }
 
 
+PHYSICS::COLLISIONS::CollisionLayer EasterEgg::GetCollisionLayer() const
+{
+    return PHYSICS::COLLISIONS::COLLISION_LAYER_EGG;
+}
+
 void EasterEgg::SetTopPosition(const float topPositionInPixels)
 {
     // Preserve the same horizontal position.
@@ -69,6 +75,7 @@ void EasterEgg::SetTopPosition(const float topPositionInPixels)
     // The egg is positioned based on its top-left corner, so we can
     // change just its top position directly.
     m_sprite->setPosition(currentXPosition, topPositionInPixels);
+    UpdateBoundingRectangle();
 }
 
 void EasterEgg::SetBottomPosition(const float bottomPositionInPixels)
@@ -78,9 +85,10 @@ void EasterEgg::SetBottomPosition(const float bottomPositionInPixels)
     
     // The egg is positioned based on its top-left corner, so we need
     // to calculate a new top position for it.
-    sf::FloatRect boundingRectangle = GetBoundingRectangle();
+    const sf::FloatRect& boundingRectangle = GetBoundingRectangle();
     float newTopPosition = bottomPositionInPixels - boundingRectangle.height;
     m_sprite->setPosition(currentXPosition, newTopPosition);
+    UpdateBoundingRectangle();
 }
 
 void EasterEgg::SetLeftPosition(const float leftPositionInPixels)
@@ -91,6 +99,7 @@ void EasterEgg::SetLeftPosition(const float leftPositionInPixels)
     // The egg is positioned based on its top-left corner, so we can
     // change just its left position directly.
     m_sprite->setPosition(leftPositionInPixels, currentYPosition);
+    UpdateBoundingRectangle();
 }
 
 void EasterEgg::SetRightPosition(float rightPositionInPixels)
@@ -100,9 +109,10 @@ void EasterEgg::SetRightPosition(float rightPositionInPixels)
 
     // The egg is positioned based on its top-left corner, so we need
     // to calculate a new left position for it.
-    sf::FloatRect boundingRectangle = GetBoundingRectangle();
+    const sf::FloatRect& boundingRectangle = GetBoundingRectangle();
     float newLeftPosition = rightPositionInPixels - boundingRectangle.width;
     m_sprite->setPosition(newLeftPosition, currentYPosition);
+    UpdateBoundingRectangle();
 }
 
 void EasterEgg::OnWorldBoundaryCollide()
@@ -131,4 +141,13 @@ void EasterEgg::Copy(const EasterEgg& eggToCopy)
 {
     this->m_health = eggToCopy.m_health;
     this->m_sprite = eggToCopy.m_sprite;
+    this->m_boundingRectangle = eggToCopy.m_boundingRectangle;
+}
+
+void EasterEgg::UpdateBoundingRectangle()
+{
+    // The egg is positioned based on its top-left corner, and its size never changes.
+    const sf::Vector2f& position = m_sprite->getPosition();
+    m_boundingRectangle.left = position.x;
+    m_boundingRectangle.top = position.y;
 }
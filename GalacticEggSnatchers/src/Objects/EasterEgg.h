@@ -3,7 +3,7 @@
 #include <cstdint>
 #include <memory>
 #include <SFML/Graphics.hpp>
-#include "Graphics/IRenderable.h"
+#include "Graphics/IBatchRenderable.h"
 #include "Objects/IGameObject.h"
 #include "Physics/Collisions/ICollidable.h"
 
@@ -15,7 +15,7 @@ namespace OBJECTS
     ///
     /// @todo   Remove the copy constructor and assignment operator if they aren't needed.
     ////////////////////////////////////////////////////////
-    class EasterEgg : public IGameObject, public GRAPHICS::IRenderable, public PHYSICS::COLLISIONS::ICollidable
+    class EasterEgg : public IGameObject, public GRAPHICS::IBatchRenderable, public PHYSICS::COLLISIONS::ICollidable
     {
     public:
         static const uint8_t DEFAULT_HEALTH;   ///< The default amount of health for an egg.
@@ -40,11 +40,14 @@ namespace OBJECTS
         /// @copydoc    IGameObject::Update(const sf::Time& elapsedTime)
         virtual void Update(const sf::Time& elapsedTime);
 
-        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget)
-        virtual void Render(sf::RenderTarget& renderTarget);
+        /// @copydoc    IBatchRenderable::Render(SpriteBatch& spriteBatch, const float interpolationRatio)
+        virtual void Render(GRAPHICS::SpriteBatch& spriteBatch, const float interpolationRatio);
 
         /// @copydoc    ICollidable::GetBoundingRectangle() const
-        virtual sf::FloatRect GetBoundingRectangle() const;
+        virtual const sf::FloatRect& GetBoundingRectangle() const;
+
+        /// @copydoc    ICollidable::GetCollisionLayer() const
+        virtual PHYSICS::COLLISIONS::CollisionLayer GetCollisionLayer() const;
 
         /// @copydoc    ICollidable::SetTopPosition(const float topPositionInPixels)
         virtual void SetTopPosition(const float topPositionInPixels);
@@ -74,7 +77,12 @@ namespace OBJECTS
         /// @param[in]  eggToCopy - The egg to copy.
         void Copy(const EasterEgg& eggToCopy);
 
+        /// @brief  Moves the cached bounding rectangle to the egg's current position.
+        ///         Must be called whenever the egg's sprite is moved.
+        void UpdateBoundingRectangle();
+
         uint8_t m_health;  ///< The current health of the egg.
         std::shared_ptr<sf::Sprite> m_sprite;   ///< The egg's graphical sprite.
+        sf::FloatRect m_boundingRectangle;  ///< The cached bounding rectangle of the egg, in screen coordinates.
     };
 }
\ No newline at end of file
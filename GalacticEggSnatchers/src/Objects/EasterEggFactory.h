@@ -1,7 +1,9 @@
 #pragma once
 
 #include <array>
-#include <string>
+#include <vector>
+#include "Resources/AssetFilepaths.h"
+#include "Simulation/RandomNumberGenerator.h"
 
 namespace OBJECTS
 {
@@ -14,9 +16,14 @@ namespace OBJECTS
     {
     public:
 
-        /// @brief  Randomly selects an Easter egg texture.
-        /// @return The filepath to the randomly selected egg texture.
-        static std::string GetRandomEggTextureFilepath();
+        /// @brief          Randomly selects an Easter egg texture.
+        /// @param[in,out]  randomNumberGenerator - The random number generator for the selection.
+        /// @return         The asset ID of the randomly selected egg texture.
+        static RESOURCES::AssetId GetRandomEggTextureId(SIMULATION::RandomNumberGenerator& randomNumberGenerator);
+
+        /// @brief  Gets every egg texture that may be selected.
+        /// @return The asset IDs of all available egg textures.
+        static std::vector<RESOURCES::AssetId> GetAllEggTextureIds();
 
     private:
         EasterEggFactory(); ///< Private constructor to prevent instantiation.
@@ -25,6 +32,6 @@ namespace OBJECTS
         EasterEggFactory& operator= (const EasterEggFactory& factoryToCopy);    ///< Private to disallow assignment.
 
         static const unsigned int EGG_TEXTURE_COUNT = 5;  ///< The number of available egg textures.
-        static const std::array<char*, EGG_TEXTURE_COUNT> EGG_TEXTURE_FILEPATHS; ///< The available egg texture filepaths.
+        static const std::array<RESOURCES::AssetId, EGG_TEXTURE_COUNT> EGG_TEXTURE_IDS; ///< The asset IDs of the available egg textures.
     };
 }
\ No newline at end of file
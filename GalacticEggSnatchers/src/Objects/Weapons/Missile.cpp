@@ -1,22 +1,37 @@
+#include "Graphics/Interpolation.h"
 #include "Objects/Weapons/Missile.h"
 
 using namespace OBJECTS::WEAPONS;
 
+Missile::Missile() :
+    m_source(MISSILE_SOURCE_INVALID),
+    m_velocity(),
+    m_sprite(),
+    m_boundingRectangle(),
+    m_previousPosition()
+{
+    // Nothing else to do.
+}
+
 Missile::Missile(
     const MissileSource source,
     const sf::Vector2f& velocity,
-    const std::shared_ptr<sf::Sprite>& sprite,
-    const std::shared_ptr<sf::Sound>& sound) :
+    const sf::Sprite& sprite) :
     m_source(source),
     m_velocity(velocity),
     m_sprite(sprite),
-    m_sound(sound)
+    m_boundingRectangle(sprite.getGlobalBounds()),
+    m_previousPosition(sprite.getPosition())
 {
-    // Play the missile sound.
-    m_sound->play();
+    // Nothing else to do.
 }
 
-Missile::Missile(const Missile& missileToCopy)
+Missile::Missile(const Missile& missileToCopy) :
+    m_source(),
+    m_velocity(),
+    m_sprite(),
+    m_boundingRectangle(),
+    m_previousPosition()
 {
     Copy(missileToCopy);
 }
@@ -44,57 +59,75 @@ void Missile::Update(const sf::Time& elapsedTime)
 {
     // MOVE THE MISSILE BASED ON ITS VELOCITY.
     sf::Vector2f movementForThisFrame = elapsedTime.asSeconds() * m_velocity;
-    m_sprite->move(movementForThisFrame);
+    m_sprite.move(movementForThisFrame);
+    UpdateBoundingRectangle();
 }
 
-sf::FloatRect Missile::GetBoundingRectangle() const
+const sf::FloatRect& Missile::GetBoundingRectangle() const
 {
-    return m_sprite->getGlobalBounds();
+    return m_boundingRectangle;
 }
 
+PHYSICS::COLLISIONS::CollisionLayer Missile::GetCollisionLayer() const
+{
+    // MISSILES ONLY COLLIDE WITH OPPONENTS OF WHATEVER FIRED THEM.
+    bool missileFromBunny = (MISSILE_SOURCE_EASTER_BUNNY == m_source);
+    if (missileFromBunny)
+    {
+        return PHYSICS::COLLISIONS::COLLISION_LAYER_BUNNY_MISSILE;
+    }
+    else
+    {
+        return PHYSICS::COLLISIONS::COLLISION_LAYER_ALIEN_MISSILE;
+    }
+}
 
 void Missile::SetTopPosition(const float topPositionInPixels)
 {
     // Preserve the same horizontal position.
-    float currentXPosition = m_sprite->getPosition().x;
+    float currentXPosition = m_sprite.getPosition().x;
 
     // The missile is positioned based on its top-left corner, so we can
     // change just its top position directly.
-    m_sprite->setPosition(currentXPosition, topPositionInPixels);
+    m_sprite.setPosition(currentXPosition, topPositionInPixels);
+    UpdateBoundingRectangle();
 }
 
 void Missile::SetBottomPosition(const float bottomPositionInPixels)
 {
     // Preserve the same horizontal position.
-    float currentXPosition = m_sprite->getPosition().x;
+    float currentXPosition = m_sprite.getPosition().x;
     
     // The missile is positioned based on its top-left corner, so we need
     // to calculate a new top position for it.
-    sf::FloatRect boundingRectangle = GetBoundingRectangle();
+    const sf::FloatRect& boundingRectangle = GetBoundingRectangle();
     float newTopPosition = bottomPositionInPixels - boundingRectangle.height;
-    m_sprite->setPosition(currentXPosition, newTopPosition);
+    m_sprite.setPosition(currentXPosition, newTopPosition);
+    UpdateBoundingRectangle();
 }
 
 void Missile::SetLeftPosition(const float leftPositionInPixels)
 {
     // Preserve the same vertical position.
-    float currentYPosition = m_sprite->getPosition().y;
+    float currentYPosition = m_sprite.getPosition().y;
 
     // The missile is positioned based on its top-left corner, so we can
     // change just its left position directly.
-    m_sprite->setPosition(leftPositionInPixels, currentYPosition);
+    m_sprite.setPosition(leftPositionInPixels, currentYPosition);
+    UpdateBoundingRectangle();
 }
 
 void Missile::SetRightPosition(float rightPositionInPixels)
 {
     // Preserve the same vertical position.
-    float currentYPosition = m_sprite->getPosition().y;
+    float currentYPosition = m_sprite.getPosition().y;
 
     // The bunny is positioned based on its top-left corner, so we need
     // to calculate a new left position for it.
-    sf::FloatRect boundingRectangle = GetBoundingRectangle();
+    const sf::FloatRect& boundingRectangle = GetBoundingRectangle();
     float newLeftPosition = rightPositionInPixels - boundingRectangle.width;
-    m_sprite->setPosition(newLeftPosition, currentYPosition);
+    m_sprite.setPosition(newLeftPosition, currentYPosition);
+    UpdateBoundingRectangle();
 }
 
 void Missile::OnWorldBoundaryCollide()
@@ -102,9 +135,19 @@ void Missile::OnWorldBoundaryCollide()
     /// @todo Have the missile disappear.
 }
 
-void Missile::Render(sf::RenderTarget& renderTarget)
+void Missile::SavePreviousPosition()
+{
+    m_previousPosition = m_sprite.getPosition();
+}
+
+void Missile::Render(GRAPHICS::SpriteBatch& spriteBatch, const float interpolationRatio)
 {
-    renderTarget.draw(*m_sprite);
+    // DRAW THE MISSILE BETWEEN ITS PREVIOUS AND CURRENT POSITIONS.
+    sf::RenderStates interpolatedRenderStates = GRAPHICS::GetInterpolatedRenderStates(
+        m_previousPosition,
+        m_sprite.getPosition(),
+        interpolationRatio);
+    spriteBatch.Add(m_sprite, interpolatedRenderStates);
 }
 
 MissileSource Missile::GetMissileSource() const
@@ -117,4 +160,14 @@ void Missile::Copy(const Missile& missileToCopy)
     this->m_source = missileToCopy.m_source;
     this->m_velocity = missileToCopy.m_velocity;
     this->m_sprite = missileToCopy.m_sprite;
+    this->m_boundingRectangle = missileToCopy.m_boundingRectangle;
+    this->m_previousPosition = missileToCopy.m_previousPosition;
+}
+
+void Missile::UpdateBoundingRectangle()
+{
+    // The missile is positioned based on its top-left corner, and its size never changes.
+    const sf::Vector2f& position = m_sprite.getPosition();
+    m_boundingRectangle.left = position.x;
+    m_boundingRectangle.top = position.y;
 }
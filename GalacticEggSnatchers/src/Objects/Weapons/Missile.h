@@ -1,9 +1,7 @@
 #pragma once
 
-#include <memory>
-#include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
-#include "Graphics/IRenderable.h"
+#include "Graphics/IBatchRenderable.h"
 #include "Objects/IGameObject.h"
 #include "Physics/Collisions/ICollidable.h"
 
@@ -28,22 +26,26 @@ namespace WEAPONS
     ///         with another object (resulting in an explosion) or
     ///         going off screen.
     ///
-    /// @todo   Remove the copy constructor and assignment operator if they aren't needed.
+    ///         Missiles are small value types that own their sprite
+    ///         directly so that they can be stored contiguously
+    ///         and reused without any heap allocations.
     ////////////////////////////////////////////////////////
-    class Missile : public IGameObject, public PHYSICS::COLLISIONS::ICollidable, public GRAPHICS::IRenderable
+    class Missile : public IGameObject, public PHYSICS::COLLISIONS::ICollidable, public GRAPHICS::IBatchRenderable
     {
     public:
-        /// @brief      Constructor.  Resources provided via the constructor
-        ///             may be modified by this object during its lifetime.
+        /// @brief  Constructor.  Creates an invalid missile that is not moving,
+        ///         allowing storage for missiles to be allocated in advance.
+        explicit Missile();
+
+        /// @brief      Constructor.
         /// @param[in]  source - The source of missile.
         /// @param[in]  velocity - The velocity of the missile (in pixels per second).
-        /// @param      sprite - The graphical sprite for this missile.
-        /// @param      sound - The sound to play for the missile.
+        /// @param[in]  sprite - The graphical sprite for this missile, positioned
+        ///             where the missile is fired from.
         explicit Missile(
             const MissileSource source,
             const sf::Vector2f& velocity,
-            const std::shared_ptr<sf::Sprite>& sprite,
-            const std::shared_ptr<sf::Sound>& sound);
+            const sf::Sprite& sprite);
 
         /// @brief      Copy constructor.
         /// @param[in]  missileToCopy - The missile to copy.
@@ -61,7 +63,10 @@ namespace WEAPONS
         virtual void Update(const sf::Time& elapsedTime);
 
         /// @copydoc    ICollidable::GetBoundingRectangle() const
-        virtual sf::FloatRect GetBoundingRectangle() const;
+        virtual const sf::FloatRect& GetBoundingRectangle() const;
+
+        /// @copydoc    ICollidable::GetCollisionLayer() const
+        virtual PHYSICS::COLLISIONS::CollisionLayer GetCollisionLayer() const;
 
         /// @copydoc    ICollidable::SetTopPosition(const float topPositionInPixels)
         virtual void SetTopPosition(const float topPositionInPixels);
@@ -78,8 +83,12 @@ namespace WEAPONS
         /// @copydoc    ICollidable::OnWorldBoundaryCollide()
         virtual void OnWorldBoundaryCollide();
 
-        /// @copydoc    IRenderable::Render(sf::RenderTarget& renderTarget)
-        virtual void Render(sf::RenderTarget& renderTarget);
+        /// @brief  Saves the current position of the missile as its position before the next
+        ///         simulation update, allowing rendering to interpolate between the two.
+        void SavePreviousPosition();
+
+        /// @copydoc    IBatchRenderable::Render(SpriteBatch& spriteBatch, const float interpolationRatio)
+        virtual void Render(GRAPHICS::SpriteBatch& spriteBatch, const float interpolationRatio);
 
         /// @brief  Gets the type of the source that fired this missile.
         /// @return The source of this missile.
@@ -90,10 +99,15 @@ namespace WEAPONS
         /// @param[in]  missileToCopy - The missile to copy.
         void Copy(const Missile& missileToCopy);
 
+        /// @brief  Moves the cached bounding rectangle to the missile's current position.
+        ///         Must be called whenever the missile's sprite is moved.
+        void UpdateBoundingRectangle();
+
         MissileSource m_source; ///< The missile's source.
         sf::Vector2f m_velocity;    ///< The missile's velocity (in pixels per second).
-        std::shared_ptr<sf::Sprite> m_sprite;   ///< The missile's graphical sprite.
-        std::shared_ptr<sf::Sound> m_sound; ///< The sound to play for the missile.
+        sf::Sprite m_sprite;    ///< The missile's graphical sprite.
+        sf::FloatRect m_boundingRectangle;  ///< The cached bounding rectangle of the missile, in screen coordinates.
+        sf::Vector2f m_previousPosition;    ///< The position of the missile before the latest simulation update.
     };
 }
 }
\ No newline at end of file
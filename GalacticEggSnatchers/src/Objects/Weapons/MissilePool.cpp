@@ -0,0 +1,192 @@
+#include "Objects/Weapons/MissilePool.h"
+
+using namespace OBJECTS::WEAPONS;
+
+MissilePool::MissilePool(const unsigned int capacity) :
+    m_capacity(capacity),
+    m_missiles(),
+    m_handles(),
+    m_handleTable()
+{
+    // ALLOCATE ALL STORAGE UP FRONT.
+    // No further allocations are needed since the pool never exceeds its capacity.
+    m_missiles.reserve(capacity);
+    m_handles.reserve(capacity);
+    m_handleTable.Reserve(capacity);
+}
+
+MissilePool::~MissilePool()
+{
+    // Nothing else to do.
+}
+
+CONTAINERS::GenerationalHandle MissilePool::Add(const Missile& missile)
+{
+    // CHECK IF ROOM EXISTS FOR ANOTHER MISSILE.
+    if (IsFull())
+    {
+        return CONTAINERS::GenerationalHandle();
+    }
+
+    // ADD THE MISSILE TO THE END OF THE ACTIVE MISSILES.
+    unsigned int newIndex = GetCount();
+    m_missiles.push_back(missile);
+
+    CONTAINERS::GenerationalHandle handle = m_handleTable.Allocate(newIndex);
+    m_handles.push_back(handle);
+    return handle;
+}
+
+void MissilePool::Remove(const CONTAINERS::GenerationalHandle& handle)
+{
+    // CHECK IF THE MISSILE STILL EXISTS.
+    bool missileExists = m_handleTable.Contains(handle);
+    if (!missileExists)
+    {
+        return;
+    }
+
+    unsigned int index = m_handleTable.GetDenseIndex(handle);
+    RemoveAt(index);
+}
+
+void MissilePool::RemoveAt(const unsigned int index)
+{
+    // FREE THE REMOVED MISSILE'S HANDLE.
+    m_handleTable.Free(m_handles[index]);
+
+    // MOVE THE LAST MISSILE INTO THE REMOVED MISSILE'S INDEX.
+    unsigned int lastIndex = GetCount() - 1;
+    bool removingLastMissile = (lastIndex == index);
+    if (!removingLastMissile)
+    {
+        m_missiles[index] = m_missiles[lastIndex];
+        m_handles[index] = m_handles[lastIndex];
+
+        // Keep the moved missile's handle pointing at its new index.
+        m_handleTable.SetDenseIndex(m_handles[index], index);
+    }
+
+    // REMOVE THE NOW UNUSED LAST MISSILE.
+    // Popping from a vector never releases its reserved storage.
+    m_missiles.pop_back();
+    m_handles.pop_back();
+}
+
+void MissilePool::Clear()
+{
+    m_missiles.clear();
+    m_handles.clear();
+    m_handleTable.Clear();
+}
+
+bool MissilePool::Contains(const CONTAINERS::GenerationalHandle& handle) const
+{
+    return m_handleTable.Contains(handle);
+}
+
+Missile* MissilePool::GetMissile(const CONTAINERS::GenerationalHandle& handle)
+{
+    // CHECK IF THE HANDLE IS STALE.
+    bool missileExists = m_handleTable.Contains(handle);
+    if (!missileExists)
+    {
+        return nullptr;
+    }
+
+    unsigned int index = m_handleTable.GetDenseIndex(handle);
+    return &m_missiles[index];
+}
+
+Missile& MissilePool::GetMissile(const unsigned int index)
+{
+    return m_missiles[index];
+}
+
+CONTAINERS::GenerationalHandle MissilePool::GetHandle(const unsigned int index) const
+{
+    return m_handles[index];
+}
+
+unsigned int MissilePool::GetCount() const
+{
+    return static_cast<unsigned int>(m_missiles.size());
+}
+
+unsigned int MissilePool::GetCapacity() const
+{
+    return m_capacity;
+}
+
+bool MissilePool::IsFull() const
+{
+    return (GetCount() >= m_capacity);
+}
+
+void MissilePool::SavePreviousPositions()
+{
+    for (Missile& missile : m_missiles)
+    {
+        missile.SavePreviousPosition();
+    }
+}
+
+void MissilePool::Update(const sf::Time& elapsedTime)
+{
+    for (Missile& missile : m_missiles)
+    {
+        missile.Update(elapsedTime);
+    }
+}
+
+void MissilePool::RemoveBoundaryCollisions(
+    const PHYSICS::COLLISIONS::CollisionSystem& collisionSystem,
+    const sf::FloatRect& boundsInPixels)
+{
+    // We don't automatically increment the index during the for loop because
+    // a removed missile is replaced by another missile at the same index.
+    for (unsigned int index = 0; index < GetCount();)
+    {
+        bool missileHitScreenBoundary = collisionSystem.HandleBoundaryCollisions(boundsInPixels, m_missiles[index]);
+        if (missileHitScreenBoundary)
+        {
+            // Remove the missile itself so that it is no longer updated.
+            RemoveAt(index);
+        }
+        else
+        {
+            // Move to the checking collisions for the next missile.
+            ++index;
+        }
+    }
+}
+
+void MissilePool::AddToBroadphase(PHYSICS::COLLISIONS::CollisionSystem& collisionSystem) const
+{
+    unsigned int missileCount = GetCount();
+    for (unsigned int index = 0; index < missileCount; ++index)
+    {
+        collisionSystem.AddToBroadphase(m_missiles[index], index);
+    }
+}
+
+void MissilePool::FindCollisionPairs(
+    PHYSICS::COLLISIONS::CollisionSystem& collisionSystem,
+    const PHYSICS::COLLISIONS::CollisionLayer packedLayer,
+    const PHYSICS::COLLISIONS::PackedRectangles& packedBoundingRectangles,
+    std::vector<PHYSICS::COLLISIONS::CollisionPair>& collisionPairs) const
+{
+    unsigned int missileCount = GetCount();
+    for (unsigned int index = 0; index < missileCount; ++index)
+    {
+        collisionSystem.FindCollisionPairs(m_missiles[index], index, packedLayer, packedBoundingRectangles, collisionPairs);
+    }
+}
+
+void MissilePool::Render(GRAPHICS::SpriteBatch& spriteBatch, const float interpolationRatio)
+{
+    for (Missile& missile : m_missiles)
+    {
+        missile.Render(spriteBatch, interpolationRatio);
+    }
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "Containers/GenerationalHandle.h"
+#include "Containers/HandleTable.h"
+#include "Graphics/IBatchRenderable.h"
+#include "Objects/Weapons/Missile.h"
+#include "Physics/Collisions/CollisionSystem.h"
+
+namespace OBJECTS
+{
+namespace WEAPONS
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  A fixed-capacity pool of active missiles.
+    ///
+    ///         All storage is allocated when the pool is created,
+    ///         so firing and removing missiles never allocates memory.
+    ///         Active missiles are packed contiguously for iteration
+    ///         by index (valid until the next removal), and each missile
+    ///         also has a generational handle that remains stable across
+    ///         removals.  Handles to removed missiles are detected as stale,
+    ///         even after their slot has been reused by a newer missile.
+    ////////////////////////////////////////////////////////
+    class MissilePool : public GRAPHICS::IBatchRenderable
+    {
+    public:
+        /// @brief  The default maximum number of missiles that may be active at once.
+        ///         This comfortably exceeds the number of missiles normally on screen.
+        static const unsigned int DEFAULT_CAPACITY = 512;
+
+        /// @brief      Constructor.  Allocates storage for all missiles up front.
+        /// @param[in]  capacity - The maximum number of missiles that may be active at once.
+        explicit MissilePool(const unsigned int capacity);
+
+        /// @brief  Destructor.
+        virtual ~MissilePool();
+
+        /// @brief      Adds a newly fired missile to the pool.
+        /// @param[in]  missile - The missile to add.
+        /// @return     The stable handle for the missile.  If the pool is full, the missile
+        ///             is not added and an invalid handle is returned.
+        CONTAINERS::GenerationalHandle Add(const Missile& missile);
+
+        /// @brief      Removes a missile.  Does nothing if the handle no longer refers to a missile.
+        /// @param[in]  handle - The handle of the missile to remove.
+        void Remove(const CONTAINERS::GenerationalHandle& handle);
+
+        /// @brief      Removes the missile at the specified index.  The last missile is moved
+        ///             into the index, so iteration that removes missiles should re-examine
+        ///             the same index rather than advancing.
+        /// @param[in]  index - The index of the missile to remove.  Must be less than GetCount().
+        void RemoveAt(const unsigned int index);
+
+        /// @brief  Removes all missiles.  Handles to removed missiles become stale.
+        void Clear();
+
+        /// @brief      Checks if a handle still refers to a missile.
+        /// @param[in]  handle - The handle to check.
+        /// @return     True if the missile exists; false if it was removed.
+        bool Contains(const CONTAINERS::GenerationalHandle& handle) const;
+
+        /// @brief      Gets a missile by its handle.
+        /// @param[in]  handle - The handle of the missile.
+        /// @return     The missile; null if the handle is stale.
+        Missile* GetMissile(const CONTAINERS::GenerationalHandle& handle);
+
+        /// @brief      Gets a missile by its current index.
+        /// @param[in]  index - The index of the missile.  Must be less than GetCount().
+        /// @return     The missile.
+        Missile& GetMissile(const unsigned int index);
+
+        /// @brief      Gets the stable handle of a missile.
+        /// @param[in]  index - The index of the missile.  Must be less than GetCount().
+        /// @return     The handle of the missile.
+        CONTAINERS::GenerationalHandle GetHandle(const unsigned int index) const;
+
+        /// @brief  Gets the number of active missiles.
+        /// @return The number of missiles in the pool.
+        unsigned int GetCount() const;
+
+        /// @brief  Gets the maximum number of missiles that may be active at once.
+        /// @return The capacity of the pool.
+        unsigned int GetCapacity() const;
+
+        /// @brief  Checks if no more missiles can be added.
+        /// @return True if the pool is full; false otherwise.
+        bool IsFull() const;
+
+        /// @brief  Saves the current positions of all missiles as their positions before the next
+        ///         simulation update, allowing rendering to interpolate between the two.
+        void SavePreviousPositions();
+
+        /// @brief      Updates all missiles for a single update frame.
+        /// @param[in]  elapsedTime - The elapsed time since the last frame of updating.
+        void Update(const sf::Time& elapsedTime);
+
+        /// @brief      Removes all missiles that have hit a screen boundary.
+        /// @param[in]  collisionSystem - The collision system for detecting boundary collisions.
+        /// @param[in]  boundsInPixels - The boundaries that missiles are removed upon hitting.
+        void RemoveBoundaryCollisions(
+            const PHYSICS::COLLISIONS::CollisionSystem& collisionSystem,
+            const sf::FloatRect& boundsInPixels);
+
+        /// @brief          Adds all missiles to the broadphase of the collision system,
+        ///                 identifying each missile by its current index.
+        /// @param[in,out]  collisionSystem - The collision system to add missiles to.
+        void AddToBroadphase(PHYSICS::COLLISIONS::CollisionSystem& collisionSystem) const;
+
+        /// @brief          Finds all collisions between missiles and a layer of objects whose
+        ///                 bounding rectangles are packed, identifying each missile by its current index.
+        /// @param[in,out]  collisionSystem - The collision system for finding collisions.
+        /// @param[in]      packedLayer - The collision layer of all packed objects.
+        /// @param[in]      packedBoundingRectangles - The bounding rectangles of the packed objects.
+        /// @param[in,out]  collisionPairs - The colliding pairs are appended.
+        void FindCollisionPairs(
+            PHYSICS::COLLISIONS::CollisionSystem& collisionSystem,
+            const PHYSICS::COLLISIONS::CollisionLayer packedLayer,
+            const PHYSICS::COLLISIONS::PackedRectangles& packedBoundingRectangles,
+            std::vector<PHYSICS::COLLISIONS::CollisionPair>& collisionPairs) const;
+
+        /// @copydoc    IBatchRenderable::Render(SpriteBatch& spriteBatch, const float interpolationRatio)
+        virtual void Render(GRAPHICS::SpriteBatch& spriteBatch, const float interpolationRatio);
+
+    private:
+        MissilePool(const MissilePool& poolToCopy); ///< Private to disallow copying.
+        MissilePool& operator= (const MissilePool& rhsPool);    ///< Private to disallow assignment.
+
+        unsigned int m_capacity;    ///< The maximum number of missiles that may be active at once.
+        std::vector<Missile> m_missiles;    ///< The active missiles, densely packed.
+        std::vector<CONTAINERS::GenerationalHandle> m_handles;  ///< The stable handle of each active missile.
+        CONTAINERS::HandleTable m_handleTable;  ///< Maps stable handles to missile indices.
+    };
+}
+}
@@ -0,0 +1,33 @@
+#include "Physics/Collisions/CollisionLayer.h"
+
+PHYSICS::COLLISIONS::CollisionLayerMask PHYSICS::COLLISIONS::GetCollisionLayerMask(const CollisionLayer layer)
+{
+    return (1u << layer);
+}
+
+PHYSICS::COLLISIONS::CollisionLayerMask PHYSICS::COLLISIONS::GetDefaultCollisionMask(const CollisionLayer layer)
+{
+    switch (layer)
+    {
+    case COLLISION_LAYER_BUNNY:
+        // The bunny is hurt by aliens and their missiles.
+        return GetCollisionLayerMask(COLLISION_LAYER_ALIEN) | GetCollisionLayerMask(COLLISION_LAYER_ALIEN_MISSILE);
+    case COLLISION_LAYER_BUNNY_MISSILE:
+        // The bunny's missiles can only destroy aliens.
+        return GetCollisionLayerMask(COLLISION_LAYER_ALIEN);
+    case COLLISION_LAYER_ALIEN:
+        // Aliens attack the bunny and eggs by touching them, and they can be destroyed by the bunny's missiles.
+        return GetCollisionLayerMask(COLLISION_LAYER_BUNNY) |
+            GetCollisionLayerMask(COLLISION_LAYER_BUNNY_MISSILE) |
+            GetCollisionLayerMask(COLLISION_LAYER_EGG);
+    case COLLISION_LAYER_ALIEN_MISSILE:
+        // Alien missiles attack the bunny and eggs.
+        return GetCollisionLayerMask(COLLISION_LAYER_BUNNY) | GetCollisionLayerMask(COLLISION_LAYER_EGG);
+    case COLLISION_LAYER_EGG:
+        // Eggs are attacked by aliens and their missiles.
+        return GetCollisionLayerMask(COLLISION_LAYER_ALIEN) | GetCollisionLayerMask(COLLISION_LAYER_ALIEN_MISSILE);
+    default:
+        // Invalid layers don't collide with anything.
+        return 0;
+    }
+}
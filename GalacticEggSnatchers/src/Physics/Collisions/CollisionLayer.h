@@ -0,0 +1,37 @@
+#pragma once
+
+namespace PHYSICS
+{
+namespace COLLISIONS
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Defines the layers that collidable objects belong to.
+    ///         Only objects in layers that can interact with each
+    ///         other are ever tested for collisions.
+    ////////////////////////////////////////////////////////
+    enum CollisionLayer
+    {
+        COLLISION_LAYER_BUNNY = 0,  ///< The Easter bunny controlled by the player.
+        COLLISION_LAYER_BUNNY_MISSILE = 1,  ///< Missiles fired by the Easter bunny.
+        COLLISION_LAYER_ALIEN = 2,  ///< Enemy aliens.
+        COLLISION_LAYER_ALIEN_MISSILE = 3,  ///< Missiles fired by aliens.
+        COLLISION_LAYER_EGG = 4,    ///< Easter eggs protected by the player.
+        COLLISION_LAYER_COUNT = 5   ///< The number of collision layers.  Not a valid layer.
+    };
+
+    /// @brief  A set of collision layers, with one bit per layer.
+    typedef unsigned int CollisionLayerMask;
+
+    /// @brief      Gets the mask containing only the specified layer.
+    /// @param[in]  layer - The layer to get the mask for.
+    /// @return     The mask with only the bit for the layer set.
+    CollisionLayerMask GetCollisionLayerMask(const CollisionLayer layer);
+
+    /// @brief      Gets the standard set of layers that objects in the specified layer collide with.
+    ///             These interactions are symmetric, so if one layer collides with another,
+    ///             the other layer also collides with the first layer.
+    /// @param[in]  layer - The layer to get the colliding layers for.
+    /// @return     The mask of layers that objects in the layer collide with.
+    CollisionLayerMask GetDefaultCollisionMask(const CollisionLayer layer);
+}
+}
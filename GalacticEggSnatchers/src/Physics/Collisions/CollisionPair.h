@@ -0,0 +1,26 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "Physics/Collisions/CollisionLayer.h"
+
+namespace PHYSICS
+{
+namespace COLLISIONS
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  A pair of objects found to be colliding.
+    ///         The first object is always in the lower-numbered
+    ///         layer so that handlers for a given combination
+    ///         of layers always receive objects in the same order.
+    ////////////////////////////////////////////////////////
+    struct CollisionPair
+    {
+        CollisionLayer FirstLayer;  ///< The collision layer of the first object.
+        unsigned int FirstObjectId; ///< The caller-defined ID of the first object.
+        sf::FloatRect FirstBoundingRectangle;   ///< The bounding rectangle of the first object.
+        CollisionLayer SecondLayer; ///< The collision layer of the second object.
+        unsigned int SecondObjectId;    ///< The caller-defined ID of the second object.
+        sf::FloatRect SecondBoundingRectangle;  ///< The bounding rectangle of the second object.
+    };
+}
+}
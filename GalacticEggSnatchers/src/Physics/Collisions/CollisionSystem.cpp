@@ -1,10 +1,18 @@
 #include "Physics/Collisions/CollisionSystem.h"
+#include "Physics/Collisions/RectangleIntersection.h"
 
 using namespace PHYSICS::COLLISIONS;
 
-CollisionSystem::CollisionSystem()
+// STATIC CONSTANT INITIALIZATION.
+const float CollisionSystem::BROADPHASE_CELL_SIZE_IN_PIXELS = 32.0f;
+
+// INSTANCE METHODS.
+
+CollisionSystem::CollisionSystem(const sf::FloatRect& worldBoundsInPixels) :
+    m_broadphaseGrid(worldBoundsInPixels, BROADPHASE_CELL_SIZE_IN_PIXELS),
+    m_packedHitMask()
 {
-    // Nothing to do.
+    // Nothing else to do.
 }
 
 CollisionSystem::~CollisionSystem()
@@ -17,7 +25,7 @@ bool CollisionSystem::HandleBoundaryCollisions(const sf::FloatRect& boundsInPixe
     // HANDLE COLLISIONS FOR THE OBJECT.
     // It is only expected that an object can exceed one of the boundaries at a time,
     // so we'll return after handling a collision with a single boundary.
-    sf::FloatRect objectBoundingRectangle = collidableObject.GetBoundingRectangle();
+    const sf::FloatRect& objectBoundingRectangle = collidableObject.GetBoundingRectangle();
 
     // Check for the top boundary being exceeded.
     bool objectExceededTopBounds = (objectBoundingRectangle.top < boundsInPixels.top);
@@ -85,4 +93,78 @@ bool CollisionSystem::HandleBoundaryCollisions(const sf::FloatRect& boundsInPixe
 
     // NO COLLISION OCCURRED.
     return false;
-}
\ No newline at end of file
+}
+
+void CollisionSystem::ClearBroadphase()
+{
+    m_broadphaseGrid.Clear();
+}
+
+void CollisionSystem::AddToBroadphase(const ICollidable& collidableObject, const unsigned int objectId)
+{
+    m_broadphaseGrid.Insert(
+        collidableObject.GetBoundingRectangle(),
+        collidableObject.GetCollisionLayer(),
+        collidableObject.GetCollisionMask(),
+        objectId);
+}
+
+void CollisionSystem::FindCollisionPairs(std::vector<CollisionPair>& collisionPairs) const
+{
+    m_broadphaseGrid.FindCollisionPairs(collisionPairs);
+}
+
+void CollisionSystem::FindCollisionPairs(
+    const ICollidable& collidableObject,
+    const unsigned int objectId,
+    const CollisionLayer packedLayer,
+    const PackedRectangles& packedBoundingRectangles,
+    std::vector<CollisionPair>& collisionPairs)
+{
+    // CHECK IF THE OBJECT CAN COLLIDE WITH THE PACKED LAYER.
+    CollisionLayerMask packedLayerMask = GetCollisionLayerMask(packedLayer);
+    bool objectCollidesWithPackedLayer = (0 != (collidableObject.GetCollisionMask() & packedLayerMask));
+    if (!objectCollidesWithPackedLayer)
+    {
+        return;
+    }
+
+    // TEST THE OBJECT AGAINST ALL PACKED OBJECTS AT ONCE.
+    const sf::FloatRect& objectBoundingRectangle = collidableObject.GetBoundingRectangle();
+    bool anyCollisions = FindIntersectingRectangles(objectBoundingRectangle, packedBoundingRectangles, m_packedHitMask);
+    if (!anyCollisions)
+    {
+        return;
+    }
+
+    // REPORT A PAIR FOR EACH COLLIDING PACKED OBJECT.
+    // Pairs are reported with the object in the lower layer first.
+    CollisionLayer objectLayer = collidableObject.GetCollisionLayer();
+    bool objectInLowerLayer = (objectLayer <= packedLayer);
+    unsigned int hitMaskWordCount = static_cast<unsigned int>(m_packedHitMask.size());
+    for (unsigned int wordIndex = 0; wordIndex < hitMaskWordCount; ++wordIndex)
+    {
+        // Skip over words without any collisions since most packed objects are expected to miss.
+        uint32_t hitMaskWord = m_packedHitMask[wordIndex];
+        for (unsigned int bitIndex = 0; 0 != hitMaskWord; ++bitIndex, hitMaskWord >>= 1)
+        {
+            bool packedObjectCollided = (0 != (hitMaskWord & 1u));
+            if (!packedObjectCollided)
+            {
+                continue;
+            }
+
+            unsigned int packedObjectId = (wordIndex * RECTANGLES_PER_HIT_MASK_WORD) + bitIndex;
+            sf::FloatRect packedBoundingRectangle = packedBoundingRectangles.GetRectangle(packedObjectId);
+
+            CollisionPair collisionPair;
+            collisionPair.FirstLayer = objectInLowerLayer ? objectLayer : packedLayer;
+            collisionPair.FirstObjectId = objectInLowerLayer ? objectId : packedObjectId;
+            collisionPair.FirstBoundingRectangle = objectInLowerLayer ? objectBoundingRectangle : packedBoundingRectangle;
+            collisionPair.SecondLayer = objectInLowerLayer ? packedLayer : objectLayer;
+            collisionPair.SecondObjectId = objectInLowerLayer ? packedObjectId : objectId;
+            collisionPair.SecondBoundingRectangle = objectInLowerLayer ? packedBoundingRectangle : objectBoundingRectangle;
+            collisionPairs.push_back(collisionPair);
+        }
+    }
+}
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <cstdint>
+#include <vector>
 #include <SFML/Graphics.hpp>
+#include "Physics/Collisions/CollisionPair.h"
 #include "Physics/Collisions/ICollidable.h"
+#include "Physics/Collisions/PackedRectangles.h"
+#include "Physics/Collisions/SpatialGrid.h"
 
 namespace PHYSICS
 {
@@ -10,12 +15,30 @@ namespace COLLISIONS
     ////////////////////////////////////////////////////////
     /// @brief  Responsible responsible for managing collisions
     ///         between collidable objects.
+    ///
+    ///         Object-vs-object collisions are found with a broadphase
+    ///         spatial grid.  All collidable objects are added to the
+    ///         broadphase each update, after which pairs of colliding
+    ///         objects can be found.  Only objects near each other in
+    ///         layers that interact are ever tested.
+    ///
+    ///         Layers with many objects whose bounding rectangles are
+    ///         already packed contiguously may instead be kept out of the
+    ///         broadphase and tested against each object with SIMD
+    ///         instructions, which is cheaper than inserting them all
+    ///         into the grid.
     ////////////////////////////////////////////////////////
     class CollisionSystem
     {
     public:
-        /// @brief  Constructor.
-        explicit CollisionSystem();
+        /// @brief  The width and height of broadphase grid cells.
+        ///         This matches the size of the largest sprites in the game,
+        ///         so most objects only overlap a few cells.
+        static const float BROADPHASE_CELL_SIZE_IN_PIXELS;
+
+        /// @brief      Constructor.
+        /// @param[in]  worldBoundsInPixels - The area that objects are expected to be within.
+        explicit CollisionSystem(const sf::FloatRect& worldBoundsInPixels);
 
         /// @brief  Destructor.
         ~CollisionSystem();
@@ -29,9 +52,45 @@ namespace COLLISIONS
         /// @return         True if the object collided with a boundary; false otherwise.
         bool HandleBoundaryCollisions(const sf::FloatRect& boundsInPixels, ICollidable& collidableObject) const;
 
+        /// @brief  Removes all objects from the broadphase.
+        void ClearBroadphase();
+
+        /// @brief      Adds an object to the broadphase so that it may be found in collision pairs.
+        /// @param[in]  collidableObject - The object to add.  Its current bounding rectangle,
+        ///             collision layer, and collision mask are used.
+        /// @param[in]  objectId - The caller-defined ID of the object.
+        void AddToBroadphase(const ICollidable& collidableObject, const unsigned int objectId);
+
+        /// @brief          Finds all pairs of broadphase objects that are colliding.
+        ///                 Only objects near each other are tested, so the cost depends on how crowded
+        ///                 objects are rather than on the total number of objects.
+        /// @param[in,out]  collisionPairs - The colliding pairs are appended.
+        ///                 The container is not cleared first.
+        void FindCollisionPairs(std::vector<CollisionPair>& collisionPairs) const;
+
+        /// @brief          Finds all collisions between an object and a layer of objects whose
+        ///                 bounding rectangles are packed.  Every packed object is tested.
+        /// @param[in]      collidableObject - The object to test.  Nothing is found if its collision
+        ///                 mask doesn't include the packed layer.
+        /// @param[in]      objectId - The caller-defined ID of the object.
+        /// @param[in]      packedLayer - The collision layer of all packed objects.
+        /// @param[in]      packedBoundingRectangles - The bounding rectangles of the packed objects.
+        ///                 Each packed object's ID is its index.
+        /// @param[in,out]  collisionPairs - The colliding pairs are appended.
+        ///                 The container is not cleared first.
+        void FindCollisionPairs(
+            const ICollidable& collidableObject,
+            const unsigned int objectId,
+            const CollisionLayer packedLayer,
+            const PackedRectangles& packedBoundingRectangles,
+            std::vector<CollisionPair>& collisionPairs);
+
     private:
         CollisionSystem(const CollisionSystem& systemToCopy);   ///< Private to disallow copying.
         CollisionSystem& operator= (const CollisionSystem& collisionSystem);    ///< Private to disallow assignment.
+
+        SpatialGrid m_broadphaseGrid;   ///< The grid for finding objects that may be colliding.
+        std::vector<uint32_t> m_packedHitMask;  ///< Which packed objects collided with the latest tested object.
     };
 }
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include "Physics/Collisions/CollisionLayer.h"
 
 /// @brief  Code related to physics.
 namespace PHYSICS
@@ -18,8 +19,22 @@ namespace COLLISIONS
         virtual ~ICollidable() {};
 
         /// @brief      Returns the bounding rectangle of the object, in screen coordinates.
+        ///             Objects cache their bounding rectangle and only update it when they move,
+        ///             so this is cheap enough to call repeatedly during collision detection.
         /// @return     The bounding rectangle of the object on the screen (in pixels).
-        virtual sf::FloatRect GetBoundingRectangle() const = 0;
+        virtual const sf::FloatRect& GetBoundingRectangle() const = 0;
+
+        /// @brief      Gets the collision layer that the object belongs to.
+        /// @return     The object's collision layer.
+        virtual CollisionLayer GetCollisionLayer() const = 0;
+
+        /// @brief      Gets the collision layers that the object can collide with.
+        ///             By default, these are the standard interactions for the object's layer.
+        /// @return     The mask of layers that the object collides with.
+        virtual CollisionLayerMask GetCollisionMask() const
+        {
+            return GetDefaultCollisionMask(GetCollisionLayer());
+        }
 
         /// @brief      Sets the top position of the object, in screen coordinates.
         /// @param[in]  topPositionInPixels - The top position of the object (in pixels).
@@ -0,0 +1,107 @@
+#include "Physics/Collisions/PackedRectangles.h"
+
+using namespace PHYSICS::COLLISIONS;
+
+PackedRectangles::PackedRectangles() :
+    m_leftEdges(),
+    m_topEdges(),
+    m_rightEdges(),
+    m_bottomEdges()
+{
+    // Nothing else to do.
+}
+
+PackedRectangles::~PackedRectangles()
+{
+    // Nothing to do.
+}
+
+void PackedRectangles::Reserve(const unsigned int rectangleCount)
+{
+    m_leftEdges.reserve(rectangleCount);
+    m_topEdges.reserve(rectangleCount);
+    m_rightEdges.reserve(rectangleCount);
+    m_bottomEdges.reserve(rectangleCount);
+}
+
+void PackedRectangles::Add(const sf::FloatRect& rectangle)
+{
+    m_leftEdges.push_back(rectangle.left);
+    m_topEdges.push_back(rectangle.top);
+    m_rightEdges.push_back(rectangle.left + rectangle.width);
+    m_bottomEdges.push_back(rectangle.top + rectangle.height);
+}
+
+void PackedRectangles::Set(const unsigned int index, const sf::FloatRect& rectangle)
+{
+    m_leftEdges[index] = rectangle.left;
+    m_topEdges[index] = rectangle.top;
+    m_rightEdges[index] = rectangle.left + rectangle.width;
+    m_bottomEdges[index] = rectangle.top + rectangle.height;
+}
+
+void PackedRectangles::SetPosition(const unsigned int index, const sf::Vector2f& topLeftPosition, const sf::Vector2f& size)
+{
+    m_leftEdges[index] = topLeftPosition.x;
+    m_topEdges[index] = topLeftPosition.y;
+    m_rightEdges[index] = topLeftPosition.x + size.x;
+    m_bottomEdges[index] = topLeftPosition.y + size.y;
+}
+
+void PackedRectangles::RemoveAt(const unsigned int index)
+{
+    // MOVE THE LAST RECTANGLE INTO THE REMOVED RECTANGLE'S INDEX.
+    unsigned int lastIndex = GetCount() - 1;
+    m_leftEdges[index] = m_leftEdges[lastIndex];
+    m_topEdges[index] = m_topEdges[lastIndex];
+    m_rightEdges[index] = m_rightEdges[lastIndex];
+    m_bottomEdges[index] = m_bottomEdges[lastIndex];
+
+    // REMOVE THE NOW UNUSED LAST ELEMENT OF EACH ARRAY.
+    m_leftEdges.pop_back();
+    m_topEdges.pop_back();
+    m_rightEdges.pop_back();
+    m_bottomEdges.pop_back();
+}
+
+void PackedRectangles::Clear()
+{
+    m_leftEdges.clear();
+    m_topEdges.clear();
+    m_rightEdges.clear();
+    m_bottomEdges.clear();
+}
+
+sf::FloatRect PackedRectangles::GetRectangle(const unsigned int index) const
+{
+    float left = m_leftEdges[index];
+    float top = m_topEdges[index];
+    float width = m_rightEdges[index] - left;
+    float height = m_bottomEdges[index] - top;
+    return sf::FloatRect(left, top, width, height);
+}
+
+unsigned int PackedRectangles::GetCount() const
+{
+    return static_cast<unsigned int>(m_leftEdges.size());
+}
+
+const float* PackedRectangles::GetLeftEdges() const
+{
+    return m_leftEdges.empty() ? nullptr : &m_leftEdges[0];
+}
+
+const float* PackedRectangles::GetTopEdges() const
+{
+    return m_topEdges.empty() ? nullptr : &m_topEdges[0];
+}
+
+const float* PackedRectangles::GetRightEdges() const
+{
+    return m_rightEdges.empty() ? nullptr : &m_rightEdges[0];
+}
+
+const float* PackedRectangles::GetBottomEdges() const
+{
+    return m_bottomEdges.empty() ? nullptr : &m_bottomEdges[0];
+}
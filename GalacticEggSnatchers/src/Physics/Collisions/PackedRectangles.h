@@ -0,0 +1,93 @@
+#pragma once
+
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+namespace PHYSICS
+{
+namespace COLLISIONS
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  A collection of axis-aligned rectangles stored as a
+    ///         structure of arrays, with each edge of every rectangle
+    ///         packed contiguously.  This allows a single rectangle to
+    ///         be tested against many rectangles at once using SIMD
+    ///         instructions.
+    ///
+    ///         Rectangles are stored by their edges rather than their
+    ///         size so that intersection tests only need comparisons.
+    ///         Removal swaps the last rectangle into the removed
+    ///         rectangle's index, so the order is not preserved.
+    ////////////////////////////////////////////////////////
+    class PackedRectangles
+    {
+    public:
+        /// @brief  Constructor.  Creates an empty collection.
+        explicit PackedRectangles();
+
+        /// @brief  Destructor.
+        ~PackedRectangles();
+
+        /// @brief      Reserves memory for the specified number of rectangles.
+        /// @param[in]  rectangleCount - The number of rectangles to reserve memory for.
+        void Reserve(const unsigned int rectangleCount);
+
+        /// @brief      Adds a rectangle to the end of the collection.
+        /// @param[in]  rectangle - The rectangle to add.
+        void Add(const sf::FloatRect& rectangle);
+
+        /// @brief      Replaces the rectangle at the specified index.
+        /// @param[in]  index - The index of the rectangle.  Must be less than GetCount().
+        /// @param[in]  rectangle - The new rectangle.
+        void Set(const unsigned int index, const sf::FloatRect& rectangle);
+
+        /// @brief      Moves the rectangle at the specified index without changing its size.
+        /// @param[in]  index - The index of the rectangle.  Must be less than GetCount().
+        /// @param[in]  topLeftPosition - The new top-left position of the rectangle.
+        /// @param[in]  size - The width and height of the rectangle.
+        void SetPosition(const unsigned int index, const sf::Vector2f& topLeftPosition, const sf::Vector2f& size);
+
+        /// @brief      Removes the rectangle at the specified index.  The last rectangle
+        ///             is moved into the index.
+        /// @param[in]  index - The index of the rectangle to remove.  Must be less than GetCount().
+        void RemoveAt(const unsigned int index);
+
+        /// @brief  Removes all rectangles.
+        void Clear();
+
+        /// @brief      Gets a rectangle.
+        /// @param[in]  index - The index of the rectangle.  Must be less than GetCount().
+        /// @return     The rectangle at the index.
+        sf::FloatRect GetRectangle(const unsigned int index) const;
+
+        /// @brief  Gets the number of rectangles.
+        /// @return The number of rectangles in the collection.
+        unsigned int GetCount() const;
+
+        /// @brief  Gets the left edges of all rectangles.
+        /// @return The left edge of each rectangle, or null if the collection is empty.
+        const float* GetLeftEdges() const;
+
+        /// @brief  Gets the top edges of all rectangles.
+        /// @return The top edge of each rectangle, or null if the collection is empty.
+        const float* GetTopEdges() const;
+
+        /// @brief  Gets the right edges of all rectangles.
+        /// @return The right edge of each rectangle, or null if the collection is empty.
+        const float* GetRightEdges() const;
+
+        /// @brief  Gets the bottom edges of all rectangles.
+        /// @return The bottom edge of each rectangle, or null if the collection is empty.
+        const float* GetBottomEdges() const;
+
+    private:
+        PackedRectangles(const PackedRectangles& rectanglesToCopy);    ///< Private to disallow copying.
+        PackedRectangles& operator= (const PackedRectangles& rhsRectangles);   ///< Private to disallow assignment.
+
+        std::vector<float> m_leftEdges;     ///< The left edge of each rectangle.
+        std::vector<float> m_topEdges;      ///< The top edge of each rectangle.
+        std::vector<float> m_rightEdges;    ///< The right edge of each rectangle.
+        std::vector<float> m_bottomEdges;   ///< The bottom edge of each rectangle.
+    };
+}
+}
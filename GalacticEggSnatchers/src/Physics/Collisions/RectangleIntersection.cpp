@@ -0,0 +1,296 @@
+#include <stdexcept>
+#include <string>
+#include "Physics/Collisions/RectangleIntersection.h"
+
+// DETERMINE WHICH SIMD INSTRUCTION SETS ARE AVAILABLE.
+// SSE2 is always available on 64-bit x86 and is enabled for 32-bit x86 with /arch:SSE2.
+#if defined(__AVX2__)
+    #define RECTANGLE_INTERSECTION_AVX2_AVAILABLE
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define RECTANGLE_INTERSECTION_SSE2_AVAILABLE
+#endif
+
+#if defined(RECTANGLE_INTERSECTION_AVX2_AVAILABLE)
+    #include <immintrin.h>
+#elif defined(RECTANGLE_INTERSECTION_SSE2_AVAILABLE)
+    #include <emmintrin.h>
+#endif
+
+using namespace PHYSICS::COLLISIONS;
+
+/// @brief      Tests a single rectangle against a range of packed rectangles, one at a time.
+///             Results are ORed into the hit mask, which must already be cleared.
+/// @param[in]  rectangleLeft - The left edge of the tested rectangle.
+/// @param[in]  rectangleTop - The top edge of the tested rectangle.
+/// @param[in]  rectangleRight - The right edge of the tested rectangle.
+/// @param[in]  rectangleBottom - The bottom edge of the tested rectangle.
+/// @param[in]  packedRectangles - The rectangles to test against.
+/// @param[in]  startIndex - The index of the first packed rectangle to test.
+/// @param[in,out]  hitMask - The hit mask to set bits in for intersecting rectangles.
+/// @return     True if any tested rectangles intersected; false otherwise.
+static bool FindIntersectingRectanglesScalar(
+    const float rectangleLeft,
+    const float rectangleTop,
+    const float rectangleRight,
+    const float rectangleBottom,
+    const PackedRectangles& packedRectangles,
+    const unsigned int startIndex,
+    uint32_t* hitMask)
+{
+    const float* leftEdges = packedRectangles.GetLeftEdges();
+    const float* topEdges = packedRectangles.GetTopEdges();
+    const float* rightEdges = packedRectangles.GetRightEdges();
+    const float* bottomEdges = packedRectangles.GetBottomEdges();
+
+    bool anyIntersections = false;
+    unsigned int rectangleCount = packedRectangles.GetCount();
+    for (unsigned int index = startIndex; index < rectangleCount; ++index)
+    {
+        bool horizontallyOverlapping = (leftEdges[index] < rectangleRight) && (rectangleLeft < rightEdges[index]);
+        bool verticallyOverlapping = (topEdges[index] < rectangleBottom) && (rectangleTop < bottomEdges[index]);
+        bool intersecting = horizontallyOverlapping && verticallyOverlapping;
+        if (intersecting)
+        {
+            unsigned int wordIndex = index / RECTANGLES_PER_HIT_MASK_WORD;
+            unsigned int bitIndex = index % RECTANGLES_PER_HIT_MASK_WORD;
+            hitMask[wordIndex] |= (1u << bitIndex);
+            anyIntersections = true;
+        }
+    }
+
+    return anyIntersections;
+}
+
+#if defined(RECTANGLE_INTERSECTION_SSE2_AVAILABLE)
+/// @brief      Tests a single rectangle against all packed rectangles, 4 at a time.
+///             Results are ORed into the hit mask, which must already be cleared.
+/// @param[in]  rectangle - The rectangle to test.
+/// @param[in]  packedRectangles - The rectangles to test against.
+/// @param[in,out]  hitMask - The hit mask to set bits in for intersecting rectangles.
+/// @return     True if any packed rectangles intersected; false otherwise.
+static bool FindIntersectingRectanglesSse2(
+    const sf::FloatRect& rectangle,
+    const PackedRectangles& packedRectangles,
+    uint32_t* hitMask)
+{
+    // BROADCAST THE TESTED RECTANGLE'S EDGES ACROSS ALL LANES.
+    float rectangleRight = rectangle.left + rectangle.width;
+    float rectangleBottom = rectangle.top + rectangle.height;
+    __m128 rectangleLefts = _mm_set1_ps(rectangle.left);
+    __m128 rectangleTops = _mm_set1_ps(rectangle.top);
+    __m128 rectangleRights = _mm_set1_ps(rectangleRight);
+    __m128 rectangleBottoms = _mm_set1_ps(rectangleBottom);
+
+    // TEST FULL GROUPS OF PACKED RECTANGLES.
+    // The packed arrays aren't guaranteed to be 16-byte aligned, so unaligned loads are used.
+    const float* leftEdges = packedRectangles.GetLeftEdges();
+    const float* topEdges = packedRectangles.GetTopEdges();
+    const float* rightEdges = packedRectangles.GetRightEdges();
+    const float* bottomEdges = packedRectangles.GetBottomEdges();
+
+    const unsigned int RECTANGLES_PER_GROUP = 4;
+    unsigned int rectangleCount = packedRectangles.GetCount();
+    unsigned int fullGroupRectangleCount = rectangleCount - (rectangleCount % RECTANGLES_PER_GROUP);
+    uint32_t anyIntersectionBits = 0;
+    for (unsigned int index = 0; index < fullGroupRectangleCount; index += RECTANGLES_PER_GROUP)
+    {
+        __m128 horizontallyOverlapping = _mm_and_ps(
+            _mm_cmplt_ps(_mm_loadu_ps(leftEdges + index), rectangleRights),
+            _mm_cmplt_ps(rectangleLefts, _mm_loadu_ps(rightEdges + index)));
+        __m128 verticallyOverlapping = _mm_and_ps(
+            _mm_cmplt_ps(_mm_loadu_ps(topEdges + index), rectangleBottoms),
+            _mm_cmplt_ps(rectangleTops, _mm_loadu_ps(bottomEdges + index)));
+        __m128 intersecting = _mm_and_ps(horizontallyOverlapping, verticallyOverlapping);
+
+        // Groups never straddle hit mask words since each word holds a whole number of groups.
+        uint32_t intersectionBits = static_cast<uint32_t>(_mm_movemask_ps(intersecting));
+        unsigned int wordIndex = index / RECTANGLES_PER_HIT_MASK_WORD;
+        unsigned int bitIndex = index % RECTANGLES_PER_HIT_MASK_WORD;
+        hitMask[wordIndex] |= (intersectionBits << bitIndex);
+        anyIntersectionBits |= intersectionBits;
+    }
+
+    // TEST ANY REMAINING RECTANGLES INDIVIDUALLY.
+    bool anyRemainingIntersections = FindIntersectingRectanglesScalar(
+        rectangle.left,
+        rectangle.top,
+        rectangleRight,
+        rectangleBottom,
+        packedRectangles,
+        fullGroupRectangleCount,
+        hitMask);
+
+    bool anyIntersections = (0 != anyIntersectionBits) || anyRemainingIntersections;
+    return anyIntersections;
+}
+#endif
+
+#if defined(RECTANGLE_INTERSECTION_AVX2_AVAILABLE)
+/// @brief      Tests a single rectangle against all packed rectangles, 8 at a time.
+///             Results are ORed into the hit mask, which must already be cleared.
+/// @param[in]  rectangle - The rectangle to test.
+/// @param[in]  packedRectangles - The rectangles to test against.
+/// @param[in,out]  hitMask - The hit mask to set bits in for intersecting rectangles.
+/// @return     True if any packed rectangles intersected; false otherwise.
+static bool FindIntersectingRectanglesAvx2(
+    const sf::FloatRect& rectangle,
+    const PackedRectangles& packedRectangles,
+    uint32_t* hitMask)
+{
+    // BROADCAST THE TESTED RECTANGLE'S EDGES ACROSS ALL LANES.
+    float rectangleRight = rectangle.left + rectangle.width;
+    float rectangleBottom = rectangle.top + rectangle.height;
+    __m256 rectangleLefts = _mm256_set1_ps(rectangle.left);
+    __m256 rectangleTops = _mm256_set1_ps(rectangle.top);
+    __m256 rectangleRights = _mm256_set1_ps(rectangleRight);
+    __m256 rectangleBottoms = _mm256_set1_ps(rectangleBottom);
+
+    // TEST FULL GROUPS OF PACKED RECTANGLES.
+    // The packed arrays aren't guaranteed to be 32-byte aligned, so unaligned loads are used.
+    const float* leftEdges = packedRectangles.GetLeftEdges();
+    const float* topEdges = packedRectangles.GetTopEdges();
+    const float* rightEdges = packedRectangles.GetRightEdges();
+    const float* bottomEdges = packedRectangles.GetBottomEdges();
+
+    const unsigned int RECTANGLES_PER_GROUP = 8;
+    unsigned int rectangleCount = packedRectangles.GetCount();
+    unsigned int fullGroupRectangleCount = rectangleCount - (rectangleCount % RECTANGLES_PER_GROUP);
+    uint32_t anyIntersectionBits = 0;
+    for (unsigned int index = 0; index < fullGroupRectangleCount; index += RECTANGLES_PER_GROUP)
+    {
+        __m256 horizontallyOverlapping = _mm256_and_ps(
+            _mm256_cmp_ps(_mm256_loadu_ps(leftEdges + index), rectangleRights, _CMP_LT_OQ),
+            _mm256_cmp_ps(rectangleLefts, _mm256_loadu_ps(rightEdges + index), _CMP_LT_OQ));
+        __m256 verticallyOverlapping = _mm256_and_ps(
+            _mm256_cmp_ps(_mm256_loadu_ps(topEdges + index), rectangleBottoms, _CMP_LT_OQ),
+            _mm256_cmp_ps(rectangleTops, _mm256_loadu_ps(bottomEdges + index), _CMP_LT_OQ));
+        __m256 intersecting = _mm256_and_ps(horizontallyOverlapping, verticallyOverlapping);
+
+        // Groups never straddle hit mask words since each word holds a whole number of groups.
+        uint32_t intersectionBits = static_cast<uint32_t>(_mm256_movemask_ps(intersecting));
+        unsigned int wordIndex = index / RECTANGLES_PER_HIT_MASK_WORD;
+        unsigned int bitIndex = index % RECTANGLES_PER_HIT_MASK_WORD;
+        hitMask[wordIndex] |= (intersectionBits << bitIndex);
+        anyIntersectionBits |= intersectionBits;
+    }
+
+    // TEST ANY REMAINING RECTANGLES INDIVIDUALLY.
+    bool anyRemainingIntersections = FindIntersectingRectanglesScalar(
+        rectangle.left,
+        rectangle.top,
+        rectangleRight,
+        rectangleBottom,
+        packedRectangles,
+        fullGroupRectangleCount,
+        hitMask);
+
+    bool anyIntersections = (0 != anyIntersectionBits) || anyRemainingIntersections;
+    return anyIntersections;
+}
+#endif
+
+bool PHYSICS::COLLISIONS::IsRectangleIntersectionImplementationAvailable(const RectangleIntersectionImplementation implementation)
+{
+    switch (implementation)
+    {
+    case RECTANGLE_INTERSECTION_SCALAR:
+        return true;
+    case RECTANGLE_INTERSECTION_SSE2:
+#if defined(RECTANGLE_INTERSECTION_SSE2_AVAILABLE)
+        return true;
+#else
+        return false;
+#endif
+    case RECTANGLE_INTERSECTION_AVX2:
+#if defined(RECTANGLE_INTERSECTION_AVX2_AVAILABLE)
+        return true;
+#else
+        return false;
+#endif
+    default:
+        return false;
+    }
+}
+
+RectangleIntersectionImplementation PHYSICS::COLLISIONS::GetFastestRectangleIntersectionImplementation()
+{
+#if defined(RECTANGLE_INTERSECTION_AVX2_AVAILABLE)
+    return RECTANGLE_INTERSECTION_AVX2;
+#elif defined(RECTANGLE_INTERSECTION_SSE2_AVAILABLE)
+    return RECTANGLE_INTERSECTION_SSE2;
+#else
+    return RECTANGLE_INTERSECTION_SCALAR;
+#endif
+}
+
+const char* PHYSICS::COLLISIONS::GetRectangleIntersectionImplementationName(const RectangleIntersectionImplementation implementation)
+{
+    switch (implementation)
+    {
+    case RECTANGLE_INTERSECTION_SCALAR:
+        return "Scalar";
+    case RECTANGLE_INTERSECTION_SSE2:
+        return "SSE2";
+    case RECTANGLE_INTERSECTION_AVX2:
+        return "AVX2";
+    default:
+        return "Unknown";
+    }
+}
+
+bool PHYSICS::COLLISIONS::FindIntersectingRectangles(
+    const sf::FloatRect& rectangle,
+    const PackedRectangles& packedRectangles,
+    std::vector<uint32_t>& hitMask)
+{
+    return FindIntersectingRectangles(
+        GetFastestRectangleIntersectionImplementation(),
+        rectangle,
+        packedRectangles,
+        hitMask);
+}
+
+bool PHYSICS::COLLISIONS::FindIntersectingRectangles(
+    const RectangleIntersectionImplementation implementation,
+    const sf::FloatRect& rectangle,
+    const PackedRectangles& packedRectangles,
+    std::vector<uint32_t>& hitMask)
+{
+    // CLEAR THE HIT MASK FOR ALL PACKED RECTANGLES.
+    unsigned int rectangleCount = packedRectangles.GetCount();
+    unsigned int hitMaskWordCount = (rectangleCount + RECTANGLES_PER_HIT_MASK_WORD - 1) / RECTANGLES_PER_HIT_MASK_WORD;
+    hitMask.assign(hitMaskWordCount, 0);
+
+    bool packedRectanglesExist = (rectangleCount > 0);
+    if (!packedRectanglesExist)
+    {
+        return false;
+    }
+
+    // TEST THE RECTANGLE USING THE REQUESTED IMPLEMENTATION.
+    switch (implementation)
+    {
+    case RECTANGLE_INTERSECTION_SCALAR:
+        return FindIntersectingRectanglesScalar(
+            rectangle.left,
+            rectangle.top,
+            rectangle.left + rectangle.width,
+            rectangle.top + rectangle.height,
+            packedRectangles,
+            0,
+            &hitMask[0]);
+#if defined(RECTANGLE_INTERSECTION_SSE2_AVAILABLE)
+    case RECTANGLE_INTERSECTION_SSE2:
+        return FindIntersectingRectanglesSse2(rectangle, packedRectangles, &hitMask[0]);
+#endif
+#if defined(RECTANGLE_INTERSECTION_AVX2_AVAILABLE)
+    case RECTANGLE_INTERSECTION_AVX2:
+        return FindIntersectingRectanglesAvx2(rectangle, packedRectangles, &hitMask[0]);
+#endif
+    default:
+        throw std::runtime_error(
+            std::string("Rectangle intersection implementation not available: ") +
+            GetRectangleIntersectionImplementationName(implementation));
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "Physics/Collisions/PackedRectangles.h"
+
+namespace PHYSICS
+{
+namespace COLLISIONS
+{
+    /// @brief  The number of rectangles whose results are stored in each word of a hit mask.
+    const unsigned int RECTANGLES_PER_HIT_MASK_WORD = 32;
+
+    ////////////////////////////////////////////////////////
+    /// @brief  The different implementations for testing a rectangle
+    ///         against packed rectangles.  Which SIMD implementations
+    ///         are available depends on the instruction sets enabled
+    ///         when compiling.
+    ////////////////////////////////////////////////////////
+    enum RectangleIntersectionImplementation
+    {
+        RECTANGLE_INTERSECTION_SCALAR = 0,  ///< Tests one rectangle at a time.  Always available.
+        RECTANGLE_INTERSECTION_SSE2,    ///< Tests 4 rectangles at a time with SSE2 instructions.
+        RECTANGLE_INTERSECTION_AVX2,    ///< Tests 8 rectangles at a time with AVX2-era instructions.
+        RECTANGLE_INTERSECTION_IMPLEMENTATION_COUNT ///< The number of implementations.  Not a valid implementation.
+    };
+
+    /// @brief      Checks if an implementation was compiled into the game.
+    /// @param[in]  implementation - The implementation to check.
+    /// @return     True if the implementation can be used; false otherwise.
+    bool IsRectangleIntersectionImplementationAvailable(const RectangleIntersectionImplementation implementation);
+
+    /// @brief      Gets the fastest implementation compiled into the game.
+    /// @return     The fastest available implementation.
+    RectangleIntersectionImplementation GetFastestRectangleIntersectionImplementation();
+
+    /// @brief      Gets a displayable name for an implementation.
+    /// @param[in]  implementation - The implementation to get the name of.
+    /// @return     The name of the implementation.
+    const char* GetRectangleIntersectionImplementationName(const RectangleIntersectionImplementation implementation);
+
+    /// @brief      Tests a single rectangle against many packed rectangles using the
+    ///             fastest available implementation.  Rectangles that only touch
+    ///             along an edge are not considered intersecting, matching sf::Rect.
+    /// @param[in]  rectangle - The rectangle to test.
+    /// @param[in]  packedRectangles - The rectangles to test against.
+    /// @param[out] hitMask - A bit for each packed rectangle, set if it intersects the tested
+    ///             rectangle.  The bit for the packed rectangle at index i is bit
+    ///             (i % RECTANGLES_PER_HIT_MASK_WORD) of word (i / RECTANGLES_PER_HIT_MASK_WORD).
+    ///             Resized to fit all packed rectangles.
+    /// @return     True if any packed rectangles intersect the tested rectangle; false otherwise.
+    bool FindIntersectingRectangles(
+        const sf::FloatRect& rectangle,
+        const PackedRectangles& packedRectangles,
+        std::vector<uint32_t>& hitMask);
+
+    /// @brief      Tests a single rectangle against many packed rectangles using a specific
+    ///             implementation.  Intended for comparing implementations.
+    ///             An exception is thrown if the implementation is not available.
+    /// @param[in]  implementation - The implementation to use.
+    /// @param[in]  rectangle - The rectangle to test.
+    /// @param[in]  packedRectangles - The rectangles to test against.
+    /// @param[out] hitMask - A bit for each packed rectangle, set if it intersects the tested
+    ///             rectangle.  Resized to fit all packed rectangles.
+    /// @return     True if any packed rectangles intersect the tested rectangle; false otherwise.
+    bool FindIntersectingRectangles(
+        const RectangleIntersectionImplementation implementation,
+        const sf::FloatRect& rectangle,
+        const PackedRectangles& packedRectangles,
+        std::vector<uint32_t>& hitMask);
+}
+}
@@ -0,0 +1,178 @@
+#include <cmath>
+#include "Physics/Collisions/SpatialGrid.h"
+
+using namespace PHYSICS::COLLISIONS;
+
+SpatialGrid::SpatialGrid(const sf::FloatRect& worldBoundsInPixels, const float cellSizeInPixels) :
+    m_worldBoundsInPixels(worldBoundsInPixels),
+    m_cellSizeInPixels(cellSizeInPixels),
+    m_columnCount(),
+    m_rowCount(),
+    m_entries(),
+    m_cells()
+{
+    // CREATE ENOUGH CELLS TO COVER THE WORLD.
+    // At least one cell always exists so that every object has somewhere to go.
+    m_columnCount = static_cast<unsigned int>(std::ceil(worldBoundsInPixels.width / cellSizeInPixels));
+    m_rowCount = static_cast<unsigned int>(std::ceil(worldBoundsInPixels.height / cellSizeInPixels));
+    m_columnCount = (m_columnCount > 0) ? m_columnCount : 1;
+    m_rowCount = (m_rowCount > 0) ? m_rowCount : 1;
+    m_cells.resize(m_columnCount * m_rowCount);
+}
+
+SpatialGrid::~SpatialGrid()
+{
+    // Nothing to do.
+}
+
+void SpatialGrid::Clear()
+{
+    // CLEAR ALL ENTRIES WHILE KEEPING THEIR MEMORY FOR REUSE.
+    m_entries.clear();
+    for (std::vector<unsigned int>& cell : m_cells)
+    {
+        cell.clear();
+    }
+}
+
+void SpatialGrid::Insert(
+    const sf::FloatRect& boundingRectangle,
+    const CollisionLayer layer,
+    const CollisionLayerMask collisionMask,
+    const unsigned int objectId)
+{
+    // ADD THE ENTRY FOR THE OBJECT.
+    Entry entry;
+    entry.BoundingRectangle = boundingRectangle;
+    entry.Layer = layer;
+    entry.CollisionMask = collisionMask;
+    entry.ObjectId = objectId;
+
+    unsigned int entryIndex = static_cast<unsigned int>(m_entries.size());
+    m_entries.push_back(entry);
+
+    // ADD THE ENTRY TO EACH CELL THAT IT OVERLAPS.
+    unsigned int firstColumn = 0;
+    unsigned int firstRow = 0;
+    unsigned int lastColumn = 0;
+    unsigned int lastRow = 0;
+    GetCellRange(boundingRectangle, firstColumn, firstRow, lastColumn, lastRow);
+    for (unsigned int row = firstRow; row <= lastRow; ++row)
+    {
+        for (unsigned int column = firstColumn; column <= lastColumn; ++column)
+        {
+            unsigned int cellIndex = (row * m_columnCount) + column;
+            m_cells[cellIndex].push_back(entryIndex);
+        }
+    }
+}
+
+void SpatialGrid::FindCollisionPairs(std::vector<CollisionPair>& collisionPairs) const
+{
+    // CHECK EACH CELL FOR COLLIDING OBJECTS.
+    for (unsigned int row = 0; row < m_rowCount; ++row)
+    {
+        for (unsigned int column = 0; column < m_columnCount; ++column)
+        {
+            // CHECK EACH PAIR OF OBJECTS IN THE CELL.
+            unsigned int cellIndex = (row * m_columnCount) + column;
+            const std::vector<unsigned int>& cell = m_cells[cellIndex];
+            for (unsigned int firstCellEntryIndex = 0; firstCellEntryIndex < cell.size(); ++firstCellEntryIndex)
+            {
+                const Entry& firstEntry = m_entries[cell[firstCellEntryIndex]];
+                for (unsigned int secondCellEntryIndex = firstCellEntryIndex + 1; secondCellEntryIndex < cell.size(); ++secondCellEntryIndex)
+                {
+                    const Entry& secondEntry = m_entries[cell[secondCellEntryIndex]];
+
+                    // Skip objects in layers that don't interact before doing any geometry.
+                    bool firstCollidesWithSecond = (0 != (firstEntry.CollisionMask & GetCollisionLayerMask(secondEntry.Layer)));
+                    bool secondCollidesWithFirst = (0 != (secondEntry.CollisionMask & GetCollisionLayerMask(firstEntry.Layer)));
+                    bool layersInteract = (firstCollidesWithSecond || secondCollidesWithFirst);
+                    if (!layersInteract)
+                    {
+                        continue;
+                    }
+
+                    // Skip objects that don't actually intersect.
+                    sf::FloatRect intersection;
+                    bool objectsIntersect = firstEntry.BoundingRectangle.intersects(secondEntry.BoundingRectangle, intersection);
+                    if (!objectsIntersect)
+                    {
+                        continue;
+                    }
+
+                    // Only report the pair from the cell containing the top-left corner of their
+                    // intersection so that objects sharing multiple cells are reported once.
+                    unsigned int intersectionColumn = ToCellCoordinate(intersection.left, m_worldBoundsInPixels.left, m_columnCount);
+                    unsigned int intersectionRow = ToCellCoordinate(intersection.top, m_worldBoundsInPixels.top, m_rowCount);
+                    bool intersectionStartsInCell = (column == intersectionColumn && row == intersectionRow);
+                    if (!intersectionStartsInCell)
+                    {
+                        continue;
+                    }
+
+                    // Report the pair with the object in the lower layer first.
+                    bool firstEntryInLowerLayer = (firstEntry.Layer <= secondEntry.Layer);
+                    const Entry& lowerLayerEntry = firstEntryInLowerLayer ? firstEntry : secondEntry;
+                    const Entry& higherLayerEntry = firstEntryInLowerLayer ? secondEntry : firstEntry;
+
+                    CollisionPair collisionPair;
+                    collisionPair.FirstLayer = lowerLayerEntry.Layer;
+                    collisionPair.FirstObjectId = lowerLayerEntry.ObjectId;
+                    collisionPair.FirstBoundingRectangle = lowerLayerEntry.BoundingRectangle;
+                    collisionPair.SecondLayer = higherLayerEntry.Layer;
+                    collisionPair.SecondObjectId = higherLayerEntry.ObjectId;
+                    collisionPair.SecondBoundingRectangle = higherLayerEntry.BoundingRectangle;
+                    collisionPairs.push_back(collisionPair);
+                }
+            }
+        }
+    }
+}
+
+unsigned int SpatialGrid::GetObjectCount() const
+{
+    return static_cast<unsigned int>(m_entries.size());
+}
+
+void SpatialGrid::GetCellRange(
+    const sf::FloatRect& boundingRectangle,
+    unsigned int& firstColumn,
+    unsigned int& firstRow,
+    unsigned int& lastColumn,
+    unsigned int& lastRow) const
+{
+    float rightPosition = boundingRectangle.left + boundingRectangle.width;
+    float bottomPosition = boundingRectangle.top + boundingRectangle.height;
+
+    firstColumn = ToCellCoordinate(boundingRectangle.left, m_worldBoundsInPixels.left, m_columnCount);
+    lastColumn = ToCellCoordinate(rightPosition, m_worldBoundsInPixels.left, m_columnCount);
+    firstRow = ToCellCoordinate(boundingRectangle.top, m_worldBoundsInPixels.top, m_rowCount);
+    lastRow = ToCellCoordinate(bottomPosition, m_worldBoundsInPixels.top, m_rowCount);
+}
+
+unsigned int SpatialGrid::ToCellCoordinate(
+    const float positionInPixels,
+    const float gridStartInPixels,
+    const unsigned int cellCount) const
+{
+    // CALCULATE THE CELL CONTAINING THE POSITION.
+    float cellPosition = std::floor((positionInPixels - gridStartInPixels) / m_cellSizeInPixels);
+
+    // CLAMP THE CELL TO THE GRID.
+    // Positions outside of the world are placed in the nearest edge cell.
+    bool beforeFirstCell = (cellPosition < 0.0f);
+    if (beforeFirstCell)
+    {
+        return 0;
+    }
+
+    unsigned int lastCellCoordinate = cellCount - 1;
+    bool afterLastCell = (cellPosition > static_cast<float>(lastCellCoordinate));
+    if (afterLastCell)
+    {
+        return lastCellCoordinate;
+    }
+
+    return static_cast<unsigned int>(cellPosition);
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "Physics/Collisions/CollisionLayer.h"
+#include "Physics/Collisions/CollisionPair.h"
+
+namespace PHYSICS
+{
+namespace COLLISIONS
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  A uniform grid of square cells covering the world,
+    ///         used to quickly find objects that may be overlapping
+    ///         without testing every object against every other object.
+    ///
+    ///         Objects are identified by an ID chosen by the caller,
+    ///         along with a collision layer and the mask of layers that
+    ///         they collide with.
+    ///         The grid is intended to be cleared and refilled each
+    ///         simulation update.  Cell storage is retained across
+    ///         clears so that refilling doesn't allocate memory once
+    ///         the grid has warmed up.
+    ////////////////////////////////////////////////////////
+    class SpatialGrid
+    {
+    public:
+        /// @brief      Constructor.
+        /// @param[in]  worldBoundsInPixels - The area covered by the grid.  Objects partially
+        ///             or entirely outside of this area are placed in the nearest edge cells.
+        /// @param[in]  cellSizeInPixels - The width and height of each cell.
+        explicit SpatialGrid(const sf::FloatRect& worldBoundsInPixels, const float cellSizeInPixels);
+
+        /// @brief  Destructor.
+        ~SpatialGrid();
+
+        /// @brief  Removes all objects from the grid.
+        void Clear();
+
+        /// @brief      Inserts an object into every cell that its bounding rectangle overlaps.
+        /// @param[in]  boundingRectangle - The bounding rectangle of the object (in pixels).
+        /// @param[in]  layer - The collision layer of the object.
+        /// @param[in]  collisionMask - The layers that the object collides with.
+        /// @param[in]  objectId - The caller-defined ID of the object.
+        void Insert(
+            const sf::FloatRect& boundingRectangle,
+            const CollisionLayer layer,
+            const CollisionLayerMask collisionMask,
+            const unsigned int objectId);
+
+        /// @brief          Finds all pairs of objects whose bounding rectangles intersect and whose
+        ///                 layers collide with each other.  Only objects sharing a cell are tested,
+        ///                 and each pair is reported once even if the objects share multiple cells.
+        /// @param[in,out]  collisionPairs - The colliding pairs are appended.
+        ///                 The container is not cleared first.
+        void FindCollisionPairs(std::vector<CollisionPair>& collisionPairs) const;
+
+        /// @brief  Gets the number of objects in the grid.
+        /// @return The number of objects inserted since the grid was last cleared.
+        unsigned int GetObjectCount() const;
+
+    private:
+        SpatialGrid(const SpatialGrid& gridToCopy); ///< Private to disallow copying.
+        SpatialGrid& operator= (const SpatialGrid& rhsGrid);    ///< Private to disallow assignment.
+
+        ////////////////////////////////////////////////////////
+        /// @brief  An object inserted into the grid.
+        ////////////////////////////////////////////////////////
+        struct Entry
+        {
+            sf::FloatRect BoundingRectangle;    ///< The bounding rectangle of the object.
+            CollisionLayer Layer;   ///< The collision layer of the object.
+            CollisionLayerMask CollisionMask;   ///< The layers that the object collides with.
+            unsigned int ObjectId;  ///< The caller-defined ID of the object.
+        };
+
+        /// @brief          Gets the range of cells overlapped by a rectangle, clamped to the grid.
+        /// @param[in]      boundingRectangle - The rectangle to get the cells for.
+        /// @param[out]     firstColumn - The left-most overlapped column.
+        /// @param[out]     firstRow - The top-most overlapped row.
+        /// @param[out]     lastColumn - The right-most overlapped column.
+        /// @param[out]     lastRow - The bottom-most overlapped row.
+        void GetCellRange(
+            const sf::FloatRect& boundingRectangle,
+            unsigned int& firstColumn,
+            unsigned int& firstRow,
+            unsigned int& lastColumn,
+            unsigned int& lastRow) const;
+
+        /// @brief      Converts a position along one axis to a cell coordinate, clamped to the grid.
+        /// @param[in]  positionInPixels - The position along the axis.
+        /// @param[in]  gridStartInPixels - The start of the grid along the axis.
+        /// @param[in]  cellCount - The number of cells along the axis.
+        /// @return     The cell coordinate along the axis.
+        unsigned int ToCellCoordinate(
+            const float positionInPixels,
+            const float gridStartInPixels,
+            const unsigned int cellCount) const;
+
+        sf::FloatRect m_worldBoundsInPixels;    ///< The area covered by the grid.
+        float m_cellSizeInPixels;   ///< The width and height of each cell.
+        unsigned int m_columnCount; ///< The number of columns of cells.
+        unsigned int m_rowCount;    ///< The number of rows of cells.
+        std::vector<Entry> m_entries;   ///< The objects in the grid.
+        std::vector< std::vector<unsigned int> > m_cells;   ///< The indices of entries overlapping each cell, in row-major order.
+    };
+}
+}
@@ -0,0 +1,243 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+#include "Profiling/AllocationTracker.h"
+
+using namespace PROFILING;
+
+// GLOBAL ALLOCATION HOOKS.
+// The global allocation operators are only replaced in builds with profiling enabled
+// so that other builds allocate without any overhead.
+#if defined PROFILING_ENABLED
+
+void* operator new(std::size_t byteCount)
+{
+    AllocationTracker::GetInstance().RecordAllocation(byteCount);
+
+    // A unique pointer must be returned even for empty allocations.
+    std::size_t allocatedByteCount = std::max<std::size_t>(byteCount, 1);
+    void* memory = std::malloc(allocatedByteCount);
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void* operator new[](std::size_t byteCount)
+{
+    return operator new(byteCount);
+}
+
+void operator delete(void* memory) throw()
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) throw()
+{
+    std::free(memory);
+}
+
+// Sized deallocation is replaced too so that compilers supporting it don't bypass the
+// replaced operators above, which would free memory from malloc() with the default delete.
+void operator delete(void* memory, std::size_t) throw()
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) throw()
+{
+    std::free(memory);
+}
+
+#endif
+
+// STATIC METHODS.
+
+AllocationTracker& AllocationTracker::GetInstance()
+{
+    static AllocationTracker tracker;
+    return tracker;
+}
+
+const char* AllocationTracker::GetCategoryName(const AllocationCategory category)
+{
+    switch (category)
+    {
+    case ALLOCATION_CATEGORY_UNCATEGORIZED:
+        return "Uncategorized";
+    case ALLOCATION_CATEGORY_SPRITES:
+        return "Sprites";
+    case ALLOCATION_CATEGORY_ALIENS:
+        return "Aliens";
+    case ALLOCATION_CATEGORY_MISSILES:
+        return "Missiles";
+    case ALLOCATION_CATEGORY_EXPLOSIONS:
+        return "Explosions";
+    case ALLOCATION_CATEGORY_SOUNDS:
+        return "Sounds";
+    case ALLOCATION_CATEGORY_TIMERS:
+        return "Timers";
+    case ALLOCATION_CATEGORY_RESOURCES:
+        return "Resources";
+    case ALLOCATION_CATEGORY_TEXT:
+        return "Text";
+    default:
+        return "Unknown";
+    }
+}
+
+// INSTANCE METHODS.
+
+AllocationTracker::AllocationTracker() :
+    m_trackedThreadId(std::this_thread::get_id()),
+    m_currentPhase(PROFILED_PHASE_COUNT),
+    m_currentCategory(ALLOCATION_CATEGORY_UNCATEGORIZED),
+    m_totalCounts(),
+    m_currentFrameCounts(),
+    m_previousFrameCounts(),
+    m_maxFrameCounts(),
+    m_frameCount(0),
+    m_framesWithAllocationsCount(0),
+    m_countsByPhase(),
+    m_countsByCategory()
+{
+    // Nothing else to do.
+}
+
+AllocationTracker::~AllocationTracker()
+{
+    // Nothing to do.
+}
+
+void AllocationTracker::RecordAllocation(const std::size_t byteCount)
+{
+    // CHECK IF THE ALLOCATION IS ON THE TRACKED THREAD.
+    bool onTrackedThread = (m_trackedThreadId == std::this_thread::get_id());
+    if (!onTrackedThread)
+    {
+        return;
+    }
+
+    // COUNT THE ALLOCATION EVERYWHERE IT IS ATTRIBUTED TO.
+    AllocationCounts* attributedCounts[] = 
+    {
+        &m_totalCounts,
+        &m_currentFrameCounts,
+        &m_countsByPhase[m_currentPhase],
+        &m_countsByCategory[m_currentCategory]
+    };
+    for (AllocationCounts* counts : attributedCounts)
+    {
+        ++counts->AllocationCount;
+        counts->ByteCount += byteCount;
+    }
+}
+
+ProfiledPhase AllocationTracker::EnterPhase(const ProfiledPhase phase)
+{
+    ProfiledPhase previousPhase = m_currentPhase;
+    m_currentPhase = phase;
+    return previousPhase;
+}
+
+void AllocationTracker::ExitPhase(const ProfiledPhase previousPhase)
+{
+    m_currentPhase = previousPhase;
+}
+
+AllocationCategory AllocationTracker::EnterCategory(const AllocationCategory category)
+{
+    AllocationCategory previousCategory = m_currentCategory;
+    m_currentCategory = category;
+    return previousCategory;
+}
+
+void AllocationTracker::ExitCategory(const AllocationCategory previousCategory)
+{
+    m_currentCategory = previousCategory;
+}
+
+const AllocationCounts& AllocationTracker::GetTotalCounts() const
+{
+    return m_totalCounts;
+}
+
+const AllocationCounts& AllocationTracker::GetPreviousFrameCounts() const
+{
+    return m_previousFrameCounts;
+}
+
+void AllocationTracker::EndFrame()
+{
+    // RECORD THE ALLOCATIONS OF THE FRAME.
+    bool frameAllocated = (m_currentFrameCounts.AllocationCount > 0);
+    if (frameAllocated)
+    {
+        ++m_framesWithAllocationsCount;
+    }
+    m_maxFrameCounts.AllocationCount = std::max(m_maxFrameCounts.AllocationCount, m_currentFrameCounts.AllocationCount);
+    m_maxFrameCounts.ByteCount = std::max(m_maxFrameCounts.ByteCount, m_currentFrameCounts.ByteCount);
+    ++m_frameCount;
+
+    // RESET THE COUNTS FOR THE NEXT FRAME.
+    m_previousFrameCounts = m_currentFrameCounts;
+    m_currentFrameCounts = AllocationCounts();
+}
+
+// Helper constants for formatting report columns.
+static const int NAME_COLUMN_WIDTH = 34;
+static const int NUMBER_COLUMN_WIDTH = 14;
+
+void AllocationTracker::WriteReport(std::ostream& output) const
+{
+    // WRITE THE ALLOCATIONS PER FRAME.
+    output << "Heap allocations (" << m_frameCount << " frames, "
+        << m_framesWithAllocationsCount << " with allocations, main thread only)" << std::endl;
+    output << std::left << std::setw(NAME_COLUMN_WIDTH) << "Source" << std::right
+        << std::setw(NUMBER_COLUMN_WIDTH) << "Allocations"
+        << std::setw(NUMBER_COLUMN_WIDTH) << "Bytes" << std::endl;
+
+    WriteCounts("Total", m_totalCounts, output);
+
+    AllocationCounts averageFrameCounts;
+    bool framesEnded = (m_frameCount > 0);
+    if (framesEnded)
+    {
+        averageFrameCounts.AllocationCount = m_totalCounts.AllocationCount / m_frameCount;
+        averageFrameCounts.ByteCount = m_totalCounts.ByteCount / m_frameCount;
+    }
+    WriteCounts("Average frame", averageFrameCounts, output);
+    WriteCounts("Max frame", m_maxFrameCounts, output);
+
+    // WRITE THE ALLOCATIONS IN EACH PHASE.
+    output << "By phase" << std::endl;
+    for (unsigned int phaseIndex = 0; phaseIndex < PROFILED_PHASE_COUNT; ++phaseIndex)
+    {
+        ProfiledPhase phase = static_cast<ProfiledPhase>(phaseIndex);
+        std::string phaseName = "  ";
+        phaseName += FrameProfiler::GetPhaseName(phase);
+        WriteCounts(phaseName, m_countsByPhase[phaseIndex], output);
+    }
+    WriteCounts("  Outside phases", m_countsByPhase[PROFILED_PHASE_COUNT], output);
+
+    // WRITE THE ALLOCATIONS IN EACH CATEGORY.
+    output << "By category" << std::endl;
+    for (unsigned int categoryIndex = 0; categoryIndex < ALLOCATION_CATEGORY_COUNT; ++categoryIndex)
+    {
+        AllocationCategory category = static_cast<AllocationCategory>(categoryIndex);
+        std::string categoryName = "  ";
+        categoryName += GetCategoryName(category);
+        WriteCounts(categoryName, m_countsByCategory[categoryIndex], output);
+    }
+}
+
+void AllocationTracker::WriteCounts(const std::string& name, const AllocationCounts& counts, std::ostream& output)
+{
+    output << std::left << std::setw(NAME_COLUMN_WIDTH) << name << std::right
+        << std::setw(NUMBER_COLUMN_WIDTH) << counts.AllocationCount
+        << std::setw(NUMBER_COLUMN_WIDTH) << counts.ByteCount << std::endl;
+}
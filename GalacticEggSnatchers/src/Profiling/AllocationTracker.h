@@ -0,0 +1,142 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <thread>
+#include "Profiling/FrameProfiler.h"
+
+namespace PROFILING
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  The kinds of code that heap allocations may be
+    ///         attributed to, identifying where they came from
+    ///         independently of the phase they occurred in.
+    ////////////////////////////////////////////////////////
+    enum AllocationCategory
+    {
+        ALLOCATION_CATEGORY_UNCATEGORIZED = 0,  ///< Code not marked with any category.
+        ALLOCATION_CATEGORY_SPRITES,    ///< Creating sprites for game objects.
+        ALLOCATION_CATEGORY_ALIENS, ///< Adding aliens.
+        ALLOCATION_CATEGORY_MISSILES,   ///< Firing missiles.
+        ALLOCATION_CATEGORY_EXPLOSIONS, ///< Creating explosions.
+        ALLOCATION_CATEGORY_SOUNDS, ///< Playing sounds.
+        ALLOCATION_CATEGORY_TIMERS, ///< Scheduling timers.
+        ALLOCATION_CATEGORY_RESOURCES,  ///< Looking up or loading resources.
+        ALLOCATION_CATEGORY_TEXT,   ///< Formatting text for display.
+        ALLOCATION_CATEGORY_COUNT   ///< The number of allocation categories.  Not a valid category.
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  The number and total size of heap allocations.
+    ////////////////////////////////////////////////////////
+    struct AllocationCounts
+    {
+        uint64_t AllocationCount;   ///< The number of allocations.
+        uint64_t ByteCount; ///< The total number of bytes allocated.
+
+        /// @brief  Constructor.  Initializes counts for no allocations.
+        AllocationCounts() :
+            AllocationCount(0),
+            ByteCount(0)
+        {}
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  Counts heap allocations made through the global
+    ///         operator new, which is replaced in builds with
+    ///         profiling enabled.  Each allocation is attributed to
+    ///         the frame, the innermost profiled phase, and the
+    ///         innermost allocation category it occurred in.
+    ///
+    ///         Only allocations on the thread that first allocated
+    ///         (the main thread) are counted, since phases and
+    ///         categories are only marked there.  Counting never
+    ///         allocates, so it can't recursively count itself.
+    ///
+    ///         The macros in Profiling.h should be used for marking
+    ///         categories so that tracking can be compiled out entirely.
+    ////////////////////////////////////////////////////////
+    class AllocationTracker
+    {
+    public:
+        /// @brief  Gets the single allocation tracker for the game.
+        /// @return The allocation tracker.
+        static AllocationTracker& GetInstance();
+
+        /// @brief      Gets the displayable name of an allocation category.
+        /// @param[in]  category - The category to get the name of.
+        /// @return     The name of the category.
+        static const char* GetCategoryName(const AllocationCategory category);
+
+        /// @brief  Destructor.
+        ~AllocationTracker();
+
+        /// @brief      Counts an allocation if it was made on the tracked thread.
+        /// @param[in]  byteCount - The number of bytes allocated.
+        void RecordAllocation(const std::size_t byteCount);
+
+        /// @brief      Makes a phase the one that allocations are attributed to.
+        /// @param[in]  phase - The phase being entered.
+        /// @return     The phase that allocations were previously attributed to, which
+        ///             should be restored with ExitPhase() when the phase ends.
+        ///             PROFILED_PHASE_COUNT if no phase was active.
+        ProfiledPhase EnterPhase(const ProfiledPhase phase);
+
+        /// @brief      Restores the phase that allocations are attributed to.
+        /// @param[in]  previousPhase - The phase returned when entering the phase that ended.
+        void ExitPhase(const ProfiledPhase previousPhase);
+
+        /// @brief      Makes a category the one that allocations are attributed to.
+        /// @param[in]  category - The category being entered.
+        /// @return     The category that allocations were previously attributed to, which
+        ///             should be restored with ExitCategory() when the category ends.
+        AllocationCategory EnterCategory(const AllocationCategory category);
+
+        /// @brief      Restores the category that allocations are attributed to.
+        /// @param[in]  previousCategory - The category returned when entering the category that ended.
+        void ExitCategory(const AllocationCategory previousCategory);
+
+        /// @brief  Gets the counts of all allocations on the tracked thread so far.
+        /// @return The total allocation counts.
+        const AllocationCounts& GetTotalCounts() const;
+
+        /// @brief  Gets the counts of allocations during the most recently ended frame.
+        /// @return The allocation counts of the previous frame.
+        const AllocationCounts& GetPreviousFrameCounts() const;
+
+        /// @brief  Ends the current frame, recording its allocation counts.
+        void EndFrame();
+
+        /// @brief          Writes a report of allocations per frame, per phase, and per category.
+        /// @param[in,out]  output - The stream to write the report to.
+        void WriteReport(std::ostream& output) const;
+
+    private:
+        /// @brief  Constructor.  Private since only a single tracker should exist.
+        ///         Tracks allocations on the calling thread.
+        explicit AllocationTracker();
+        AllocationTracker(const AllocationTracker& trackerToCopy);  ///< Private to disallow copying.
+        AllocationTracker& operator= (const AllocationTracker& rhsTracker); ///< Private to disallow assignment.
+
+        /// @brief          Writes a single row of the report for allocation counts.
+        /// @param[in]      name - The name of the row.
+        /// @param[in]      counts - The allocation counts for the row.
+        /// @param[in,out]  output - The stream to write the row to.
+        static void WriteCounts(const std::string& name, const AllocationCounts& counts, std::ostream& output);
+
+        std::thread::id m_trackedThreadId;  ///< The thread whose allocations are counted.
+        ProfiledPhase m_currentPhase;   ///< The phase allocations are attributed to.  PROFILED_PHASE_COUNT if none.
+        AllocationCategory m_currentCategory;   ///< The category allocations are attributed to.
+        AllocationCounts m_totalCounts; ///< Counts of all allocations.
+        AllocationCounts m_currentFrameCounts;  ///< Counts of allocations during the current frame.
+        AllocationCounts m_previousFrameCounts; ///< Counts of allocations during the most recently ended frame.
+        AllocationCounts m_maxFrameCounts;  ///< The most allocations and bytes allocated during any single frame.
+        unsigned int m_frameCount;  ///< The number of frames that have ended.
+        unsigned int m_framesWithAllocationsCount;  ///< The number of frames that allocated at all.
+        std::array<AllocationCounts, PROFILED_PHASE_COUNT + 1> m_countsByPhase; ///< Counts of allocations in each phase, with the last for allocations outside any phase.
+        std::array<AllocationCounts, ALLOCATION_CATEGORY_COUNT> m_countsByCategory; ///< Counts of allocations in each category.
+    };
+}
@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "Profiling/FlightRecorder.h"
+
+using namespace PROFILING;
+
+// STATIC CONSTANT INITIALIZATION.
+const sf::Time FlightRecorder::DEFAULT_HITCH_BUDGET = sf::microseconds(2 * 1000000 / 60);
+const std::string FlightRecorder::RECORDING_FILEPATH_PREFIX = "hitchRecording";
+
+// Helper constants for formatting recording columns.
+static const int NUMBER_COLUMN_WIDTH = 10;
+static const int PHASE_COLUMN_PADDING = 2;
+
+// METHOD IMPLEMENTATION.
+
+FlightRecorder& FlightRecorder::GetInstance()
+{
+    static FlightRecorder recorder;
+    return recorder;
+}
+
+FlightRecorder::FlightRecorder() :
+    m_hitchBudget(DEFAULT_HITCH_BUDGET),
+    m_frameClock(),
+    m_recordedFrames(RECORDED_FRAME_COUNT),
+    m_nextRecordedFrameIndex(0),
+    m_recordedFrameCount(0),
+    m_frameCount(0),
+    m_framesSinceRecordingWrittenCount(RECORDED_FRAME_COUNT),
+    m_currentFrame()
+{
+    // Nothing else to do.
+}
+
+FlightRecorder::~FlightRecorder()
+{
+    // Nothing to do.
+}
+
+void FlightRecorder::SetHitchBudget(const sf::Time& hitchBudget)
+{
+    m_hitchBudget = hitchBudget;
+}
+
+void FlightRecorder::AddMarker(const char* name)
+{
+    // RECORD THE MARKER IF THERE IS ROOM.
+    // Markers beyond the limit are still counted so that the recording shows some were missed.
+    bool markerFits = (m_currentFrame.MarkerCount < RecordedFrame::MAX_MARKER_COUNT);
+    if (markerFits)
+    {
+        FrameMarker& marker = m_currentFrame.Markers[m_currentFrame.MarkerCount];
+        marker.Name = name;
+        marker.TimeInFrame = m_frameClock.getElapsedTime();
+    }
+
+    ++m_currentFrame.MarkerCount;
+}
+
+void FlightRecorder::EndFrame(
+    const sf::Time& frameTime,
+    const std::array<sf::Time, PROFILED_PHASE_COUNT>& phaseTimes,
+    const uint64_t allocationCount)
+{
+    // RECORD THE FRAME, REPLACING THE OLDEST ONE.
+    m_currentFrame.FrameIndex = m_frameCount;
+    m_currentFrame.FrameTime = frameTime;
+    m_currentFrame.PhaseTimes = phaseTimes;
+    m_currentFrame.AllocationCount = allocationCount;
+    RecordedFrame& recordedFrame = m_recordedFrames[m_nextRecordedFrameIndex];
+    recordedFrame = m_currentFrame;
+    m_nextRecordedFrameIndex = (m_nextRecordedFrameIndex + 1) % RECORDED_FRAME_COUNT;
+
+    bool recordedFramesFull = (m_recordedFrameCount >= RECORDED_FRAME_COUNT);
+    if (!recordedFramesFull)
+    {
+        ++m_recordedFrameCount;
+    }
+
+    // START THE NEXT FRAME.
+    bool firstFrame = (0 == m_frameCount);
+    ++m_frameCount;
+    m_currentFrame = RecordedFrame();
+    m_frameClock.restart();
+
+    // WRITE THE RECORDING IF THE FRAME WAS A HITCH.
+    // Recordings are only written once the ring buffer holds frames not in a previous
+    // recording, so that writing one doesn't cause a cascade of recordings.
+    bool recordingRecentlyWritten = (m_framesSinceRecordingWrittenCount < RECORDED_FRAME_COUNT);
+    ++m_framesSinceRecordingWrittenCount;
+    bool hitchOccurred = !firstFrame && (frameTime > m_hitchBudget);
+    if (hitchOccurred && !recordingRecentlyWritten)
+    {
+        WriteRecordingFile(recordedFrame);
+        m_framesSinceRecordingWrittenCount = 0;
+
+        // Time spent writing the recording is excluded from the times of the next frame's markers.
+        m_frameClock.restart();
+    }
+}
+
+void FlightRecorder::WriteRecording(std::ostream& output) const
+{
+    // WRITE THE HEADER.
+    output << "Flight recording (" << m_recordedFrameCount << " frames, times in microseconds, hitch budget "
+        << m_hitchBudget.asMicroseconds() << ")" << std::endl;
+    output << std::setw(NUMBER_COLUMN_WIDTH) << "Frame"
+        << std::setw(NUMBER_COLUMN_WIDTH) << "Time";
+    for (unsigned int phaseIndex = 0; phaseIndex < PROFILED_PHASE_COUNT; ++phaseIndex)
+    {
+        const char* phaseName = FrameProfiler::GetPhaseName(static_cast<ProfiledPhase>(phaseIndex));
+        int phaseColumnWidth = static_cast<int>(std::strlen(phaseName)) + PHASE_COLUMN_PADDING;
+        output << std::setw(phaseColumnWidth) << phaseName;
+    }
+    output << std::setw(NUMBER_COLUMN_WIDTH + PHASE_COLUMN_PADDING) << "Allocations" << "  Markers" << std::endl;
+
+    // WRITE EACH FRAME FROM OLDEST TO NEWEST.
+    unsigned int oldestRecordedFrameIndex = (m_nextRecordedFrameIndex + RECORDED_FRAME_COUNT - m_recordedFrameCount) % RECORDED_FRAME_COUNT;
+    for (unsigned int frameOffset = 0; frameOffset < m_recordedFrameCount; ++frameOffset)
+    {
+        unsigned int recordedFrameIndex = (oldestRecordedFrameIndex + frameOffset) % RECORDED_FRAME_COUNT;
+        WriteFrame(m_recordedFrames[recordedFrameIndex], output);
+    }
+}
+
+void FlightRecorder::WriteRecordingFile(const RecordedFrame& hitchFrame) const
+{
+    // CREATE A FILE NAMED FOR THE HITCH FRAME.
+    // Each hitch gets its own file so that earlier recordings aren't overwritten.
+    std::ostringstream recordingFilepath;
+    recordingFilepath << RECORDING_FILEPATH_PREFIX << hitchFrame.FrameIndex << ".txt";
+    std::ofstream recordingFile(recordingFilepath.str());
+
+    // WRITE THE RECORDING.
+    recordingFile << "Hitch at frame " << hitchFrame.FrameIndex << " (" << hitchFrame.FrameTime.asMicroseconds() << " us)" << std::endl;
+    WriteRecording(recordingFile);
+
+    bool recordingWritten = recordingFile.good();
+    if (recordingWritten)
+    {
+        std::cout << "Hitch of " << hitchFrame.FrameTime.asMicroseconds() << " us at frame " << hitchFrame.FrameIndex
+            << " recorded to " << recordingFilepath.str() << std::endl;
+    }
+    else
+    {
+        std::cerr << "Error writing hitch recording: " << recordingFilepath.str() << std::endl;
+    }
+}
+
+void FlightRecorder::WriteFrame(const RecordedFrame& frame, std::ostream& output) const
+{
+    // WRITE THE TIMINGS.
+    // Hitch frames are flagged so that they're easy to find.  As when writing recordings,
+    // the first frame is never considered a hitch.
+    bool firstFrame = (0 == frame.FrameIndex);
+    bool hitchFrame = !firstFrame && (frame.FrameTime > m_hitchBudget);
+    output << std::setw(NUMBER_COLUMN_WIDTH) << frame.FrameIndex
+        << std::setw(NUMBER_COLUMN_WIDTH) << frame.FrameTime.asMicroseconds();
+    for (unsigned int phaseIndex = 0; phaseIndex < PROFILED_PHASE_COUNT; ++phaseIndex)
+    {
+        const char* phaseName = FrameProfiler::GetPhaseName(static_cast<ProfiledPhase>(phaseIndex));
+        int phaseColumnWidth = static_cast<int>(std::strlen(phaseName)) + PHASE_COLUMN_PADDING;
+        output << std::setw(phaseColumnWidth) << frame.PhaseTimes[phaseIndex].asMicroseconds();
+    }
+    output << std::setw(NUMBER_COLUMN_WIDTH + PHASE_COLUMN_PADDING) << frame.AllocationCount << " ";
+
+    // WRITE THE MARKERS.
+    unsigned int recordedMarkerCount = std::min(frame.MarkerCount, static_cast<unsigned int>(RecordedFrame::MAX_MARKER_COUNT));
+    for (unsigned int markerIndex = 0; markerIndex < recordedMarkerCount; ++markerIndex)
+    {
+        const FrameMarker& marker = frame.Markers[markerIndex];
+        output << " " << marker.Name << "@" << marker.TimeInFrame.asMicroseconds();
+    }
+
+    bool markersMissed = (frame.MarkerCount > recordedMarkerCount);
+    if (markersMissed)
+    {
+        output << " (+" << (frame.MarkerCount - recordedMarkerCount) << " more)";
+    }
+
+    if (hitchFrame)
+    {
+        output << "  <-- HITCH";
+    }
+    output << std::endl;
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <SFML/System.hpp>
+#include "Profiling/FrameProfiler.h"
+
+namespace PROFILING
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  A named point in time within a frame, marking an
+    ///         event that may explain a long frame.
+    ////////////////////////////////////////////////////////
+    struct FrameMarker
+    {
+        const char* Name;   ///< The name of the marker.  Must remain valid for the whole program, like a string literal.
+        sf::Time TimeInFrame;   ///< When the marker occurred, relative to the start of its frame.
+
+        /// @brief  Constructor.  Initializes an unnamed marker at the start of a frame.
+        FrameMarker() :
+            Name(nullptr),
+            TimeInFrame()
+        {}
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  Everything recorded about a single frame.
+    ////////////////////////////////////////////////////////
+    struct RecordedFrame
+    {
+        /// @brief  The maximum number of markers recorded for a single frame.
+        ///         Additional markers are counted but not recorded.
+        static const unsigned int MAX_MARKER_COUNT = 8;
+
+        uint64_t FrameIndex;    ///< The index of the frame since recording started.
+        sf::Time FrameTime; ///< The total time of the frame.
+        std::array<sf::Time, PROFILED_PHASE_COUNT> PhaseTimes;  ///< Time spent in each phase during the frame.
+        uint64_t AllocationCount;   ///< The number of heap allocations during the frame.
+        std::array<FrameMarker, MAX_MARKER_COUNT> Markers;  ///< The markers that occurred during the frame, in order.
+        unsigned int MarkerCount;   ///< The number of markers that occurred during the frame, including any not recorded.
+
+        /// @brief  Constructor.  Initializes an empty frame.
+        RecordedFrame() :
+            FrameIndex(0),
+            FrameTime(),
+            PhaseTimes(),
+            AllocationCount(0),
+            Markers(),
+            MarkerCount(0)
+        {
+            PhaseTimes.fill(sf::Time::Zero);
+        }
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  Continuously records the phase timings and event markers
+    ///         of the most recent frames in a ring buffer, writing them
+    ///         to a file whenever a frame exceeds the hitch budget.  This
+    ///         captures what led up to occasional long frames that are
+    ///         otherwise hard to catch.
+    ///
+    ///         Frames are recorded by the frame profiler as they end.  Recording
+    ///         doesn't allocate, but writing a recording does, and the frame after
+    ///         a hitch is often long too.  So at most one recording is written each
+    ///         time the ring buffer fills with new frames.
+    ///
+    ///         Markers must only be added on the main thread.  The macros in
+    ///         Profiling.h should be used so that recording can be compiled out entirely.
+    ////////////////////////////////////////////////////////
+    class FlightRecorder
+    {
+    public:
+        /// @brief  The number of most recent frames kept in the ring buffer.
+        static const unsigned int RECORDED_FRAME_COUNT = 300;
+        /// @brief  The default time that a frame must exceed to be considered a hitch.
+        ///         This is the time of two frames at 60 frames per second.
+        static const sf::Time DEFAULT_HITCH_BUDGET;
+        /// @brief  The start of the filename of each recording, which is followed
+        ///         by the index of the hitch frame.
+        static const std::string RECORDING_FILEPATH_PREFIX;
+
+        /// @brief  Gets the single flight recorder for the game.
+        /// @return The flight recorder.
+        static FlightRecorder& GetInstance();
+
+        /// @brief  Destructor.
+        ~FlightRecorder();
+
+        /// @brief      Sets the time that a frame must exceed to be considered a hitch.
+        /// @param[in]  hitchBudget - The longest time a frame may take without being recorded.
+        void SetHitchBudget(const sf::Time& hitchBudget);
+
+        /// @brief      Adds a marker to the current frame.
+        /// @param[in]  name - The name of the marker.  Must remain valid for the whole program,
+        ///             like a string literal.
+        void AddMarker(const char* name);
+
+        /// @brief      Ends the current frame, recording it in the ring buffer.  If the frame
+        ///             exceeded the hitch budget, the ring buffer is written to a file.
+        ///             The first frame is never considered a hitch since it includes
+        ///             all time spent before the game loop started.
+        /// @param[in]  frameTime - The total time of the frame.
+        /// @param[in]  phaseTimes - The time spent in each phase during the frame.
+        /// @param[in]  allocationCount - The number of heap allocations during the frame.
+        void EndFrame(
+            const sf::Time& frameTime,
+            const std::array<sf::Time, PROFILED_PHASE_COUNT>& phaseTimes,
+            const uint64_t allocationCount);
+
+        /// @brief          Writes the recorded frames, from oldest to newest.
+        /// @param[in,out]  output - The stream to write the recording to.
+        void WriteRecording(std::ostream& output) const;
+
+    private:
+        /// @brief  Constructor.  Private since only a single recorder should exist.
+        explicit FlightRecorder();
+        FlightRecorder(const FlightRecorder& recorderToCopy);   ///< Private to disallow copying.
+        FlightRecorder& operator= (const FlightRecorder& rhsRecorder);  ///< Private to disallow assignment.
+
+        /// @brief      Writes the recorded frames to a file named for a hitch frame.
+        /// @param[in]  hitchFrame - The frame that exceeded the hitch budget.
+        void WriteRecordingFile(const RecordedFrame& hitchFrame) const;
+
+        /// @brief          Writes a single row of the recording for a frame.
+        /// @param[in]      frame - The frame to write.
+        /// @param[in,out]  output - The stream to write the row to.
+        void WriteFrame(const RecordedFrame& frame, std::ostream& output) const;
+
+        sf::Time m_hitchBudget; ///< The time that a frame must exceed to be considered a hitch.
+        sf::Clock m_frameClock; ///< Measures time within the current frame for markers.
+        std::vector<RecordedFrame> m_recordedFrames;    ///< The ring buffer of the most recent frames.
+        unsigned int m_nextRecordedFrameIndex;  ///< The index in the ring buffer for the next frame.
+        unsigned int m_recordedFrameCount;  ///< The number of frames in the ring buffer.
+        uint64_t m_frameCount;  ///< The number of frames that have ended.
+        unsigned int m_framesSinceRecordingWrittenCount;    ///< The number of frames ended since a recording was last written.
+        RecordedFrame m_currentFrame;   ///< The markers of the current frame, before it is recorded.
+    };
+}
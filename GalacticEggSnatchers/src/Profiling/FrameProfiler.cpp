@@ -0,0 +1,187 @@
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include "Profiling/AllocationTracker.h"
+#include "Profiling/FlightRecorder.h"
+#include "Profiling/FrameProfiler.h"
+
+using namespace PROFILING;
+
+// STATIC CONSTANT INITIALIZATION.
+const std::string FrameProfiler::REPORT_FILEPATH = "frameProfile.txt";
+
+// METHOD IMPLEMENTATION.
+
+FrameProfiler& FrameProfiler::GetInstance()
+{
+    static FrameProfiler profiler;
+    return profiler;
+}
+
+FrameProfiler::FrameProfiler() :
+    m_frameClock(),
+    m_frameCount(0),
+    m_frameTimeHistogram(),
+    m_currentFramePhaseTimes(),
+    m_phasesOccurredInCurrentFrame(),
+    m_phaseTimeHistograms(),
+    m_previousFramePhaseTimes(),
+    m_currentFrameDrawCallCount(0),
+    m_previousFrameDrawCallCount(0)
+{
+    m_currentFramePhaseTimes.fill(sf::Time::Zero);
+    m_phasesOccurredInCurrentFrame.fill(false);
+    m_previousFramePhaseTimes.fill(sf::Time::Zero);
+}
+
+FrameProfiler::~FrameProfiler()
+{
+    // Nothing to do.
+}
+
+void FrameProfiler::AddPhaseTime(const ProfiledPhase phase, const sf::Time& time)
+{
+    m_currentFramePhaseTimes[phase] += time;
+    m_phasesOccurredInCurrentFrame[phase] = true;
+}
+
+void FrameProfiler::CountDrawCall()
+{
+    ++m_currentFrameDrawCallCount;
+}
+
+sf::Time FrameProfiler::GetPreviousFramePhaseTime(const ProfiledPhase phase) const
+{
+    return m_previousFramePhaseTimes[phase];
+}
+
+unsigned int FrameProfiler::GetPreviousFrameDrawCallCount() const
+{
+    return m_previousFrameDrawCallCount;
+}
+
+void FrameProfiler::EndFrame()
+{
+    // RECORD THE TOTAL TIME OF THE FRAME.
+    // The first frame is not recorded since it would include
+    // all time spent before the game loop started.
+    sf::Time frameTime = m_frameClock.restart();
+    bool firstFrame = (0 == m_frameCount);
+    if (!firstFrame)
+    {
+        m_frameTimeHistogram.Record(frameTime);
+    }
+    ++m_frameCount;
+
+    // RECORD THE TIME OF EACH PHASE THAT OCCURRED DURING THE FRAME.
+    for (unsigned int phaseIndex = 0; phaseIndex < PROFILED_PHASE_COUNT; ++phaseIndex)
+    {
+        bool phaseOccurred = m_phasesOccurredInCurrentFrame[phaseIndex];
+        if (phaseOccurred)
+        {
+            m_phaseTimeHistograms[phaseIndex].Record(m_currentFramePhaseTimes[phaseIndex]);
+        }
+    }
+
+    // KEEP THE FRAME'S STATISTICS FOR DISPLAY DURING THE NEXT FRAME.
+    m_previousFramePhaseTimes = m_currentFramePhaseTimes;
+    m_previousFrameDrawCallCount = m_currentFrameDrawCallCount;
+
+    // RESET THE PHASE TIMES FOR THE NEXT FRAME.
+    m_currentFramePhaseTimes.fill(sf::Time::Zero);
+    m_phasesOccurredInCurrentFrame.fill(false);
+    m_currentFrameDrawCallCount = 0;
+
+    // END THE FRAME FOR ALLOCATION TRACKING.
+    AllocationTracker& allocationTracker = AllocationTracker::GetInstance();
+    allocationTracker.EndFrame();
+
+    // RECORD THE FRAME IN THE FLIGHT RECORDER.
+    // This is done last since a hitch may cause the recording to be written.
+    uint64_t allocationCount = allocationTracker.GetPreviousFrameCounts().AllocationCount;
+    FlightRecorder::GetInstance().EndFrame(frameTime, m_previousFramePhaseTimes, allocationCount);
+}
+
+// Helper constants for formatting report columns.
+static const int NAME_COLUMN_WIDTH = 34;
+static const int NUMBER_COLUMN_WIDTH = 10;
+
+void FrameProfiler::WriteReport(std::ostream& output) const
+{
+    // WRITE THE HEADER.
+    output << "Frame profile (" << m_frameCount << " frames, times in microseconds)" << std::endl;
+    output << std::left << std::setw(NAME_COLUMN_WIDTH) << "Phase" << std::right
+        << std::setw(NUMBER_COLUMN_WIDTH) << "Frames"
+        << std::setw(NUMBER_COLUMN_WIDTH) << "Min"
+        << std::setw(NUMBER_COLUMN_WIDTH) << "Avg"
+        << std::setw(NUMBER_COLUMN_WIDTH) << "p99"
+        << std::setw(NUMBER_COLUMN_WIDTH) << "Max" << std::endl;
+
+    // WRITE THE TIMINGS FOR THE WHOLE FRAME.
+    WriteHistogram("Frame", m_frameTimeHistogram, output);
+
+    // WRITE THE TIMINGS FOR EACH PHASE.
+    // Phases nested within updating or rendering are indented beneath them.
+    for (unsigned int phaseIndex = 0; phaseIndex < PROFILED_PHASE_COUNT; ++phaseIndex)
+    {
+        ProfiledPhase phase = static_cast<ProfiledPhase>(phaseIndex);
+        bool topLevelPhase = (
+            PROFILED_PHASE_UPDATE == phase ||
+            PROFILED_PHASE_RENDER == phase ||
+            PROFILED_PHASE_DISPLAY == phase);
+        std::string phaseName = topLevelPhase ? "" : "  ";
+        phaseName += GetPhaseName(phase);
+
+        WriteHistogram(phaseName, m_phaseTimeHistograms[phaseIndex], output);
+    }
+
+    // WRITE THE HEAP ALLOCATIONS.
+    output << std::endl;
+    AllocationTracker::GetInstance().WriteReport(output);
+}
+
+void FrameProfiler::WriteReport() const
+{
+    WriteReport(std::cout);
+
+    std::ofstream reportFile(REPORT_FILEPATH);
+    WriteReport(reportFile);
+}
+
+void FrameProfiler::WriteHistogram(const std::string& name, const TimingHistogram& histogram, std::ostream& output)
+{
+    const float PERCENTILE_99 = 99.0f;
+    output << std::left << std::setw(NAME_COLUMN_WIDTH) << name << std::right
+        << std::setw(NUMBER_COLUMN_WIDTH) << histogram.GetSampleCount()
+        << std::setw(NUMBER_COLUMN_WIDTH) << histogram.GetMin().asMicroseconds()
+        << std::setw(NUMBER_COLUMN_WIDTH) << histogram.GetAverage().asMicroseconds()
+        << std::setw(NUMBER_COLUMN_WIDTH) << histogram.GetPercentile(PERCENTILE_99).asMicroseconds()
+        << std::setw(NUMBER_COLUMN_WIDTH) << histogram.GetMax().asMicroseconds() << std::endl;
+}
+
+const char* FrameProfiler::GetPhaseName(const ProfiledPhase phase)
+{
+    switch (phase)
+    {
+    case PROFILED_PHASE_UPDATE:
+        return "Update";
+    case PROFILED_PHASE_HANDLE_INPUT:
+        return "HandleInput";
+    case PROFILED_PHASE_UPDATE_GAME_OBJECTS:
+        return "UpdateGameObjects";
+    case PROFILED_PHASE_HANDLE_GAME_OBJECT_COLLISIONS:
+        return "HandleGameObjectCollisions";
+    case PROFILED_PHASE_HANDLE_SCREEN_BOUNDARY_COLLISIONS:
+        return "HandleScreenBoundaryCollisions";
+    case PROFILED_PHASE_SPAWN_ALIEN_WAVE:
+        return "SpawnAlienWave";
+    case PROFILED_PHASE_RENDER:
+        return "Render";
+    case PROFILED_PHASE_RENDER_GAME_OBJECTS:
+        return "RenderGameObjects";
+    case PROFILED_PHASE_DISPLAY:
+        return "Display";
+    default:
+        return "Unknown";
+    }
+}
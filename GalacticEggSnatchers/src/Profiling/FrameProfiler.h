@@ -0,0 +1,109 @@
+#pragma once
+
+#include <array>
+#include <ostream>
+#include <string>
+#include <SFML/System.hpp>
+#include "Profiling/TimingHistogram.h"
+
+namespace PROFILING
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  The phases of a frame that may be profiled.
+    ////////////////////////////////////////////////////////
+    enum ProfiledPhase
+    {
+        PROFILED_PHASE_UPDATE = 0,  ///< Updating the game for a single simulation step.
+        PROFILED_PHASE_HANDLE_INPUT,    ///< Handling player input during gameplay.
+        PROFILED_PHASE_UPDATE_GAME_OBJECTS, ///< Updating gameplay objects.
+        PROFILED_PHASE_HANDLE_GAME_OBJECT_COLLISIONS,   ///< Handling collisions between gameplay objects.
+        PROFILED_PHASE_HANDLE_SCREEN_BOUNDARY_COLLISIONS,   ///< Handling collisions of gameplay objects with the screen boundaries.
+        PROFILED_PHASE_SPAWN_ALIEN_WAVE,    ///< Spawning a new wave of aliens.
+        PROFILED_PHASE_RENDER,  ///< Rendering the game.
+        PROFILED_PHASE_RENDER_GAME_OBJECTS, ///< Rendering gameplay objects.
+        PROFILED_PHASE_DISPLAY, ///< Displaying the rendered frame, including any wait for vertical sync.
+        PROFILED_PHASE_COUNT    ///< The number of profiled phases.  Not a valid phase.
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  Collects timings of different phases of each frame
+    ///         into histograms for reporting.  Phases that occur
+    ///         multiple times within a frame (such as multiple
+    ///         simulation steps) are summed for that frame.
+    ///
+    ///         A single profiler exists for the whole game so that
+    ///         code anywhere can be instrumented without needing
+    ///         a profiler passed to it.  The macros in Profiling.h
+    ///         should be used for instrumentation so that profiling
+    ///         can be compiled out entirely.
+    ////////////////////////////////////////////////////////
+    class FrameProfiler
+    {
+    public:
+        /// @brief  The file that profiling reports are written to.
+        static const std::string REPORT_FILEPATH;
+
+        /// @brief  Gets the single profiler for the game.
+        /// @return The frame profiler.
+        static FrameProfiler& GetInstance();
+
+        /// @brief      Gets the displayable name of a phase.
+        /// @param[in]  phase - The phase to get the name of.
+        /// @return     The name of the phase.
+        static const char* GetPhaseName(const ProfiledPhase phase);
+
+        /// @brief  Destructor.
+        ~FrameProfiler();
+
+        /// @brief      Adds time spent in a phase for the current frame.
+        /// @param[in]  phase - The phase in which time was spent.
+        /// @param[in]  time - The time spent in the phase.
+        void AddPhaseTime(const ProfiledPhase phase, const sf::Time& time);
+
+        /// @brief  Counts a draw call made during the current frame.
+        void CountDrawCall();
+
+        /// @brief      Gets the time spent in a phase during the most recently ended frame.
+        /// @param[in]  phase - The phase to get the time of.
+        /// @return     The time spent in the phase; zero if it didn't occur.
+        sf::Time GetPreviousFramePhaseTime(const ProfiledPhase phase) const;
+
+        /// @brief  Gets the number of draw calls made during the most recently ended frame.
+        /// @return The number of draw calls.
+        unsigned int GetPreviousFrameDrawCallCount() const;
+
+        /// @brief  Ends the current frame, recording the timings of all phases
+        ///         that occurred during it along with the total frame time.
+        void EndFrame();
+
+        /// @brief          Writes a report of timings for each phase.
+        /// @param[in,out]  output - The stream to write the report to.
+        void WriteReport(std::ostream& output) const;
+
+        /// @brief  Writes a report of timings for each phase to the console
+        ///         and to the report file.
+        void WriteReport() const;
+
+    private:
+        /// @brief  Constructor.  Private since only a single profiler should exist.
+        explicit FrameProfiler();
+        FrameProfiler(const FrameProfiler& profilerToCopy);  ///< Private to disallow copying.
+        FrameProfiler& operator= (const FrameProfiler& rhsProfiler); ///< Private to disallow assignment.
+
+        /// @brief          Writes a single row of the report for a histogram.
+        /// @param[in]      name - The name of the row.
+        /// @param[in]      histogram - The histogram of timings for the row.
+        /// @param[in,out]  output - The stream to write the row to.
+        static void WriteHistogram(const std::string& name, const TimingHistogram& histogram, std::ostream& output);
+
+        sf::Clock m_frameClock; ///< A clock for measuring the total time of each frame.
+        unsigned int m_frameCount;  ///< The number of frames that have ended.
+        TimingHistogram m_frameTimeHistogram;   ///< Total times of each frame.
+        std::array<sf::Time, PROFILED_PHASE_COUNT> m_currentFramePhaseTimes;    ///< Time spent in each phase during the current frame.
+        std::array<bool, PROFILED_PHASE_COUNT> m_phasesOccurredInCurrentFrame;  ///< Whether each phase occurred during the current frame.
+        std::array<TimingHistogram, PROFILED_PHASE_COUNT> m_phaseTimeHistograms;    ///< Per-frame times of each phase.
+        std::array<sf::Time, PROFILED_PHASE_COUNT> m_previousFramePhaseTimes;   ///< Time spent in each phase during the most recently ended frame.
+        unsigned int m_currentFrameDrawCallCount;   ///< The number of draw calls made during the current frame.
+        unsigned int m_previousFrameDrawCallCount;  ///< The number of draw calls made during the most recently ended frame.
+    };
+}
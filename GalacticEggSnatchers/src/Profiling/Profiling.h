@@ -0,0 +1,87 @@
+#pragma once
+
+// Macros for instrumenting code with the frame profiler, allocation tracker, flight recorder, and trace event writer.
+// Profiling is only compiled in if PROFILING_ENABLED is defined,
+// so these macros expand to nothing in builds without profiling.
+
+#include <cstdint>
+
+#if defined PROFILING_ENABLED
+
+#include "Profiling/AllocationTracker.h"
+#include "Profiling/FlightRecorder.h"
+#include "Profiling/FrameProfiler.h"
+#include "Profiling/ScopedAllocationCategory.h"
+#include "Profiling/ScopedPhaseTimer.h"
+#include "Profiling/ScopedTraceEvent.h"
+#include "Profiling/TraceEventWriter.h"
+
+// Helper macros to create a unique variable name for each scoped timer.
+#define PROFILING_CONCATENATE_IMPLEMENTATION(first, second) first##second
+#define PROFILING_CONCATENATE(first, second) PROFILING_CONCATENATE_IMPLEMENTATION(first, second)
+
+/// @brief  Times the remainder of the enclosing scope as the specified phase.
+#define PROFILE_PHASE(phase) \
+    PROFILING::ScopedPhaseTimer PROFILING_CONCATENATE(scopedPhaseTimer, __LINE__)(PROFILING::phase)
+
+/// @brief  Attributes heap allocations in the remainder of the enclosing scope to the specified category.
+#define PROFILE_ALLOCATIONS(category) \
+    PROFILING::ScopedAllocationCategory PROFILING_CONCATENATE(scopedAllocationCategory, __LINE__)(PROFILING::category)
+
+/// @brief  Gets the number of heap allocations made on the main thread so far.
+#define PROFILE_ALLOCATION_COUNT() \
+    PROFILING::AllocationTracker::GetInstance().GetTotalCounts().AllocationCount
+
+/// @brief  Counts a draw call made during the current frame.
+#define PROFILE_DRAW_CALL() \
+    PROFILING::FrameProfiler::GetInstance().CountDrawCall()
+
+/// @brief  Marks an event in the current frame for the flight recorder.
+///         The name must remain valid for the whole program, like a string literal.
+#define PROFILE_MARKER(name) \
+    PROFILING::FlightRecorder::GetInstance().AddMarker(name)
+
+/// @brief  Sets how long a frame must take for the flight recorder to write a recording.
+#define PROFILE_SET_HITCH_BUDGET(hitchBudget) \
+    PROFILING::FlightRecorder::GetInstance().SetHitchBudget(hitchBudget)
+
+/// @brief  Ends the current frame in the frame profiler.
+#define PROFILE_END_FRAME() \
+    PROFILING::FrameProfiler::GetInstance().EndFrame()
+
+/// @brief  Writes the frame profiler's report to the console and report file.
+#define PROFILE_WRITE_REPORT() \
+    PROFILING::FrameProfiler::GetInstance().WriteReport()
+
+/// @brief  Traces the remainder of the enclosing scope as an event with the specified category and name.
+#define TRACE_SCOPE(category, name) \
+    PROFILING::ScopedTraceEvent PROFILING_CONCATENATE(scopedTraceEvent, __LINE__)(category, name, nullptr)
+
+/// @brief  Traces the remainder of the enclosing scope as an event with additional detail text.
+#define TRACE_SCOPE_WITH_DETAIL(category, name, detail) \
+    PROFILING::ScopedTraceEvent PROFILING_CONCATENATE(scopedTraceEvent, __LINE__)(category, name, detail)
+
+/// @brief  Starts writing trace events to the specified file.
+#define TRACE_START(filepath) \
+    PROFILING::TraceEventWriter::GetInstance().Start(filepath)
+
+/// @brief  Stops writing trace events, completing the trace file.
+#define TRACE_STOP() \
+    PROFILING::TraceEventWriter::GetInstance().Stop()
+
+#else
+
+#define PROFILE_PHASE(phase)
+#define PROFILE_ALLOCATIONS(category)
+#define PROFILE_ALLOCATION_COUNT() static_cast<uint64_t>(0)
+#define PROFILE_DRAW_CALL()
+#define PROFILE_MARKER(name)
+#define PROFILE_SET_HITCH_BUDGET(hitchBudget)
+#define PROFILE_END_FRAME()
+#define PROFILE_WRITE_REPORT()
+#define TRACE_SCOPE(category, name)
+#define TRACE_SCOPE_WITH_DETAIL(category, name, detail)
+#define TRACE_START(filepath)
+#define TRACE_STOP()
+
+#endif
@@ -0,0 +1,14 @@
+#include "Profiling/ScopedAllocationCategory.h"
+
+using namespace PROFILING;
+
+ScopedAllocationCategory::ScopedAllocationCategory(const AllocationCategory category) :
+    m_previousCategory(AllocationTracker::GetInstance().EnterCategory(category))
+{
+    // Nothing else to do.
+}
+
+ScopedAllocationCategory::~ScopedAllocationCategory()
+{
+    AllocationTracker::GetInstance().ExitCategory(m_previousCategory);
+}
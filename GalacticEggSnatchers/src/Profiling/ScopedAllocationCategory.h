@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Profiling/AllocationTracker.h"
+
+namespace PROFILING
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Attributes heap allocations to a category from
+    ///         construction until destruction, after which the
+    ///         previous category is restored.
+    ///         The PROFILE_ALLOCATIONS macro in Profiling.h should
+    ///         be used rather than this class directly.
+    ////////////////////////////////////////////////////////
+    class ScopedAllocationCategory
+    {
+    public:
+        /// @brief      Constructor.  Starts attributing allocations to the category.
+        /// @param[in]  category - The category of allocations within the scope.
+        explicit ScopedAllocationCategory(const AllocationCategory category);
+
+        /// @brief  Destructor.  Restores the previous category.
+        ~ScopedAllocationCategory();
+
+    private:
+        ScopedAllocationCategory(const ScopedAllocationCategory& categoryToCopy);   ///< Private to disallow copying.
+        ScopedAllocationCategory& operator= (const ScopedAllocationCategory& rhsCategory);  ///< Private to disallow assignment.
+
+        AllocationCategory m_previousCategory;  ///< The category to restore once the scope ends.
+    };
+}
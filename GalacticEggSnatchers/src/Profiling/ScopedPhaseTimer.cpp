@@ -0,0 +1,35 @@
+#include "Profiling/AllocationTracker.h"
+#include "Profiling/ScopedPhaseTimer.h"
+#include "Profiling/TraceEventWriter.h"
+
+using namespace PROFILING;
+
+ScopedPhaseTimer::ScopedPhaseTimer(const ProfiledPhase phase) :
+    m_phase(phase),
+    m_previousPhase(AllocationTracker::GetInstance().EnterPhase(phase)),
+    m_clock()
+{
+    // Nothing else to do.
+}
+
+ScopedPhaseTimer::~ScopedPhaseTimer()
+{
+    // ADD THE TIME TO THE FRAME PROFILER.
+    sf::Time elapsedTime = m_clock.getElapsedTime();
+    FrameProfiler::GetInstance().AddPhaseTime(m_phase, elapsedTime);
+
+    // ADD THE PHASE TO ANY ACTIVE TRACE.
+    TraceEventWriter& traceEventWriter = TraceEventWriter::GetInstance();
+    bool tracing = traceEventWriter.IsTracing();
+    if (tracing)
+    {
+        // The phase's start time is calculated back from the end to avoid
+        // reading an additional clock when not tracing.
+        const char* NO_DETAIL = nullptr;
+        sf::Time startTime = traceEventWriter.GetElapsedTime() - elapsedTime;
+        traceEventWriter.AddCompleteEvent("gameplay", FrameProfiler::GetPhaseName(m_phase), NO_DETAIL, startTime, elapsedTime);
+    }
+
+    // STOP ATTRIBUTING ALLOCATIONS TO THE PHASE.
+    AllocationTracker::GetInstance().ExitPhase(m_previousPhase);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <SFML/System.hpp>
+#include "Profiling/FrameProfiler.h"
+
+namespace PROFILING
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Times a phase of a frame from construction until
+    ///         destruction, adding the time to the frame profiler
+    ///         and to any active trace.  Heap allocations during
+    ///         the phase are also attributed to it.
+    ///         The PROFILE_PHASE macro in Profiling.h should be used
+    ///         rather than this class directly.
+    ////////////////////////////////////////////////////////
+    class ScopedPhaseTimer
+    {
+    public:
+        /// @brief      Constructor.  Starts timing the phase.
+        /// @param[in]  phase - The phase being timed.
+        explicit ScopedPhaseTimer(const ProfiledPhase phase);
+
+        /// @brief  Destructor.  Adds the time spent to the frame profiler
+        ///         and restores the previous phase for allocations.
+        ~ScopedPhaseTimer();
+
+    private:
+        ScopedPhaseTimer(const ScopedPhaseTimer& timerToCopy);  ///< Private to disallow copying.
+        ScopedPhaseTimer& operator= (const ScopedPhaseTimer& rhsTimer); ///< Private to disallow assignment.
+
+        ProfiledPhase m_phase;  ///< The phase being timed.
+        ProfiledPhase m_previousPhase;  ///< The phase allocations were attributed to before this one.
+        sf::Clock m_clock;  ///< The clock measuring time spent in the phase.
+    };
+}
@@ -0,0 +1,33 @@
+#include "Profiling/ScopedTraceEvent.h"
+#include "Profiling/TraceEventWriter.h"
+
+using namespace PROFILING;
+
+ScopedTraceEvent::ScopedTraceEvent(const char* category, const char* name, const char* detail) :
+    m_category(category),
+    m_name(name),
+    m_detail(detail),
+    m_tracing(TraceEventWriter::GetInstance().IsTracing()),
+    m_startTime()
+{
+    // START TIMING IF TRACING.
+    // The clock is only read when needed to minimize overhead when not tracing.
+    if (m_tracing)
+    {
+        m_startTime = TraceEventWriter::GetInstance().GetElapsedTime();
+    }
+}
+
+ScopedTraceEvent::~ScopedTraceEvent()
+{
+    // CHECK IF TRACING.
+    if (!m_tracing)
+    {
+        return;
+    }
+
+    // RECORD THE EVENT.
+    TraceEventWriter& traceEventWriter = TraceEventWriter::GetInstance();
+    sf::Time duration = traceEventWriter.GetElapsedTime() - m_startTime;
+    traceEventWriter.AddCompleteEvent(m_category, m_name, m_detail, m_startTime, duration);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <SFML/System.hpp>
+
+namespace PROFILING
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Records a trace event covering the time from
+    ///         construction until destruction.  The TRACE_SCOPE
+    ///         macros in Profiling.h should be used rather than
+    ///         this class directly.
+    ////////////////////////////////////////////////////////
+    class ScopedTraceEvent
+    {
+    public:
+        /// @brief      Constructor.  Starts timing the event.
+        /// @param[in]  category - The category of the event.  Must be a string literal.
+        /// @param[in]  name - The name of the event.  Must remain valid for the lifetime of this object.
+        /// @param[in]  detail - Additional detail about the event.  May be null.
+        ///             Must remain valid for the lifetime of this object.
+        explicit ScopedTraceEvent(const char* category, const char* name, const char* detail);
+
+        /// @brief  Destructor.  Records the event if tracing is active.
+        ~ScopedTraceEvent();
+
+    private:
+        ScopedTraceEvent(const ScopedTraceEvent& eventToCopy);  ///< Private to disallow copying.
+        ScopedTraceEvent& operator= (const ScopedTraceEvent& rhsEvent); ///< Private to disallow assignment.
+
+        const char* m_category; ///< The category of the event.
+        const char* m_name; ///< The name of the event.
+        const char* m_detail;   ///< Additional detail about the event.
+        bool m_tracing; ///< Whether tracing was active when the event started.
+        sf::Time m_startTime;   ///< When the event started.
+    };
+}
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <cmath>
+#include "Profiling/TimingHistogram.h"
+
+using namespace PROFILING;
+
+TimingHistogram::TimingHistogram() :
+    m_bucketSampleCounts(),
+    m_sampleCount(0),
+    m_totalTimeInMicroseconds(0),
+    m_minTimeInMicroseconds(0),
+    m_maxTimeInMicroseconds(0)
+{
+    m_bucketSampleCounts.fill(0);
+}
+
+void TimingHistogram::Record(const sf::Time& time)
+{
+    // CLAMP THE TIME TO THE RANGE OF THE HISTOGRAM.
+    // Negative times should not occur, but they are treated as zero just in case.
+    sf::Int64 timeInMicroseconds = std::max<sf::Int64>(0, time.asMicroseconds());
+
+    // UPDATE THE SUMMARY STATISTICS.
+    bool firstSample = (0 == m_sampleCount);
+    m_minTimeInMicroseconds = firstSample ? timeInMicroseconds : std::min(m_minTimeInMicroseconds, timeInMicroseconds);
+    m_maxTimeInMicroseconds = std::max(m_maxTimeInMicroseconds, timeInMicroseconds);
+    m_totalTimeInMicroseconds += timeInMicroseconds;
+    ++m_sampleCount;
+
+    // ADD THE SAMPLE TO ITS BUCKET.
+    unsigned int bucketIndex = GetBucketIndex(timeInMicroseconds);
+    ++m_bucketSampleCounts[bucketIndex];
+}
+
+unsigned int TimingHistogram::GetSampleCount() const
+{
+    return m_sampleCount;
+}
+
+sf::Time TimingHistogram::GetMin() const
+{
+    return sf::microseconds(m_minTimeInMicroseconds);
+}
+
+sf::Time TimingHistogram::GetAverage() const
+{
+    // CHECK IF ANY SAMPLES EXIST.
+    // Division by zero must be avoided.
+    bool samplesExist = (m_sampleCount > 0);
+    if (!samplesExist)
+    {
+        return sf::Time::Zero;
+    }
+
+    sf::Int64 averageTimeInMicroseconds = m_totalTimeInMicroseconds / m_sampleCount;
+    return sf::microseconds(averageTimeInMicroseconds);
+}
+
+sf::Time TimingHistogram::GetMax() const
+{
+    return sf::microseconds(m_maxTimeInMicroseconds);
+}
+
+sf::Time TimingHistogram::GetPercentile(const float percentile) const
+{
+    // CHECK IF ANY SAMPLES EXIST.
+    bool samplesExist = (m_sampleCount > 0);
+    if (!samplesExist)
+    {
+        return sf::Time::Zero;
+    }
+
+    // DETERMINE HOW MANY SAMPLES MUST BE AT OR BELOW THE PERCENTILE.
+    const float MAX_PERCENTILE = 100.0f;
+    float clampedPercentile = std::min(std::max(percentile, 0.0f), MAX_PERCENTILE);
+    unsigned int samplesAtOrBelowPercentile = static_cast<unsigned int>(
+        std::ceil(clampedPercentile / MAX_PERCENTILE * static_cast<float>(m_sampleCount)));
+    samplesAtOrBelowPercentile = std::max(samplesAtOrBelowPercentile, 1u);
+
+    // FIND THE BUCKET CONTAINING THE PERCENTILE.
+    unsigned int samplesCounted = 0;
+    for (unsigned int bucketIndex = 0; bucketIndex < BUCKET_COUNT; ++bucketIndex)
+    {
+        samplesCounted += m_bucketSampleCounts[bucketIndex];
+
+        bool percentileReached = (samplesCounted >= samplesAtOrBelowPercentile);
+        if (percentileReached)
+        {
+            // The bucket's upper bound may exceed any sample actually recorded.
+            sf::Int64 percentileTimeInMicroseconds = std::min(
+                GetBucketUpperBoundInMicroseconds(bucketIndex),
+                m_maxTimeInMicroseconds);
+            return sf::microseconds(percentileTimeInMicroseconds);
+        }
+    }
+
+    return GetMax();
+}
+
+unsigned int TimingHistogram::GetBucketIndex(const sf::Int64 timeInMicroseconds)
+{
+    // CHECK IF THE TIME FALLS INTO A LINEAR BUCKET.
+    bool linearBucket = (timeInMicroseconds < LINEAR_BUCKET_COUNT);
+    if (linearBucket)
+    {
+        return static_cast<unsigned int>(timeInMicroseconds);
+    }
+
+    // CLAMP THE TIME TO THE LARGEST BUCKET.
+    const sf::Int64 MAX_TIME_IN_MICROSECONDS = 0xFFFFFFFFLL;
+    sf::Uint32 clampedTimeInMicroseconds = static_cast<sf::Uint32>(std::min(timeInMicroseconds, MAX_TIME_IN_MICROSECONDS));
+
+    // FIND THE POWER OF TWO CONTAINING THE TIME.
+    unsigned int highestBitIndex = 0;
+    for (sf::Uint32 remainingBits = clampedTimeInMicroseconds >> 1; remainingBits > 0; remainingBits >>= 1)
+    {
+        ++highestBitIndex;
+    }
+
+    // FIND THE SUB-BUCKET WITHIN THE POWER OF TWO.
+    // The 3 bits below the highest set bit select 1 of the 8 sub-buckets.
+    const unsigned int SUB_BUCKET_BIT_COUNT = 3;
+    const unsigned int FIRST_LOGARITHMIC_BIT_INDEX = 4;
+    unsigned int subBucketIndex = (clampedTimeInMicroseconds >> (highestBitIndex - SUB_BUCKET_BIT_COUNT)) & (SUB_BUCKETS_PER_POWER_OF_TWO - 1);
+    unsigned int bucketIndex = LINEAR_BUCKET_COUNT + 
+        ((highestBitIndex - FIRST_LOGARITHMIC_BIT_INDEX) * SUB_BUCKETS_PER_POWER_OF_TWO) + 
+        subBucketIndex;
+    return bucketIndex;
+}
+
+sf::Int64 TimingHistogram::GetBucketUpperBoundInMicroseconds(const unsigned int bucketIndex)
+{
+    // CHECK IF THE BUCKET IS A LINEAR BUCKET.
+    bool linearBucket = (bucketIndex < LINEAR_BUCKET_COUNT);
+    if (linearBucket)
+    {
+        return bucketIndex;
+    }
+
+    // CALCULATE THE RANGE OF THE LOGARITHMIC BUCKET.
+    const unsigned int SUB_BUCKET_BIT_COUNT = 3;
+    const unsigned int FIRST_LOGARITHMIC_BIT_INDEX = 4;
+    unsigned int logarithmicBucketIndex = bucketIndex - LINEAR_BUCKET_COUNT;
+    unsigned int highestBitIndex = (logarithmicBucketIndex / SUB_BUCKETS_PER_POWER_OF_TWO) + FIRST_LOGARITHMIC_BIT_INDEX;
+    unsigned int subBucketIndex = logarithmicBucketIndex % SUB_BUCKETS_PER_POWER_OF_TWO;
+
+    unsigned int subBucketShift = highestBitIndex - SUB_BUCKET_BIT_COUNT;
+    sf::Int64 bucketLowerBound = static_cast<sf::Int64>(SUB_BUCKETS_PER_POWER_OF_TWO + subBucketIndex) << subBucketShift;
+    sf::Int64 bucketWidth = static_cast<sf::Int64>(1) << subBucketShift;
+    return bucketLowerBound + bucketWidth - 1;
+}
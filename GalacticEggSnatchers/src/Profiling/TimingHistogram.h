@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <SFML/System.hpp>
+
+/// @brief  Code related to measuring the performance of the game.
+namespace PROFILING
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  A fixed-size histogram of timing samples.
+    ///         Samples are stored in buckets with a resolution of
+    ///         a single microsecond for very short times and
+    ///         within 1/8th of a power of two for longer times.
+    ///         This bounds memory regardless of how many samples
+    ///         are recorded while still allowing percentiles to
+    ///         be estimated accurately.
+    ////////////////////////////////////////////////////////
+    class TimingHistogram
+    {
+    public:
+        /// @brief  The number of buckets with a width of a single microsecond.
+        static const unsigned int LINEAR_BUCKET_COUNT = 16;
+        /// @brief  The number of buckets that each power of two beyond the linear buckets is divided into.
+        static const unsigned int SUB_BUCKETS_PER_POWER_OF_TWO = 8;
+        /// @brief  The total number of buckets, covering times up to 2^32 microseconds.
+        static const unsigned int BUCKET_COUNT = LINEAR_BUCKET_COUNT + (28 * SUB_BUCKETS_PER_POWER_OF_TWO);
+
+        /// @brief  Constructor.  Creates an empty histogram.
+        explicit TimingHistogram();
+
+        /// @brief      Records a timing sample.
+        /// @param[in]  time - The time to record.
+        void Record(const sf::Time& time);
+
+        /// @brief  Gets the number of samples recorded.
+        /// @return The number of samples.
+        unsigned int GetSampleCount() const;
+
+        /// @brief  Gets the shortest time recorded.
+        /// @return The minimum time; zero if no samples have been recorded.
+        sf::Time GetMin() const;
+
+        /// @brief  Gets the average time recorded.
+        /// @return The average time; zero if no samples have been recorded.
+        sf::Time GetAverage() const;
+
+        /// @brief  Gets the longest time recorded.
+        /// @return The maximum time; zero if no samples have been recorded.
+        sf::Time GetMax() const;
+
+        /// @brief      Gets the time below which the specified percentage of samples fall.
+        ///             The time is estimated from the upper bound of the bucket containing it.
+        /// @param[in]  percentile - The percentile to get, from 0 to 100.
+        /// @return     The time at the percentile; zero if no samples have been recorded.
+        sf::Time GetPercentile(const float percentile) const;
+
+    private:
+        /// @brief      Gets the index of the bucket that a time falls into.
+        /// @param[in]  timeInMicroseconds - The time to get the bucket for.
+        /// @return     The index of the bucket for the time.
+        static unsigned int GetBucketIndex(const sf::Int64 timeInMicroseconds);
+
+        /// @brief      Gets the largest time that falls into a bucket.
+        /// @param[in]  bucketIndex - The index of the bucket.
+        /// @return     The upper bound of the bucket in microseconds.
+        static sf::Int64 GetBucketUpperBoundInMicroseconds(const unsigned int bucketIndex);
+
+        std::array<unsigned int, BUCKET_COUNT> m_bucketSampleCounts;    ///< The number of samples in each bucket.
+        unsigned int m_sampleCount; ///< The total number of samples recorded.
+        sf::Int64 m_totalTimeInMicroseconds;    ///< The sum of all samples recorded.
+        sf::Int64 m_minTimeInMicroseconds;  ///< The shortest sample recorded.
+        sf::Int64 m_maxTimeInMicroseconds;  ///< The longest sample recorded.
+    };
+}
@@ -0,0 +1,254 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include "Profiling/TraceEventWriter.h"
+
+using namespace PROFILING;
+
+// STATIC CONSTANT INITIALIZATION.
+const sf::Time TraceEventWriter::FLUSH_INTERVAL = sf::milliseconds(50);
+
+/// @brief      Helper function to copy text into a fixed-size buffer, truncating if needed.
+/// @param[in]  text - The text to copy.  May be null.
+/// @param[in]  maxLength - The maximum number of characters to copy, excluding the null terminator.
+/// @param[out] buffer - The buffer to copy into.  Must hold maxLength + 1 characters.
+static void CopyTruncatedText(const char* text, const unsigned int maxLength, char* buffer)
+{
+    // CHECK IF ANY TEXT EXISTS.
+    bool textExists = (nullptr != text);
+    if (!textExists)
+    {
+        buffer[0] = '\0';
+        return;
+    }
+
+    // COPY AS MUCH TEXT AS WILL FIT.
+    std::strncpy(buffer, text, maxLength);
+    buffer[maxLength] = '\0';
+}
+
+// METHOD IMPLEMENTATION.
+
+TraceEventWriter& TraceEventWriter::GetInstance()
+{
+    static TraceEventWriter writer;
+    return writer;
+}
+
+TraceEventWriter::TraceEventWriter() :
+    m_ringBuffer(),
+    m_writeCount(0),
+    m_readCount(0),
+    m_droppedEventCount(0),
+    m_recordingMutex(),
+    m_tracing(false),
+    m_flushThreadRunning(false),
+    m_flushThread(),
+    m_traceFile(),
+    m_firstEventWritten(false),
+    m_clock()
+{
+    // Nothing else to do.
+}
+
+TraceEventWriter::~TraceEventWriter()
+{
+    Stop();
+}
+
+void TraceEventWriter::Start(const std::string& filepath)
+{
+    // CHECK IF TRACING IS ALREADY ACTIVE.
+    if (m_tracing)
+    {
+        return;
+    }
+
+    // OPEN THE TRACE FILE.
+    m_traceFile.open(filepath);
+    bool traceFileOpened = m_traceFile.is_open();
+    if (!traceFileOpened)
+    {
+        throw std::runtime_error("Error opening trace file: " + filepath);
+    }
+    m_traceFile << "{\"traceEvents\":[" << std::endl;
+    m_firstEventWritten = false;
+
+    // ALLOCATE THE RING BUFFER.
+    // This is only done once so that recording events never allocates.
+    m_ringBuffer.resize(RING_BUFFER_CAPACITY);
+    m_writeCount = 0;
+    m_readCount = 0;
+    m_droppedEventCount = 0;
+
+    // START RECORDING EVENTS.
+    m_clock.restart();
+    m_flushThreadRunning = true;
+    m_flushThread = std::thread(&TraceEventWriter::FlushEventsUntilStopped, this);
+    m_tracing = true;
+}
+
+void TraceEventWriter::Stop()
+{
+    // CHECK IF TRACING IS ACTIVE.
+    if (!m_tracing)
+    {
+        return;
+    }
+
+    // STOP RECORDING EVENTS.
+    // Any thread currently recording an event is waited on so that its event is not lost.
+    {
+        std::lock_guard<std::mutex> recordingLock(m_recordingMutex);
+        m_tracing = false;
+    }
+
+    // STOP THE BACKGROUND THREAD.
+    // It drains any remaining events before exiting.
+    m_flushThreadRunning = false;
+    m_flushThread.join();
+
+    // COMPLETE THE TRACE FILE.
+    // The dropped event count is included as metadata so that gaps in the trace can be explained.
+    m_traceFile << std::endl << "],\"otherData\":{\"droppedEventCount\":\"" << m_droppedEventCount << "\"}}" << std::endl;
+    m_traceFile.close();
+}
+
+bool TraceEventWriter::IsTracing() const
+{
+    return m_tracing;
+}
+
+sf::Time TraceEventWriter::GetElapsedTime() const
+{
+    return m_clock.getElapsedTime();
+}
+
+void TraceEventWriter::AddCompleteEvent(
+    const char* category,
+    const char* name,
+    const char* detail,
+    const sf::Time& startTime,
+    const sf::Time& duration)
+{
+    std::lock_guard<std::mutex> recordingLock(m_recordingMutex);
+
+    // CHECK IF TRACING IS ACTIVE.
+    if (!m_tracing)
+    {
+        return;
+    }
+
+    // CHECK IF THE RING BUFFER HAS SPACE FOR THE EVENT.
+    // Events are dropped rather than waiting for the background thread to avoid stalling.
+    unsigned int writeCount = m_writeCount.load(std::memory_order_relaxed);
+    unsigned int readCount = m_readCount.load(std::memory_order_acquire);
+    bool ringBufferFull = ((writeCount - readCount) >= RING_BUFFER_CAPACITY);
+    if (ringBufferFull)
+    {
+        ++m_droppedEventCount;
+        return;
+    }
+
+    // FILL IN THE EVENT.
+    const unsigned int RING_BUFFER_INDEX_MASK = RING_BUFFER_CAPACITY - 1;
+    TraceEvent& traceEvent = m_ringBuffer[writeCount & RING_BUFFER_INDEX_MASK];
+    traceEvent.Category = category;
+    CopyTruncatedText(name, TraceEvent::MAX_NAME_LENGTH, traceEvent.Name);
+    CopyTruncatedText(detail, TraceEvent::MAX_DETAIL_LENGTH, traceEvent.Detail);
+    traceEvent.StartTimeInMicroseconds = startTime.asMicroseconds();
+    traceEvent.DurationInMicroseconds = duration.asMicroseconds();
+    traceEvent.ThreadId = static_cast<unsigned int>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+    // PUBLISH THE EVENT TO THE BACKGROUND THREAD.
+    m_writeCount.store(writeCount + 1, std::memory_order_release);
+}
+
+void TraceEventWriter::FlushEventsUntilStopped()
+{
+    // PERIODICALLY DRAIN EVENTS WHILE TRACING.
+    const std::chrono::milliseconds FLUSH_INTERVAL_IN_MILLISECONDS(FLUSH_INTERVAL.asMilliseconds());
+    while (m_flushThreadRunning)
+    {
+        FlushEvents();
+        std::this_thread::sleep_for(FLUSH_INTERVAL_IN_MILLISECONDS);
+    }
+
+    // DRAIN ANY EVENTS RECORDED SINCE THE LAST FLUSH.
+    FlushEvents();
+}
+
+void TraceEventWriter::FlushEvents()
+{
+    // WRITE ALL EVENTS PUBLISHED SO FAR.
+    const unsigned int RING_BUFFER_INDEX_MASK = RING_BUFFER_CAPACITY - 1;
+    unsigned int readCount = m_readCount.load(std::memory_order_relaxed);
+    unsigned int writeCount = m_writeCount.load(std::memory_order_acquire);
+    for (; readCount != writeCount; ++readCount)
+    {
+        const TraceEvent& traceEvent = m_ringBuffer[readCount & RING_BUFFER_INDEX_MASK];
+        WriteEvent(traceEvent);
+    }
+
+    // FREE THE SPACE FOR NEW EVENTS.
+    m_readCount.store(readCount, std::memory_order_release);
+    m_traceFile.flush();
+}
+
+void TraceEventWriter::WriteEvent(const TraceEvent& traceEvent)
+{
+    // SEPARATE THIS EVENT FROM ANY PREVIOUS EVENT.
+    if (m_firstEventWritten)
+    {
+        m_traceFile << "," << std::endl;
+    }
+    m_firstEventWritten = true;
+
+    // WRITE THE EVENT AS A COMPLETE ("X") EVENT.
+    const unsigned int PROCESS_ID = 1;
+    m_traceFile << "{\"ph\":\"X\",\"cat\":";
+    WriteJsonString(traceEvent.Category);
+    m_traceFile << ",\"name\":";
+    WriteJsonString(traceEvent.Name);
+    m_traceFile << ",\"ts\":" << traceEvent.StartTimeInMicroseconds
+        << ",\"dur\":" << traceEvent.DurationInMicroseconds
+        << ",\"pid\":" << PROCESS_ID
+        << ",\"tid\":" << traceEvent.ThreadId;
+
+    // WRITE ANY DETAIL AS AN ARGUMENT.
+    bool detailExists = ('\0' != traceEvent.Detail[0]);
+    if (detailExists)
+    {
+        m_traceFile << ",\"args\":{\"detail\":";
+        WriteJsonString(traceEvent.Detail);
+        m_traceFile << "}";
+    }
+
+    m_traceFile << "}";
+}
+
+void TraceEventWriter::WriteJsonString(const char* text)
+{
+    m_traceFile << '"';
+    for (const char* character = text; '\0' != *character; ++character)
+    {
+        // ESCAPE ANY SPECIAL CHARACTERS.
+        switch (*character)
+        {
+        case '"':
+            m_traceFile << "\\\"";
+            break;
+        case '\\':
+            m_traceFile << "\\\\";
+            break;
+        default:
+            // Other control characters are not expected in event text, so they are simply replaced.
+            bool controlCharacter = (static_cast<unsigned char>(*character) < ' ');
+            m_traceFile << (controlCharacter ? ' ' : *character);
+            break;
+        }
+    }
+    m_traceFile << '"';
+}
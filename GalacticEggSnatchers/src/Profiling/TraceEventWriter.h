@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <SFML/System.hpp>
+
+namespace PROFILING
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  A single timed event to be written to a trace.
+    ///         Text is stored inline in fixed-size buffers so that
+    ///         recording an event never allocates memory.
+    ////////////////////////////////////////////////////////
+    struct TraceEvent
+    {
+        /// @brief  The maximum number of characters stored for the name of an event.
+        static const unsigned int MAX_NAME_LENGTH = 63;
+        /// @brief  The maximum number of characters stored for the detail of an event.
+        static const unsigned int MAX_DETAIL_LENGTH = 127;
+
+        const char* Category;   ///< The category of the event.  Must be a string literal.
+        char Name[MAX_NAME_LENGTH + 1]; ///< The name of the event.
+        char Detail[MAX_DETAIL_LENGTH + 1]; ///< Additional detail about the event.  May be empty.
+        sf::Int64 StartTimeInMicroseconds;  ///< When the event started, relative to when tracing started.
+        sf::Int64 DurationInMicroseconds;   ///< How long the event lasted.
+        unsigned int ThreadId;  ///< An identifier for the thread the event occurred on.
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  Writes timed events to a file in the Chrome trace event
+    ///         JSON format, viewable in chrome://tracing or Perfetto.
+    ///
+    ///         Events are recorded into a ring buffer that is allocated
+    ///         once when tracing starts.  A background thread periodically
+    ///         drains the buffer to the file so that recording an event
+    ///         never waits on file I/O.  If the buffer fills faster than
+    ///         it is drained, new events are dropped and counted rather
+    ///         than stalling the game.
+    ///
+    ///         A single writer exists for the whole game.  The macros in
+    ///         Profiling.h should be used for instrumentation so that
+    ///         tracing can be compiled out entirely.
+    ////////////////////////////////////////////////////////
+    class TraceEventWriter
+    {
+    public:
+        /// @brief  The number of events the ring buffer can hold.  Must be a power of two.
+        static const unsigned int RING_BUFFER_CAPACITY = 65536;
+        /// @brief  How often the background thread drains the ring buffer.
+        static const sf::Time FLUSH_INTERVAL;
+
+        /// @brief  Gets the single trace writer for the game.
+        /// @return The trace writer.
+        static TraceEventWriter& GetInstance();
+
+        /// @brief  Destructor.  Stops tracing if still active.
+        ~TraceEventWriter();
+
+        /// @brief      Starts tracing to the specified file.
+        ///             Does nothing if tracing is already active.
+        ///             An exception is thrown if the file cannot be opened.
+        /// @param[in]  filepath - The path of the trace file to write.
+        void Start(const std::string& filepath);
+
+        /// @brief  Stops tracing, writing any remaining events and completing the file.
+        ///         Does nothing if tracing is not active.
+        void Stop();
+
+        /// @brief  Checks if tracing is active.
+        /// @return True if events are being recorded; false otherwise.
+        bool IsTracing() const;
+
+        /// @brief  Gets the current time for timestamping events.
+        /// @return The time since tracing started.
+        sf::Time GetElapsedTime() const;
+
+        /// @brief      Records a completed event.  Ignored if tracing is not active.
+        ///             This may be called from any thread.
+        /// @param[in]  category - The category of the event.  Must be a string literal.
+        /// @param[in]  name - The name of the event.  Truncated if too long.
+        /// @param[in]  detail - Additional detail about the event.  May be null.  Truncated if too long.
+        /// @param[in]  startTime - When the event started, as returned from GetElapsedTime().
+        /// @param[in]  duration - How long the event lasted.
+        void AddCompleteEvent(
+            const char* category,
+            const char* name,
+            const char* detail,
+            const sf::Time& startTime,
+            const sf::Time& duration);
+
+    private:
+        /// @brief  Constructor.  Private since only a single writer should exist.
+        explicit TraceEventWriter();
+        TraceEventWriter(const TraceEventWriter& writerToCopy);  ///< Private to disallow copying.
+        TraceEventWriter& operator= (const TraceEventWriter& rhsWriter); ///< Private to disallow assignment.
+
+        /// @brief  The function run by the background thread to periodically drain events to the file.
+        void FlushEventsUntilStopped();
+
+        /// @brief  Writes all events currently in the ring buffer to the file.
+        void FlushEvents();
+
+        /// @brief      Writes a single event to the file.
+        /// @param[in]  traceEvent - The event to write.
+        void WriteEvent(const TraceEvent& traceEvent);
+
+        /// @brief      Writes a string to the file as a JSON string, escaping any special characters.
+        /// @param[in]  text - The text to write.
+        void WriteJsonString(const char* text);
+
+        std::vector<TraceEvent> m_ringBuffer;   ///< The buffer of events waiting to be written.
+        std::atomic<unsigned int> m_writeCount; ///< The total number of events recorded into the ring buffer.
+        std::atomic<unsigned int> m_readCount;  ///< The total number of events drained from the ring buffer.
+        std::atomic<unsigned int> m_droppedEventCount;  ///< The number of events dropped because the ring buffer was full.
+        std::mutex m_recordingMutex;    ///< Serializes threads recording events.  Never held by the background thread.
+        std::atomic<bool> m_tracing;    ///< Whether events are being recorded.
+        std::atomic<bool> m_flushThreadRunning; ///< Whether the background thread should keep draining events.
+        std::thread m_flushThread;  ///< The background thread that drains events to the file.
+        std::ofstream m_traceFile;  ///< The file being written.  Only accessed by the background thread while tracing.
+        bool m_firstEventWritten;   ///< Whether an event has been written to the file, for separating events.
+        sf::Clock m_clock;  ///< The clock for timestamping events.
+    };
+}
@@ -0,0 +1,348 @@
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#if defined _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "Profiling/Profiling.h"
+#include "Resources/AssetArchive.h"
+
+using namespace RESOURCES;
+
+// STATIC CONSTANT INITIALIZATION.
+const std::string AssetArchive::DEFAULT_FILEPATH = "res/Assets.pak";
+
+/// @brief  The bytes at the start of every archive that identify it as an asset archive.
+static const char ARCHIVE_IDENTIFIER[] = { 'G', 'E', 'S', 'P', 'A', 'K', '0', '1' };
+
+/// @brief          Appends a number to a buffer of archive data.
+/// @param[in]      number - The number to append.
+/// @param[in,out]  buffer - The buffer to append to.
+template <typename NumberType>
+static void AppendNumber(const NumberType number, std::vector<char>& buffer)
+{
+    const char* numberBytes = reinterpret_cast<const char*>(&number);
+    buffer.insert(buffer.end(), numberBytes, numberBytes + sizeof(number));
+}
+
+/// @brief          Reads a number from archive data, if enough data remains.
+///                 The number is copied out since it may not be aligned in the archive.
+/// @param[in]      data - The archive data.
+/// @param[in]      dataSizeInBytes - The size of the archive data, in bytes.
+/// @param[in,out]  readOffset - The offset in the data to read from.  Advanced past the number.
+/// @param[out]     number - The number that was read.
+/// @return         True if the number was read; false if not enough data remains.
+template <typename NumberType>
+static bool ReadNumber(const unsigned char* data, const std::size_t dataSizeInBytes, std::size_t& readOffset, NumberType& number)
+{
+    bool numberFits = (sizeof(number) <= (dataSizeInBytes - readOffset));
+    if (!numberFits)
+    {
+        return false;
+    }
+
+    std::memcpy(&number, data + readOffset, sizeof(number));
+    readOffset += sizeof(number);
+    return true;
+}
+
+// STATIC METHODS.
+
+void AssetArchive::Write(const std::string& archiveFilepath, const std::vector<std::string>& assetFilepaths)
+{
+    // READ ALL ASSETS.
+    std::vector< std::vector<char> > assetContents;
+    for (const std::string& assetFilepath : assetFilepaths)
+    {
+        std::ifstream assetFile(assetFilepath, std::ios::binary);
+        if (!assetFile)
+        {
+            throw std::runtime_error("Error reading asset to archive: " + assetFilepath);
+        }
+
+        std::vector<char> assetContent(
+            (std::istreambuf_iterator<char>(assetFile)),
+            std::istreambuf_iterator<char>());
+        assetContents.push_back(assetContent);
+    }
+
+    // WRITE THE ARCHIVE.
+    Write(archiveFilepath, assetFilepaths, assetContents);
+}
+
+void AssetArchive::Write(
+    const std::string& archiveFilepath,
+    const std::vector<std::string>& assetFilepaths,
+    const std::vector< std::vector<char> >& assetContents)
+{
+    // CALCULATE WHERE THE ASSET DATA WILL START.
+    // The data follows the identifier, asset count, and index entry for each asset.
+    std::size_t indexSizeInBytes = sizeof(ARCHIVE_IDENTIFIER) + sizeof(uint32_t);
+    for (const std::string& assetFilepath : assetFilepaths)
+    {
+        indexSizeInBytes += sizeof(uint32_t) + assetFilepath.size() + sizeof(uint64_t) + sizeof(uint64_t);
+    }
+
+    // BUILD THE INDEX.
+    std::vector<char> index;
+    index.insert(index.end(), ARCHIVE_IDENTIFIER, ARCHIVE_IDENTIFIER + sizeof(ARCHIVE_IDENTIFIER));
+    AppendNumber(static_cast<uint32_t>(assetFilepaths.size()), index);
+
+    uint64_t assetOffset = indexSizeInBytes;
+    for (std::size_t assetIndex = 0; assetIndex < assetFilepaths.size(); ++assetIndex)
+    {
+        const std::string& assetFilepath = assetFilepaths[assetIndex];
+        AppendNumber(static_cast<uint32_t>(assetFilepath.size()), index);
+        index.insert(index.end(), assetFilepath.begin(), assetFilepath.end());
+
+        uint64_t assetSizeInBytes = assetContents[assetIndex].size();
+        AppendNumber(assetOffset, index);
+        AppendNumber(assetSizeInBytes, index);
+        assetOffset += assetSizeInBytes;
+    }
+
+    // WRITE THE ARCHIVE.
+    std::ofstream archiveFile(archiveFilepath, std::ios::binary);
+    archiveFile.write(index.data(), index.size());
+    for (const std::vector<char>& assetContent : assetContents)
+    {
+        archiveFile.write(assetContent.data(), assetContent.size());
+    }
+
+    bool archiveWritten = archiveFile.good();
+    if (!archiveWritten)
+    {
+        throw std::runtime_error("Error writing asset archive: " + archiveFilepath);
+    }
+}
+
+// INSTANCE METHODS.
+
+AssetArchive::AssetArchive() :
+    m_mappedData(nullptr),
+    m_mappedSizeInBytes(0),
+    m_assets()
+{
+    // Nothing else to do.
+}
+
+AssetArchive::~AssetArchive()
+{
+    Close();
+}
+
+bool AssetArchive::Open(const std::string& archiveFilepath)
+{
+    TRACE_SCOPE_WITH_DETAIL("resources", "OpenAssetArchive", archiveFilepath.c_str());
+
+    // CLOSE ANY PREVIOUSLY OPENED ARCHIVE.
+    Close();
+
+    // MAP THE ARCHIVE INTO MEMORY.
+    // The file and mapping handles are closed as soon as the view is mapped since
+    // the mapped view keeps the file mapped until it is unmapped.
+#if defined _WIN32
+    HANDLE archiveFile = CreateFileA(
+        archiveFilepath.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        NULL,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        NULL);
+    bool archiveFileOpened = (INVALID_HANDLE_VALUE != archiveFile);
+    if (!archiveFileOpened)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER archiveFileSize;
+    bool archiveFileSizeRetrieved = (0 != GetFileSizeEx(archiveFile, &archiveFileSize));
+    bool archiveFileEmpty = (archiveFileSizeRetrieved && 0 == archiveFileSize.QuadPart);
+    if (!archiveFileSizeRetrieved || archiveFileEmpty)
+    {
+        CloseHandle(archiveFile);
+        return false;
+    }
+
+    HANDLE archiveMapping = CreateFileMappingA(archiveFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(archiveFile);
+    bool archiveMappingCreated = (NULL != archiveMapping);
+    if (!archiveMappingCreated)
+    {
+        return false;
+    }
+
+    void* mappedArchive = MapViewOfFile(archiveMapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(archiveMapping);
+    bool archiveMapped = (NULL != mappedArchive);
+    if (!archiveMapped)
+    {
+        return false;
+    }
+
+    m_mappedData = static_cast<const unsigned char*>(mappedArchive);
+    m_mappedSizeInBytes = static_cast<std::size_t>(archiveFileSize.QuadPart);
+#else
+    int archiveFile = open(archiveFilepath.c_str(), O_RDONLY);
+    bool archiveFileOpened = (archiveFile >= 0);
+    if (!archiveFileOpened)
+    {
+        return false;
+    }
+
+    struct stat archiveFileStatus;
+    bool archiveFileSizeRetrieved = (0 == fstat(archiveFile, &archiveFileStatus));
+    bool archiveFileEmpty = (archiveFileSizeRetrieved && 0 == archiveFileStatus.st_size);
+    if (!archiveFileSizeRetrieved || archiveFileEmpty)
+    {
+        close(archiveFile);
+        return false;
+    }
+
+    std::size_t archiveFileSizeInBytes = static_cast<std::size_t>(archiveFileStatus.st_size);
+    void* mappedArchive = mmap(nullptr, archiveFileSizeInBytes, PROT_READ, MAP_PRIVATE, archiveFile, 0);
+    close(archiveFile);
+    bool archiveMapped = (MAP_FAILED != mappedArchive);
+    if (!archiveMapped)
+    {
+        return false;
+    }
+
+    m_mappedData = static_cast<const unsigned char*>(mappedArchive);
+    m_mappedSizeInBytes = archiveFileSizeInBytes;
+#endif
+
+    // READ THE INDEX OF ASSETS.
+    bool indexValid = ReadIndex();
+    if (!indexValid)
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+bool AssetArchive::IsOpen() const
+{
+    bool archiveOpen = (nullptr != m_mappedData);
+    return archiveOpen;
+}
+
+unsigned int AssetArchive::GetAssetCount() const
+{
+    return static_cast<unsigned int>(m_assets.size());
+}
+
+std::vector<std::string> AssetArchive::GetAssetFilepaths() const
+{
+    std::vector<std::string> assetFilepaths;
+    assetFilepaths.reserve(m_assets.size());
+    for (const auto& filepathAndAsset : m_assets)
+    {
+        assetFilepaths.push_back(filepathAndAsset.first);
+    }
+
+    return assetFilepaths;
+}
+
+const AssetData* AssetArchive::GetAsset(const std::string& assetFilepath) const
+{
+    auto asset = m_assets.find(assetFilepath);
+    bool assetInArchive = (m_assets.end() != asset);
+    if (!assetInArchive)
+    {
+        return nullptr;
+    }
+
+    return &asset->second;
+}
+
+void AssetArchive::Close()
+{
+    // CHECK IF AN ARCHIVE IS OPEN.
+    if (!IsOpen())
+    {
+        return;
+    }
+
+    // UNMAP THE ARCHIVE.
+#if defined _WIN32
+    UnmapViewOfFile(m_mappedData);
+#else
+    munmap(const_cast<unsigned char*>(m_mappedData), m_mappedSizeInBytes);
+#endif
+
+    m_mappedData = nullptr;
+    m_mappedSizeInBytes = 0;
+    m_assets.clear();
+}
+
+bool AssetArchive::ReadIndex()
+{
+    // VERIFY THAT THE FILE IS AN ASSET ARCHIVE.
+    bool identifierFits = (sizeof(ARCHIVE_IDENTIFIER) <= m_mappedSizeInBytes);
+    if (!identifierFits)
+    {
+        return false;
+    }
+
+    bool identifierMatches = (0 == std::memcmp(m_mappedData, ARCHIVE_IDENTIFIER, sizeof(ARCHIVE_IDENTIFIER)));
+    if (!identifierMatches)
+    {
+        return false;
+    }
+
+    // READ THE NUMBER OF ASSETS.
+    std::size_t readOffset = sizeof(ARCHIVE_IDENTIFIER);
+    uint32_t assetCount = 0;
+    bool assetCountRead = ReadNumber(m_mappedData, m_mappedSizeInBytes, readOffset, assetCount);
+    if (!assetCountRead)
+    {
+        return false;
+    }
+
+    // READ THE INDEX ENTRY FOR EACH ASSET.
+    // Every entry is checked against the size of the archive so that a truncated or
+    // corrupted archive can never cause data outside of the mapping to be read.
+    for (uint32_t assetIndex = 0; assetIndex < assetCount; ++assetIndex)
+    {
+        uint32_t filepathLength = 0;
+        bool filepathLengthRead = ReadNumber(m_mappedData, m_mappedSizeInBytes, readOffset, filepathLength);
+        bool filepathFits = filepathLengthRead && (filepathLength <= (m_mappedSizeInBytes - readOffset));
+        if (!filepathFits)
+        {
+            return false;
+        }
+
+        std::string assetFilepath(reinterpret_cast<const char*>(m_mappedData + readOffset), filepathLength);
+        readOffset += filepathLength;
+
+        uint64_t assetOffset = 0;
+        uint64_t assetSizeInBytes = 0;
+        bool assetOffsetRead = ReadNumber(m_mappedData, m_mappedSizeInBytes, readOffset, assetOffset);
+        bool assetSizeRead = assetOffsetRead && ReadNumber(m_mappedData, m_mappedSizeInBytes, readOffset, assetSizeInBytes);
+        bool assetFits = assetSizeRead &&
+            (assetOffset <= m_mappedSizeInBytes) &&
+            (assetSizeInBytes <= (m_mappedSizeInBytes - assetOffset));
+        if (!assetFits)
+        {
+            return false;
+        }
+
+        AssetData asset;
+        asset.Data = m_mappedData + assetOffset;
+        asset.SizeInBytes = static_cast<std::size_t>(assetSizeInBytes);
+        m_assets[assetFilepath] = asset;
+    }
+
+    return true;
+}
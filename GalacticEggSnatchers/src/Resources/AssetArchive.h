@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace RESOURCES
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  The raw file data for a single asset stored
+    ///         in an asset archive.
+    ////////////////////////////////////////////////////////
+    struct AssetData
+    {
+        const void* Data;   ///< The start of the asset's file data.
+        std::size_t SizeInBytes;    ///< The size of the asset's file data, in bytes.
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  A single file containing the data for many assets,
+    ///         indexed by the filepaths the assets would otherwise
+    ///         be loaded from.  The archive is memory-mapped when
+    ///         opened, so asset data is read directly from the
+    ///         mapping without opening or copying individual files.
+    ///
+    ///         Archives are created offline with Write().  The format
+    ///         is a header identifying the archive and its number
+    ///         of assets, followed by the filepath, offset, and size
+    ///         of each asset, followed by the data for all assets.
+    ///         Numbers are stored in the byte order of the machine
+    ///         the archive was written on.
+    ////////////////////////////////////////////////////////
+    class AssetArchive
+    {
+    public:
+        /// @brief  The filepath of the archive containing all game assets.
+        static const std::string DEFAULT_FILEPATH;
+
+        /// @brief          Writes an archive containing the specified assets.
+        ///                 An exception is thrown if any asset can't be read
+        ///                 or the archive can't be written.
+        /// @param[in]      archiveFilepath - The filepath of the archive to write.
+        /// @param[in]      assetFilepaths - The filepaths of the assets to store in the archive.
+        ///                 Assets are indexed in the archive by these same filepaths.
+        static void Write(const std::string& archiveFilepath, const std::vector<std::string>& assetFilepaths);
+
+        /// @brief          Writes an archive containing the specified asset data.
+        ///                 An exception is thrown if the archive can't be written.
+        /// @param[in]      archiveFilepath - The filepath of the archive to write.
+        /// @param[in]      assetFilepaths - The filepaths to index the assets by in the archive.
+        /// @param[in]      assetContents - The data to store for each asset, in the same order as the filepaths.
+        static void Write(
+            const std::string& archiveFilepath,
+            const std::vector<std::string>& assetFilepaths,
+            const std::vector< std::vector<char> >& assetContents);
+
+        /// @brief  Constructor.  Creates an archive that isn't open.
+        explicit AssetArchive();
+
+        /// @brief  Destructor.  Unmaps the archive if it is open.
+        ///         Any asset data retrieved from the archive becomes invalid.
+        ~AssetArchive();
+
+        /// @brief      Opens and memory-maps an archive, closing any previously opened archive.
+        /// @param[in]  archiveFilepath - The filepath of the archive to open.
+        /// @return     True if the archive was opened; false if it doesn't exist or isn't valid.
+        bool Open(const std::string& archiveFilepath);
+
+        /// @brief  Unmaps the archive if it is open.  Any asset data retrieved
+        ///         from the archive becomes invalid.
+        void Close();
+
+        /// @brief  Checks if an archive is open.
+        /// @return True if an archive is open; false otherwise.
+        bool IsOpen() const;
+
+        /// @brief  Gets the number of assets in the archive.
+        /// @return The number of assets in the open archive.  0 if no archive is open.
+        unsigned int GetAssetCount() const;
+
+        /// @brief  Gets the filepaths of all assets in the archive.
+        /// @return The filepaths the assets were stored under, in no particular order.
+        std::vector<std::string> GetAssetFilepaths() const;
+
+        /// @brief      Gets the data for an asset in the archive.  The data remains valid
+        ///             until the archive is closed or destroyed.
+        /// @param[in]  assetFilepath - The filepath the asset was stored under.
+        /// @return     The asset's data, if it is in the archive.  Nullptr otherwise.
+        const AssetData* GetAsset(const std::string& assetFilepath) const;
+
+    private:
+        AssetArchive(const AssetArchive& archiveToCopy);  ///< Private to disallow copying.
+        AssetArchive& operator= (const AssetArchive& rhsArchive); ///< Private to disallow assignment.
+
+        /// @brief  Reads the index of assets from the mapped archive.
+        /// @return True if the index is valid; false otherwise.
+        bool ReadIndex();
+
+        const unsigned char* m_mappedData;  ///< The memory-mapped contents of the archive.  Null if no archive is open.
+        std::size_t m_mappedSizeInBytes;    ///< The size of the memory-mapped archive, in bytes.
+        std::unordered_map<std::string, AssetData> m_assets;   ///< The data for each asset in the archive, by filepath.
+    };
+}
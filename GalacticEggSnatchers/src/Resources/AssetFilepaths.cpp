@@ -0,0 +1,34 @@
+#include "Resources/AssetFilepaths.h"
+
+/// @brief  The filepath of each asset, indexed by asset ID.
+static const std::string ASSET_FILEPATHS[] =
+{
+    "res/Images/alien1.png",
+    "res/Images/alien2.png",
+    "res/Images/Egg04.png",
+    "res/Images/Egg05.png",
+    "res/Images/Egg06.png",
+    "res/Images/Egg07.png",
+    "res/Images/Egg08.png",
+    "res/Images/bunny.png",
+    "res/Images/carrot.png",
+    "res/Images/alienMissile1.png",
+    "res/Images/explosion1.png",
+    "res/Fonts/Minecraftia.ttf",
+    "res/Sounds/Explosion.wav",
+    "res/Sounds/MissileLaunch.wav"
+};
+static_assert(
+    RESOURCES::ASSET_ID_COUNT == (sizeof(ASSET_FILEPATHS) / sizeof(ASSET_FILEPATHS[0])),
+    "A filepath must exist for every asset ID.");
+
+const std::string& RESOURCES::GetAssetFilepath(const AssetId assetId)
+{
+    return ASSET_FILEPATHS[assetId];
+}
+
+std::vector<std::string> RESOURCES::GetAllAssetFilepaths()
+{
+    std::vector<std::string> assetFilepaths(ASSET_FILEPATHS, ASSET_FILEPATHS + ASSET_ID_COUNT);
+    return assetFilepaths;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace RESOURCES
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Identifies each asset loaded by the game.  Code that
+    ///         needs assets while the game is running refers to them
+    ///         by these IDs, which index directly into tables of assets
+    ///         resolved when loading, so that no filepath strings need to
+    ///         be created or hashed.
+    ////////////////////////////////////////////////////////
+    enum AssetId
+    {
+        ASSET_IMAGE_ALIEN_1,    ///< The first alien appearance.
+        ASSET_IMAGE_ALIEN_2,    ///< The second alien appearance.
+        ASSET_IMAGE_EGG_04, ///< The first Easter egg appearance.
+        ASSET_IMAGE_EGG_05, ///< The second Easter egg appearance.
+        ASSET_IMAGE_EGG_06, ///< The third Easter egg appearance.
+        ASSET_IMAGE_EGG_07, ///< The fourth Easter egg appearance.
+        ASSET_IMAGE_EGG_08, ///< The fifth Easter egg appearance.
+        ASSET_IMAGE_BUNNY,  ///< The Easter bunny controlled by the player.
+        ASSET_IMAGE_CARROT, ///< The carrot missiles fired by the bunny.
+        ASSET_IMAGE_ALIEN_MISSILE,  ///< The missiles fired by aliens.
+        ASSET_IMAGE_EXPLOSION,  ///< The explosion of a destroyed object.
+        ASSET_FONT_MINECRAFTIA, ///< The font for all text.
+        ASSET_SOUND_EXPLOSION,  ///< The sound of an explosion.
+        ASSET_SOUND_MISSILE_LAUNCH, ///< The sound of launching a missile.
+        ASSET_ID_COUNT  ///< The number of assets.  Not a valid asset.
+    };
+
+    /// @brief      Gets the filepath of an asset.  The filepath is looked up
+    ///             by indexing into a table, so no string is created.
+    /// @param[in]  assetId - The ID of the asset.
+    /// @return     The filepath of the asset.
+    const std::string& GetAssetFilepath(const AssetId assetId);
+
+    /// @brief  Gets the filepaths of all assets loaded by the game, which are the
+    ///         assets packed into the asset archive.
+    /// @return The filepaths of all images, fonts, and sounds used by the game.
+    std::vector<std::string> GetAllAssetFilepaths();
+}
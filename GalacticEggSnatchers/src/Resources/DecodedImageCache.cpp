@@ -0,0 +1,217 @@
+#include <cstring>
+#include <stdexcept>
+#include "Profiling/Profiling.h"
+#include "Resources/DecodedImageCache.h"
+
+using namespace RESOURCES;
+
+// STATIC CONSTANT INITIALIZATION.
+const std::string DecodedImageCache::DEFAULT_FILEPATH = "res/DecodedImages.cache";
+
+////////////////////////////////////////////////////////
+/// @brief  The information stored before the pixels of
+///         each decoded image in the cache.
+////////////////////////////////////////////////////////
+struct DecodedImageHeader
+{
+    uint64_t ContentHash;   ///< The hash of the encoded file the image was decoded from.
+    uint32_t WidthInPixels; ///< The width of the image, in pixels.
+    uint32_t HeightInPixels;    ///< The height of the image, in pixels.
+};
+
+/// @brief  The number of bytes for each pixel of a decoded image (red, green, blue, and alpha).
+static const std::size_t BYTES_PER_PIXEL = 4;
+
+// STATIC METHODS.
+
+uint64_t DecodedImageCache::ComputeContentHash(const void* data, const std::size_t sizeInBytes)
+{
+    const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    const uint64_t FNV_PRIME = 1099511628211ULL;
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t byteIndex = 0; byteIndex < sizeInBytes; ++byteIndex)
+    {
+        hash ^= bytes[byteIndex];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+std::shared_ptr<sf::Image> DecodedImageCache::CreateImage(
+    const void* cacheEntry,
+    const std::size_t cacheEntrySizeInBytes,
+    const uint64_t contentHash)
+{
+    // READ THE HEADER.
+    // It is copied out since entries aren't necessarily aligned in the cache file.
+    bool headerFits = (sizeof(DecodedImageHeader) <= cacheEntrySizeInBytes);
+    if (!headerFits)
+    {
+        return nullptr;
+    }
+
+    DecodedImageHeader header;
+    std::memcpy(&header, cacheEntry, sizeof(header));
+
+    // CHECK IF THE IMAGE WAS DECODED FROM THE CURRENT FILE CONTENTS.
+    bool imageStale = (contentHash != header.ContentHash);
+    if (imageStale)
+    {
+        return nullptr;
+    }
+
+    // VERIFY THAT ALL PIXELS ARE PRESENT.
+    std::size_t pixelDataSizeInBytes = static_cast<std::size_t>(header.WidthInPixels) * header.HeightInPixels * BYTES_PER_PIXEL;
+    bool pixelsFit = (pixelDataSizeInBytes == (cacheEntrySizeInBytes - sizeof(header)));
+    if (!pixelsFit)
+    {
+        return nullptr;
+    }
+
+    // CREATE THE IMAGE FROM THE PIXELS.
+    const sf::Uint8* pixels = static_cast<const sf::Uint8*>(cacheEntry) + sizeof(header);
+    std::shared_ptr<sf::Image> image = std::make_shared<sf::Image>();
+    image->create(header.WidthInPixels, header.HeightInPixels, pixels);
+    return image;
+}
+
+// INSTANCE METHODS.
+
+DecodedImageCache::DecodedImageCache() :
+    m_cacheFilepath(),
+    m_savedImages(),
+    m_addedImages()
+{
+    // Nothing else to do.
+}
+
+DecodedImageCache::~DecodedImageCache()
+{
+    // Nothing to do.
+}
+
+void DecodedImageCache::Open(const std::string& cacheFilepath)
+{
+    m_cacheFilepath = cacheFilepath;
+    m_addedImages.clear();
+
+    // A missing or invalid cache simply leaves the cache empty.
+    m_savedImages.Open(cacheFilepath);
+}
+
+std::shared_ptr<sf::Image> DecodedImageCache::GetImage(const std::string& imageFilepath, const uint64_t contentHash) const
+{
+    // CHECK THE MOST RECENTLY ADDED IMAGES FIRST.
+    // They replace any stale images in the cache file.
+    auto addedImage = m_addedImages.find(imageFilepath);
+    bool imageAdded = (m_addedImages.end() != addedImage);
+    if (imageAdded)
+    {
+        const std::vector<char>& cacheEntry = addedImage->second;
+        return CreateImage(cacheEntry.data(), cacheEntry.size(), contentHash);
+    }
+
+    // CHECK THE IMAGES FROM THE CACHE FILE.
+    const AssetData* savedImage = m_savedImages.GetAsset(imageFilepath);
+    bool imageSaved = (nullptr != savedImage);
+    if (imageSaved)
+    {
+        TRACE_SCOPE_WITH_DETAIL("resources", "GetDecodedImage", imageFilepath.c_str());
+        return CreateImage(savedImage->Data, savedImage->SizeInBytes, contentHash);
+    }
+
+    return nullptr;
+}
+
+void DecodedImageCache::AddImage(const std::string& imageFilepath, const uint64_t contentHash, const sf::Image& image)
+{
+    // CREATE THE HEADER.
+    sf::Vector2u imageSize = image.getSize();
+    DecodedImageHeader header;
+    header.ContentHash = contentHash;
+    header.WidthInPixels = imageSize.x;
+    header.HeightInPixels = imageSize.y;
+
+    // CREATE THE CACHE ENTRY FROM THE HEADER AND PIXELS.
+    std::size_t pixelDataSizeInBytes = static_cast<std::size_t>(imageSize.x) * imageSize.y * BYTES_PER_PIXEL;
+    std::vector<char> cacheEntry(sizeof(header) + pixelDataSizeInBytes);
+    std::memcpy(cacheEntry.data(), &header, sizeof(header));
+
+    bool pixelsExist = (pixelDataSizeInBytes > 0);
+    if (pixelsExist)
+    {
+        std::memcpy(cacheEntry.data() + sizeof(header), image.getPixelsPtr(), pixelDataSizeInBytes);
+    }
+
+    m_addedImages[imageFilepath] = cacheEntry;
+}
+
+bool DecodedImageCache::IsModified() const
+{
+    bool imagesAdded = !m_addedImages.empty();
+    return imagesAdded;
+}
+
+bool DecodedImageCache::Save()
+{
+    // CHECK IF THE CACHE FILE NEEDS TO BE WRITTEN.
+    if (!IsModified())
+    {
+        return true;
+    }
+
+    bool cacheFileExists = !m_cacheFilepath.empty();
+    if (!cacheFileExists)
+    {
+        return false;
+    }
+
+    TRACE_SCOPE_WITH_DETAIL("resources", "SaveDecodedImageCache", m_cacheFilepath.c_str());
+
+    // GATHER ALL CACHE ENTRIES.
+    // Entries from the cache file are copied since the file must be unmapped before
+    // it can be overwritten.  Stale entries replaced by newly added images are skipped.
+    std::vector<std::string> imageFilepaths;
+    std::vector< std::vector<char> > cacheEntries;
+    std::vector<std::string> savedImageFilepaths = m_savedImages.GetAssetFilepaths();
+    for (const std::string& savedImageFilepath : savedImageFilepaths)
+    {
+        bool imageReplaced = (m_addedImages.end() != m_addedImages.find(savedImageFilepath));
+        if (imageReplaced)
+        {
+            continue;
+        }
+
+        const AssetData* savedImage = m_savedImages.GetAsset(savedImageFilepath);
+        const char* savedImageData = static_cast<const char*>(savedImage->Data);
+        imageFilepaths.push_back(savedImageFilepath);
+        cacheEntries.push_back(std::vector<char>(savedImageData, savedImageData + savedImage->SizeInBytes));
+    }
+
+    for (const auto& filepathAndCacheEntry : m_addedImages)
+    {
+        imageFilepaths.push_back(filepathAndCacheEntry.first);
+        cacheEntries.push_back(filepathAndCacheEntry.second);
+    }
+
+    // WRITE THE CACHE FILE.
+    m_savedImages.Close();
+    try
+    {
+        AssetArchive::Write(m_cacheFilepath, imageFilepaths, cacheEntries);
+    }
+    catch (const std::runtime_error&)
+    {
+        // The added images are kept so that saving may be tried again.
+        m_savedImages.Open(m_cacheFilepath);
+        return false;
+    }
+
+    // USE THE NEWLY WRITTEN CACHE FILE.
+    m_addedImages.clear();
+    m_savedImages.Open(m_cacheFilepath);
+    return true;
+}
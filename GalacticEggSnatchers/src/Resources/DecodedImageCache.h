@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "Resources/AssetArchive.h"
+
+namespace RESOURCES
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  A cache of images that have already been decoded
+    ///         and masked, stored as raw pixels so that they can
+    ///         be loaded with a single copy instead of decoding
+    ///         their original files again.
+    ///
+    ///         Each cached image records a hash of the encoded
+    ///         file it was decoded from.  If the file changes,
+    ///         its hash no longer matches, so the stale pixels
+    ///         are ignored and the image is decoded again.
+    ///
+    ///         The cache is stored as an asset archive, so cached
+    ///         pixels are read directly from its memory mapping.
+    ///         Newly decoded images are only written to the cache
+    ///         file when the cache is saved.
+    ////////////////////////////////////////////////////////
+    class DecodedImageCache
+    {
+    public:
+        /// @brief  The filepath of the cache of decoded game images.
+        static const std::string DEFAULT_FILEPATH;
+
+        /// @brief      Computes a hash identifying the contents of an encoded file.
+        ///             The 64-bit FNV-1a hash is used since it is fast and has few
+        ///             enough collisions for detecting changed files.
+        /// @param[in]  data - The file data to hash.
+        /// @param[in]  sizeInBytes - The size of the file data, in bytes.
+        /// @return     The hash of the file data.
+        static uint64_t ComputeContentHash(const void* data, const std::size_t sizeInBytes);
+
+        /// @brief  Constructor.  Creates an empty cache that isn't saved to any file.
+        explicit DecodedImageCache();
+
+        /// @brief  Destructor.
+        ~DecodedImageCache();
+
+        /// @brief      Opens a cache file, which is saved back to the same file.
+        ///             The cache is simply empty if the file doesn't exist yet or isn't valid.
+        /// @param[in]  cacheFilepath - The filepath of the cache.
+        void Open(const std::string& cacheFilepath);
+
+        /// @brief      Gets a cached image that was decoded from the specified file contents.
+        /// @param[in]  imageFilepath - The filepath the image was originally loaded from.
+        /// @param[in]  contentHash - The hash of the current contents of the encoded image file.
+        /// @return     The cached image, if it was decoded from file contents with the same hash.
+        ///             Nullptr otherwise.
+        std::shared_ptr<sf::Image> GetImage(const std::string& imageFilepath, const uint64_t contentHash) const;
+
+        /// @brief      Adds a newly decoded image to the cache, replacing any stale image for the same file.
+        /// @param[in]  imageFilepath - The filepath the image was loaded from.
+        /// @param[in]  contentHash - The hash of the contents of the encoded image file.
+        /// @param[in]  image - The decoded image.
+        void AddImage(const std::string& imageFilepath, const uint64_t contentHash, const sf::Image& image);
+
+        /// @brief  Checks if images have been added since the cache was opened or last saved.
+        /// @return True if the cache has unsaved images; false otherwise.
+        bool IsModified() const;
+
+        /// @brief  Writes all cached images to the cache file if images have been added.
+        ///         Saving is best-effort since the cache only speeds up loading;
+        ///         false is returned if the cache could not be written.
+        /// @return True if the cache file is up-to-date; false otherwise.
+        bool Save();
+
+    private:
+        DecodedImageCache(const DecodedImageCache& cacheToCopy);  ///< Private to disallow copying.
+        DecodedImageCache& operator= (const DecodedImageCache& rhsCache); ///< Private to disallow assignment.
+
+        /// @brief      Creates an image from a cache entry, if the entry matches the file contents.
+        /// @param[in]  cacheEntry - The cache entry containing the decoded image.
+        /// @param[in]  cacheEntrySizeInBytes - The size of the cache entry, in bytes.
+        /// @param[in]  contentHash - The hash of the current contents of the encoded image file.
+        /// @return     The image, if the entry is valid and has the same hash.  Nullptr otherwise.
+        static std::shared_ptr<sf::Image> CreateImage(
+            const void* cacheEntry,
+            const std::size_t cacheEntrySizeInBytes,
+            const uint64_t contentHash);
+
+        std::string m_cacheFilepath;    ///< The filepath the cache is saved to.  Empty if the cache isn't saved.
+        AssetArchive m_savedImages;  ///< The images in the cache file when it was opened.
+        std::unordered_map< std::string, std::vector<char> > m_addedImages; ///< Cache entries for images added since the cache was opened, by filepath.
+    };
+}
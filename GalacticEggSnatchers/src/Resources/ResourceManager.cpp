@@ -1,41 +1,315 @@
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "Profiling/Profiling.h"
+#include "Resources/AssetFilepaths.h"
 #include "Resources/ResourceManager.h"
 
 using namespace RESOURCES;
 
+/// @brief      Estimates the memory used by an image's pixels.
+/// @param[in]  imageSize - The size of the image, in pixels.
+/// @return     The estimated memory used by the image, in bytes.
+static std::size_t GetImageSizeInBytes(const sf::Vector2u& imageSize)
+{
+    const std::size_t BYTES_PER_PIXEL = 4;
+    std::size_t imageSizeInBytes = static_cast<std::size_t>(imageSize.x) * static_cast<std::size_t>(imageSize.y) * BYTES_PER_PIXEL;
+    return imageSizeInBytes;
+}
+
+/// @brief  Estimates the memory used by a font.  The memory used by glyphs
+///         rendered from a font isn't known, so it isn't counted.
+/// @return The estimated memory used by the font, in bytes.
+static std::size_t GetFontSizeInBytes()
+{
+    const std::size_t UNKNOWN_FONT_SIZE_IN_BYTES = 0;
+    return UNKNOWN_FONT_SIZE_IN_BYTES;
+}
+
+/// @brief      Estimates the memory used by a sound buffer's samples.
+/// @param[in]  soundBuffer - The sound buffer.
+/// @return     The estimated memory used by the sound buffer, in bytes.
+static std::size_t GetSoundBufferSizeInBytes(const sf::SoundBuffer& soundBuffer)
+{
+    std::size_t soundBufferSizeInBytes = static_cast<std::size_t>(soundBuffer.getSampleCount()) * sizeof(sf::Int16);
+    return soundBufferSizeInBytes;
+}
+
+/// @brief      Checks if a filepath ends with the specified extension.
+/// @param[in]  filepath - The filepath to check.
+/// @param[in]  extension - The extension, including the leading period.
+/// @return     True if the filepath has the extension; false otherwise.
+static bool HasFileExtension(const std::string& filepath, const std::string& extension)
+{
+    bool filepathLongEnough = (filepath.size() >= extension.size());
+    if (!filepathLongEnough)
+    {
+        return false;
+    }
+
+    bool extensionMatches = (0 == filepath.compare(filepath.size() - extension.size(), extension.size(), extension));
+    return extensionMatches;
+}
+
+// STATIC METHODS.
+
+unsigned int ResourceManager::GetDefaultPreloadThreadCount()
+{
+    // The hardware concurrency may be unknown, in which case assets are simply loaded serially.
+    const unsigned int MIN_THREAD_COUNT = 1;
+    unsigned int hardwareThreadCount = std::thread::hardware_concurrency();
+    unsigned int threadCount = std::max(MIN_THREAD_COUNT, hardwareThreadCount);
+    return threadCount;
+}
+
+ResourceManager::ResourceKind ResourceManager::GetPreloadedResourceKind(const std::string& filepath)
+{
+    if (HasFileExtension(filepath, ".png"))
+    {
+        return RESOURCE_KIND_IMAGE;
+    }
+    else if (HasFileExtension(filepath, ".ttf"))
+    {
+        return RESOURCE_KIND_FONT;
+    }
+    else if (HasFileExtension(filepath, ".wav") || HasFileExtension(filepath, ".ogg"))
+    {
+        return RESOURCE_KIND_SOUND_BUFFER;
+    }
+    else
+    {
+        return RESOURCE_KIND_NONE;
+    }
+}
+
+// INSTANCE METHODS.
+
 ResourceManager::ResourceManager() :
+    m_archive(),
+    m_decodedImageCache(),
+    m_memoryBudgetInBytes(UNLIMITED_MEMORY_BUDGET),
+    m_memoryUsageInBytes(0),
+    m_useCounter(0),
     m_textures(),
+    m_images(),
     m_fonts(),
     m_sounds()
 {
     // Nothing to do.
 }
 
-ResourceManager::~ResourceManager()
+ResourceManager::ResourceManager(const std::size_t memoryBudgetInBytes) :
+    m_archive(),
+    m_decodedImageCache(),
+    m_memoryBudgetInBytes(memoryBudgetInBytes),
+    m_memoryUsageInBytes(0),
+    m_useCounter(0),
+    m_textures(),
+    m_images(),
+    m_fonts(),
+    m_sounds()
 {
     // Nothing to do.
 }
 
+ResourceManager::~ResourceManager()
+{
+    // SAVE ANY NEWLY DECODED IMAGES.
+    // Failing to save only means the images will be decoded again next time.
+    SaveDecodedImageCache();
+}
+
+bool ResourceManager::MountArchive(const std::string& archiveFilepath)
+{
+    bool archiveMounted = m_archive.Open(archiveFilepath);
+    return archiveMounted;
+}
+
+void ResourceManager::OpenDecodedImageCache(const std::string& cacheFilepath)
+{
+    m_decodedImageCache.Open(cacheFilepath);
+}
+
+bool ResourceManager::SaveDecodedImageCache()
+{
+    bool cacheSaved = m_decodedImageCache.Save();
+    return cacheSaved;
+}
+
+sf::Time ResourceManager::PreloadAssets(const std::vector<std::string>& filepaths, const unsigned int threadCount)
+{
+    TRACE_SCOPE("resources", "PreloadAssets");
+    sf::Clock preloadClock;
+
+    // DETERMINE WHICH ASSETS STILL NEED TO BE LOADED.
+    // Sound buffers are created here rather than on the worker threads since creating
+    // the first one initializes the audio device, which must only happen once.
+    std::vector<PreloadedAsset> assets;
+    assets.reserve(filepaths.size());
+    for (const std::string& filepath : filepaths)
+    {
+        PreloadedAsset asset;
+        asset.Filepath = filepath;
+        asset.Kind = GetPreloadedResourceKind(filepath);
+        asset.ContentHash = 0;
+        asset.ImageNewlyDecoded = false;
+        asset.Loaded = false;
+        switch (asset.Kind)
+        {
+        case RESOURCE_KIND_IMAGE:
+        {
+            bool imageAlreadyLoaded = (m_images.end() != m_images.find(filepath));
+            if (imageAlreadyLoaded)
+            {
+                continue;
+            }
+            break;
+        }
+        case RESOURCE_KIND_FONT:
+        {
+            bool fontAlreadyLoaded = (m_fonts.end() != m_fonts.find(filepath));
+            if (fontAlreadyLoaded)
+            {
+                continue;
+            }
+            asset.Font = std::make_shared<sf::Font>();
+            break;
+        }
+        case RESOURCE_KIND_SOUND_BUFFER:
+        {
+            bool soundAlreadyLoaded = (m_sounds.end() != m_sounds.find(filepath));
+            if (soundAlreadyLoaded)
+            {
+                continue;
+            }
+            asset.SoundBuffer = std::make_shared<sf::SoundBuffer>();
+            break;
+        }
+        default:
+            // Other kinds of assets can't be preloaded.
+            continue;
+        }
+
+        assets.push_back(asset);
+    }
+
+    // DECODE THE ASSETS CONCURRENTLY.
+    // Each thread repeatedly claims the next asset that hasn't been claimed yet,
+    // so threads that finish small assets quickly move on to the remaining ones.
+    // Decoding only reads from this object, and each asset is only written by the
+    // thread that claimed it, so no other synchronization is needed.  The calling
+    // thread also decodes assets, so a single thread loads everything serially.
+    std::atomic<unsigned int> nextAssetIndex(0);
+    auto decodeAssets = [this, &assets, &nextAssetIndex]()
+    {
+        for (unsigned int assetIndex = nextAssetIndex++; assetIndex < assets.size(); assetIndex = nextAssetIndex++)
+        {
+            DecodePreloadedAsset(assets[assetIndex]);
+        }
+    };
+
+    unsigned int workerThreadCount = (threadCount > 1) ? (threadCount - 1) : 0;
+    std::vector<std::thread> workerThreads;
+    for (unsigned int workerThreadIndex = 0; workerThreadIndex < workerThreadCount; ++workerThreadIndex)
+    {
+        workerThreads.push_back(std::thread(decodeAssets));
+    }
+    decodeAssets();
+    for (std::thread& workerThread : workerThreads)
+    {
+        workerThread.join();
+    }
+
+    // STORE THE DECODED ASSETS IN THIS OBJECT.
+    // This is done serially since it modifies the caches.  Creating textures for the
+    // graphics device also remains on the calling thread, from the cached images.
+    for (const PreloadedAsset& asset : assets)
+    {
+        if (!asset.Loaded)
+        {
+            continue;
+        }
+
+        switch (asset.Kind)
+        {
+        case RESOURCE_KIND_IMAGE:
+            if (asset.ImageNewlyDecoded)
+            {
+                m_decodedImageCache.AddImage(asset.Filepath, asset.ContentHash, *asset.Image);
+            }
+            AddCachedResource(m_images, asset.Filepath, asset.Image, GetImageSizeInBytes(asset.Image->getSize()));
+            break;
+        case RESOURCE_KIND_FONT:
+            AddCachedResource(m_fonts, asset.Filepath, asset.Font, GetFontSizeInBytes());
+            break;
+        case RESOURCE_KIND_SOUND_BUFFER:
+            AddCachedResource(m_sounds, asset.Filepath, asset.SoundBuffer, GetSoundBufferSizeInBytes(*asset.SoundBuffer));
+            break;
+        default:
+            break;
+        }
+    }
+
+    return preloadClock.getElapsedTime();
+}
+
+void ResourceManager::LoadAllAssets(const bool headlessMode)
+{
+    // LOAD ASSETS FROM THE PACKED ARCHIVE IF ONE HAS BEEN BUILT.
+    // Assets are loaded from individual files otherwise.
+    MountArchive(AssetArchive::DEFAULT_FILEPATH);
+
+    // LOAD IMAGES FROM PREVIOUSLY DECODED PIXELS WHEN THEIR FILES HAVEN'T CHANGED.
+    OpenDecodedImageCache(DecodedImageCache::DEFAULT_FILEPATH);
+
+    // DETERMINE WHICH ASSETS ARE NEEDED.
+    // Without a window or audio device, only images are used.
+    std::vector<std::string> assetFilepaths = GetAllAssetFilepaths();
+    if (headlessMode)
+    {
+        std::vector<std::string> imageFilepaths;
+        for (const std::string& assetFilepath : assetFilepaths)
+        {
+            bool assetIsImage = (RESOURCE_KIND_IMAGE == GetPreloadedResourceKind(assetFilepath));
+            if (assetIsImage)
+            {
+                imageFilepaths.push_back(assetFilepath);
+            }
+        }
+        assetFilepaths.swap(imageFilepaths);
+    }
+
+    // DECODE THE ASSETS UP FRONT ACROSS ALL AVAILABLE THREADS.
+    // Users of the assets then find them already loaded instead of decoding them one at a time.
+    PreloadAssets(assetFilepaths, GetDefaultPreloadThreadCount());
+}
+
 std::shared_ptr<sf::Texture> ResourceManager::GetTexture(const std::string& filepath)
 {
+    PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_RESOURCES);
+
     // CHECK IF THIS SPECIFIED TEXTURE HAS ALREADY BEEN LOADED.
-    auto preloadedTextureResource = m_textures.find(filepath);
-    bool textureAlreadyLoaded = (preloadedTextureResource != m_textures.end());
+    std::shared_ptr<sf::Texture> preloadedTexture = FindCachedResource(m_textures, filepath);
+    bool textureAlreadyLoaded = (nullptr != preloadedTexture);
     if (textureAlreadyLoaded)
     {
         // Return the already loaded texture resource.
-        return preloadedTextureResource->second;
+        return preloadedTexture;
     }
 
     // LOAD THE TEXTURE IMAGE FROM FILE.
-    std::shared_ptr<sf::Image> textureImage = std::make_shared<sf::Image>();
-    bool imageLoaded = textureImage->loadFromFile(filepath);
+    // Only loads are traced since lookups of already loaded resources are frequent and cheap.
+    TRACE_SCOPE_WITH_DETAIL("resources", "GetTexture", filepath.c_str());
+    std::shared_ptr<sf::Image> textureImage = LoadMaskedImage(filepath);
+    bool imageLoaded = (nullptr != textureImage);
     if (!imageLoaded)
     {
         return nullptr;
     }
-    // Set the standard transparent color for the images.
-    const sf::Color TRANSPARENT_COLOR = sf::Color::Magenta;
-    textureImage->createMaskFromColor(TRANSPARENT_COLOR);
 
     // CREATE A TEXTURE FROM THE IMAGE.
     std::shared_ptr<sf::Texture> texture = std::make_shared<sf::Texture>();
@@ -43,7 +317,7 @@ std::shared_ptr<sf::Texture> ResourceManager::GetTexture(const std::string& file
     if (textureLoaded)
     {
         // Store the texture in this object so that it persists in memory.
-        m_textures[filepath] = texture;
+        AddCachedResource(m_textures, filepath, texture, GetImageSizeInBytes(texture->getSize()));
 
         return texture;
     }
@@ -54,24 +328,53 @@ std::shared_ptr<sf::Texture> ResourceManager::GetTexture(const std::string& file
     }
 }
 
+std::shared_ptr<sf::Image> ResourceManager::GetImage(const std::string& filepath)
+{
+    PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_RESOURCES);
+
+    // CHECK IF THIS SPECIFIED IMAGE HAS ALREADY BEEN LOADED.
+    std::shared_ptr<sf::Image> preloadedImage = FindCachedResource(m_images, filepath);
+    bool imageAlreadyLoaded = (nullptr != preloadedImage);
+    if (imageAlreadyLoaded)
+    {
+        // Return the already loaded image resource.
+        return preloadedImage;
+    }
+
+    // LOAD THE IMAGE FROM FILE.
+    TRACE_SCOPE_WITH_DETAIL("resources", "GetImage", filepath.c_str());
+    std::shared_ptr<sf::Image> image = LoadMaskedImage(filepath);
+    bool imageLoaded = (nullptr != image);
+    if (imageLoaded)
+    {
+        // Store the image in this object so that it persists in memory.
+        AddCachedResource(m_images, filepath, image, GetImageSizeInBytes(image->getSize()));
+    }
+
+    return image;
+}
+
 std::shared_ptr<sf::Font> ResourceManager::GetFont(const std::string& filepath)
 {
+    PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_RESOURCES);
+
     // CHECK IF THIS SPECIFIED FONT HAS ALREADY BEEN LOADED.
-    auto preloadedFontResource = m_fonts.find(filepath);
-    bool fontAlreadyLoaded = (preloadedFontResource != m_fonts.end());
+    std::shared_ptr<sf::Font> preloadedFont = FindCachedResource(m_fonts, filepath);
+    bool fontAlreadyLoaded = (nullptr != preloadedFont);
     if (fontAlreadyLoaded)
     {
         // Return the already loaded font resource.
-        return preloadedFontResource->second;
+        return preloadedFont;
     }
 
-    // CREATE A FONT FROM FILE.
+    // CREATE A FONT FROM THE ARCHIVE OR FILE.
+    TRACE_SCOPE_WITH_DETAIL("resources", "GetFont", filepath.c_str());
     std::shared_ptr<sf::Font> font = std::make_shared<sf::Font>();
-    bool fontLoaded = font->loadFromFile(filepath);
+    bool fontLoaded = LoadFont(filepath, *font);
     if (fontLoaded)
     {
         // Store the font in this object so that it persists in memory.
-        m_fonts[filepath] = font;
+        AddCachedResource(m_fonts, filepath, font, GetFontSizeInBytes());
 
         return font;
     }
@@ -84,22 +387,25 @@ std::shared_ptr<sf::Font> ResourceManager::GetFont(const std::string& filepath)
 
 std::shared_ptr<sf::SoundBuffer> ResourceManager::GetSoundBuffer(const std::string& filepath)
 {
+    PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_RESOURCES);
+
     // CHECK IF THIS SPECIFIED SOUND BUFFER HAS ALREADY BEEN LOADED.
-    auto preloadedSoundResource = m_sounds.find(filepath);
-    bool soundAlreadyLoaded = (preloadedSoundResource != m_sounds.end());
+    std::shared_ptr<sf::SoundBuffer> preloadedSoundBuffer = FindCachedResource(m_sounds, filepath);
+    bool soundAlreadyLoaded = (nullptr != preloadedSoundBuffer);
     if (soundAlreadyLoaded)
     {
         // Return the already loaded sound resource.
-        return preloadedSoundResource->second;
+        return preloadedSoundBuffer;
     }
 
-    // CREATE A SOUND BUFFER FROM FILE.
+    // CREATE A SOUND BUFFER FROM THE ARCHIVE OR FILE.
+    TRACE_SCOPE_WITH_DETAIL("resources", "GetSoundBuffer", filepath.c_str());
     std::shared_ptr<sf::SoundBuffer> soundBuffer = std::make_shared<sf::SoundBuffer>();
-    bool soundLoaded = soundBuffer->loadFromFile(filepath);
+    bool soundLoaded = LoadSoundBuffer(filepath, *soundBuffer);
     if (soundLoaded)
     {
         // Store the sound in this object so that it persists in memory.
-        m_sounds[filepath] = soundBuffer;
+        AddCachedResource(m_sounds, filepath, soundBuffer, GetSoundBufferSizeInBytes(*soundBuffer));
 
         return soundBuffer;
     }
@@ -108,4 +414,334 @@ std::shared_ptr<sf::SoundBuffer> ResourceManager::GetSoundBuffer(const std::stri
         // No sound buffer could be loaded.
         return nullptr;
     }
+}
+
+std::size_t ResourceManager::GetMemoryBudgetInBytes() const
+{
+    return m_memoryBudgetInBytes;
+}
+
+void ResourceManager::SetMemoryBudgetInBytes(const std::size_t memoryBudgetInBytes)
+{
+    m_memoryBudgetInBytes = memoryBudgetInBytes;
+    EvictResourcesOverBudget();
+}
+
+std::size_t ResourceManager::GetMemoryUsageInBytes() const
+{
+    return m_memoryUsageInBytes;
+}
+
+unsigned int ResourceManager::GetResourceCount() const
+{
+    std::size_t resourceCount = m_textures.size() + m_images.size() + m_fonts.size() + m_sounds.size();
+    return static_cast<unsigned int>(resourceCount);
+}
+
+void ResourceManager::EvictUnusedResources()
+{
+    EvictUnusedCachedResources(m_textures);
+    EvictUnusedCachedResources(m_images);
+    EvictUnusedCachedResources(m_fonts);
+    EvictUnusedCachedResources(m_sounds);
+}
+
+std::shared_ptr<sf::Image> ResourceManager::LoadMaskedImage(const std::string& filepath)
+{
+    // DECODE THE IMAGE.
+    uint64_t contentHash = 0;
+    bool imageNewlyDecoded = false;
+    std::shared_ptr<sf::Image> image = DecodeMaskedImage(filepath, contentHash, imageNewlyDecoded);
+
+    // CACHE THE DECODED IMAGE SO THAT IT DOESN'T NEED TO BE DECODED AGAIN.
+    if (imageNewlyDecoded)
+    {
+        m_decodedImageCache.AddImage(filepath, contentHash, *image);
+    }
+
+    return image;
+}
+
+std::shared_ptr<sf::Image> ResourceManager::DecodeMaskedImage(
+    const std::string& filepath,
+    uint64_t& contentHash,
+    bool& newlyDecoded) const
+{
+    newlyDecoded = false;
+
+    // GET THE ENCODED IMAGE FROM THE ARCHIVE OR FILE.
+    const void* encodedImageData = nullptr;
+    std::size_t encodedImageSizeInBytes = 0;
+    std::vector<char> encodedImageFileContents;
+    const AssetData* archivedImage = m_archive.GetAsset(filepath);
+    if (nullptr != archivedImage)
+    {
+        encodedImageData = archivedImage->Data;
+        encodedImageSizeInBytes = archivedImage->SizeInBytes;
+    }
+    else
+    {
+        std::ifstream imageFile(filepath, std::ios::binary);
+        if (!imageFile)
+        {
+            return nullptr;
+        }
+
+        encodedImageFileContents.assign(
+            (std::istreambuf_iterator<char>(imageFile)),
+            std::istreambuf_iterator<char>());
+        encodedImageData = encodedImageFileContents.data();
+        encodedImageSizeInBytes = encodedImageFileContents.size();
+    }
+
+    // CHECK IF THE IMAGE HAS ALREADY BEEN DECODED FROM THE SAME CONTENTS.
+    // Hashing the encoded data is much cheaper than decoding it, and a changed
+    // file won't match the hash of the contents its cached pixels came from.
+    contentHash = DecodedImageCache::ComputeContentHash(encodedImageData, encodedImageSizeInBytes);
+    std::shared_ptr<sf::Image> decodedImage = m_decodedImageCache.GetImage(filepath, contentHash);
+    bool imageAlreadyDecoded = (nullptr != decodedImage);
+    if (imageAlreadyDecoded)
+    {
+        return decodedImage;
+    }
+
+    // DECODE THE IMAGE.
+    std::shared_ptr<sf::Image> image = std::make_shared<sf::Image>();
+    bool imageLoaded = image->loadFromMemory(encodedImageData, encodedImageSizeInBytes);
+    if (!imageLoaded)
+    {
+        return nullptr;
+    }
+
+    // Set the standard transparent color for the images.
+    const sf::Color TRANSPARENT_COLOR = sf::Color::Magenta;
+    image->createMaskFromColor(TRANSPARENT_COLOR);
+
+    newlyDecoded = true;
+    return image;
+}
+
+bool ResourceManager::LoadFont(const std::string& filepath, sf::Font& font) const
+{
+    // Fonts read from their data as glyphs are needed, which is safe for the
+    // archive since it remains mapped as long as this object is alive.
+    const AssetData* archivedFont = m_archive.GetAsset(filepath);
+    bool fontLoaded = (nullptr != archivedFont) ?
+        font.loadFromMemory(archivedFont->Data, archivedFont->SizeInBytes) :
+        font.loadFromFile(filepath);
+    return fontLoaded;
+}
+
+bool ResourceManager::LoadSoundBuffer(const std::string& filepath, sf::SoundBuffer& soundBuffer) const
+{
+    const AssetData* archivedSound = m_archive.GetAsset(filepath);
+    bool soundLoaded = (nullptr != archivedSound) ?
+        soundBuffer.loadFromMemory(archivedSound->Data, archivedSound->SizeInBytes) :
+        soundBuffer.loadFromFile(filepath);
+    return soundLoaded;
+}
+
+void ResourceManager::DecodePreloadedAsset(PreloadedAsset& asset) const
+{
+    TRACE_SCOPE_WITH_DETAIL("resources", "DecodePreloadedAsset", asset.Filepath.c_str());
+    switch (asset.Kind)
+    {
+    case RESOURCE_KIND_IMAGE:
+        asset.Image = DecodeMaskedImage(asset.Filepath, asset.ContentHash, asset.ImageNewlyDecoded);
+        asset.Loaded = (nullptr != asset.Image);
+        break;
+    case RESOURCE_KIND_FONT:
+        asset.Loaded = LoadFont(asset.Filepath, *asset.Font);
+        break;
+    case RESOURCE_KIND_SOUND_BUFFER:
+        asset.Loaded = LoadSoundBuffer(asset.Filepath, *asset.SoundBuffer);
+        break;
+    default:
+        asset.Loaded = false;
+        break;
+    }
+}
+
+template <typename ResourceType>
+std::shared_ptr<ResourceType> ResourceManager::FindCachedResource(
+    std::unordered_map< std::string, CachedResource<ResourceType> >& cache,
+    const std::string& filepath)
+{
+    // CHECK IF THE RESOURCE HAS BEEN LOADED.
+    auto cachedResource = cache.find(filepath);
+    bool resourceCached = (cache.end() != cachedResource);
+    if (!resourceCached)
+    {
+        return nullptr;
+    }
+
+    // MARK THE RESOURCE AS JUST USED.
+    // This keeps it from being evicted before resources that haven't been used as recently.
+    ++m_useCounter;
+    cachedResource->second.LastUseTime = m_useCounter;
+    return cachedResource->second.Resource;
+}
+
+template <typename ResourceType>
+void ResourceManager::AddCachedResource(
+    std::unordered_map< std::string, CachedResource<ResourceType> >& cache,
+    const std::string& filepath,
+    const std::shared_ptr<ResourceType>& resource,
+    const std::size_t sizeInBytes)
+{
+    // ADD THE RESOURCE TO THE CACHE.
+    ++m_useCounter;
+    CachedResource<ResourceType> cachedResource;
+    cachedResource.Resource = resource;
+    cachedResource.SizeInBytes = sizeInBytes;
+    cachedResource.LastUseTime = m_useCounter;
+    cache[filepath] = cachedResource;
+
+    m_memoryUsageInBytes += sizeInBytes;
+
+    // MAKE ROOM FOR THE RESOURCE IF NEEDED.
+    // The newly added resource can't be evicted since the caller is still holding it.
+    EvictResourcesOverBudget();
+}
+
+template <typename ResourceType>
+bool ResourceManager::FindEvictionCandidate(
+    const std::unordered_map< std::string, CachedResource<ResourceType> >& cache,
+    unsigned long long& candidateLastUseTime,
+    std::string& candidateFilepath)
+{
+    bool betterCandidateFound = false;
+    for (const auto& filepathAndResource : cache)
+    {
+        // Resources still held outside of the cache are in use and must not be evicted.
+        // A resource is unused when the cache holds the only reference to it.
+        const CachedResource<ResourceType>& cachedResource = filepathAndResource.second;
+        bool resourceInUse = (cachedResource.Resource.use_count() > 1);
+        if (resourceInUse)
+        {
+            continue;
+        }
+
+        // Evicting resources of unknown size wouldn't help stay within the budget.
+        bool resourceSizeKnown = (cachedResource.SizeInBytes > 0);
+        if (!resourceSizeKnown)
+        {
+            continue;
+        }
+
+        bool leastRecentlyUsed = (cachedResource.LastUseTime < candidateLastUseTime);
+        if (leastRecentlyUsed)
+        {
+            candidateLastUseTime = cachedResource.LastUseTime;
+            candidateFilepath = filepathAndResource.first;
+            betterCandidateFound = true;
+        }
+    }
+
+    return betterCandidateFound;
+}
+
+template <typename ResourceType>
+void ResourceManager::EvictCachedResource(
+    std::unordered_map< std::string, CachedResource<ResourceType> >& cache,
+    const std::string& filepath)
+{
+    auto cachedResource = cache.find(filepath);
+    bool resourceCached = (cache.end() != cachedResource);
+    if (resourceCached)
+    {
+        m_memoryUsageInBytes -= cachedResource->second.SizeInBytes;
+        cache.erase(cachedResource);
+    }
+}
+
+template <typename ResourceType>
+void ResourceManager::EvictUnusedCachedResources(std::unordered_map< std::string, CachedResource<ResourceType> >& cache)
+{
+    auto cachedResource = cache.begin();
+    while (cache.end() != cachedResource)
+    {
+        // A resource is unused when the cache holds the only reference to it.
+        bool resourceInUse = (cachedResource->second.Resource.use_count() > 1);
+        if (resourceInUse)
+        {
+            ++cachedResource;
+            continue;
+        }
+
+        m_memoryUsageInBytes -= cachedResource->second.SizeInBytes;
+        cachedResource = cache.erase(cachedResource);
+    }
+}
+
+void ResourceManager::EvictResourcesOverBudget()
+{
+    // CHECK IF A BUDGET IS BEING ENFORCED.
+    bool budgetEnforced = (UNLIMITED_MEMORY_BUDGET != m_memoryBudgetInBytes);
+    if (!budgetEnforced)
+    {
+        return;
+    }
+
+    // EVICT RESOURCES UNTIL WITHIN THE BUDGET.
+    bool budgetExceeded = (m_memoryUsageInBytes > m_memoryBudgetInBytes);
+    if (budgetExceeded)
+    {
+        PROFILE_MARKER("EvictResourcesOverBudget");
+    }
+    while (budgetExceeded)
+    {
+        // Stop if only resources that are in use remain.
+        bool resourceEvicted = EvictLeastRecentlyUsedResource();
+        if (!resourceEvicted)
+        {
+            return;
+        }
+
+        budgetExceeded = (m_memoryUsageInBytes > m_memoryBudgetInBytes);
+    }
+}
+
+bool ResourceManager::EvictLeastRecentlyUsedResource()
+{
+    // FIND THE LEAST RECENTLY USED RESOURCE OF ANY KIND.
+    unsigned long long candidateLastUseTime = std::numeric_limits<unsigned long long>::max();
+    std::string candidateFilepath;
+    ResourceKind candidateKind = RESOURCE_KIND_NONE;
+    if (FindEvictionCandidate(m_textures, candidateLastUseTime, candidateFilepath))
+    {
+        candidateKind = RESOURCE_KIND_TEXTURE;
+    }
+    if (FindEvictionCandidate(m_images, candidateLastUseTime, candidateFilepath))
+    {
+        candidateKind = RESOURCE_KIND_IMAGE;
+    }
+    if (FindEvictionCandidate(m_fonts, candidateLastUseTime, candidateFilepath))
+    {
+        candidateKind = RESOURCE_KIND_FONT;
+    }
+    if (FindEvictionCandidate(m_sounds, candidateLastUseTime, candidateFilepath))
+    {
+        candidateKind = RESOURCE_KIND_SOUND_BUFFER;
+    }
+
+    // EVICT THE RESOURCE.
+    switch (candidateKind)
+    {
+    case RESOURCE_KIND_TEXTURE:
+        EvictCachedResource(m_textures, candidateFilepath);
+        return true;
+    case RESOURCE_KIND_IMAGE:
+        EvictCachedResource(m_images, candidateFilepath);
+        return true;
+    case RESOURCE_KIND_FONT:
+        EvictCachedResource(m_fonts, candidateFilepath);
+        return true;
+    case RESOURCE_KIND_SOUND_BUFFER:
+        EvictCachedResource(m_sounds, candidateFilepath);
+        return true;
+    default:
+        // No resource could be evicted.
+        return false;
+    }
 }
\ No newline at end of file
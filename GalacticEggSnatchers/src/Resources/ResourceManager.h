@@ -1,28 +1,115 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
+#include "Resources/AssetArchive.h"
+#include "Resources/DecodedImageCache.h"
 
 /// @brief  Code related to resources (files, etc.) for the game.
 namespace RESOURCES
 {
     ////////////////////////////////////////////////////////
-    /// @brief  Responsible for managing resources.
+    /// @brief  Responsible for managing resources.  A single
+    ///         resource manager is intended to be shared by all
+    ///         game states for the lifetime of the process so that
+    ///         resources are only loaded once, no matter how often
+    ///         states are switched.
+    ///
+    ///         Resources are reference counted through the shared
+    ///         pointers returned to callers.  A resource is only
+    ///         considered in use while a caller holds a pointer to it,
+    ///         so callers that give SFML objects a reference to a
+    ///         resource (such as a font for text) must keep the
+    ///         pointer for as long as those objects exist.
+    ///
+    ///         An optional memory budget may be set.  When loading
+    ///         a resource pushes the estimated memory used by resources
+    ///         over the budget, resources that are no longer in use
+    ///         are evicted, least recently used first.  Resources
+    ///         in use are never evicted, so the budget may be
+    ///         temporarily exceeded.
+    ///
+    ///         An asset archive may be mounted, in which case assets
+    ///         stored in the archive are loaded directly from its
+    ///         memory mapping rather than from individual files.
+    ///
+    ///         A decoded image cache may also be opened, in which
+    ///         case images whose encoded files haven't changed are
+    ///         copied from previously decoded and masked pixels
+    ///         rather than being decoded again.
+    ///
+    ///         Assets may be preloaded in bulk, in which case they
+    ///         are decoded concurrently on several threads.
     ////////////////////////////////////////////////////////
     class ResourceManager
     {
     public:
-        /// @brief  Constructor.
+        /// @brief  The memory budget indicating that resources should never be evicted.
+        static const std::size_t UNLIMITED_MEMORY_BUDGET = 0;
+
+        /// @brief  Gets the number of threads that assets are preloaded with by default.
+        /// @return The number of hardware threads, or 1 if it can't be determined.
+        static unsigned int GetDefaultPreloadThreadCount();
+
+        /// @brief  Constructor.  Creates a resource manager without a memory budget.
         explicit ResourceManager();
 
-        /// @brief  Destructor.
+        /// @brief      Constructor.
+        /// @param[in]  memoryBudgetInBytes - The estimated memory, in bytes, that unused
+        ///             resources may remain cached within.  UNLIMITED_MEMORY_BUDGET
+        ///             to never evict resources.
+        explicit ResourceManager(const std::size_t memoryBudgetInBytes);
+
+        /// @brief  Destructor.  Saves any newly decoded images to the decoded image cache.
         ~ResourceManager();
 
+        /// @brief      Mounts an asset archive so that assets in it are loaded from the archive
+        ///             rather than from individual files.  Assets not in the archive are
+        ///             still loaded from files.
+        /// @param[in]  archiveFilepath - The filepath of the archive to mount.
+        /// @return     True if the archive was mounted; false if it doesn't exist or isn't valid.
+        bool MountArchive(const std::string& archiveFilepath);
+
+        /// @brief      Opens a cache of decoded images that images are loaded from when
+        ///             their encoded files haven't changed.  Images that have to be decoded
+        ///             are added to the cache and saved back to the same file.
+        /// @param[in]  cacheFilepath - The filepath of the cache to open.
+        void OpenDecodedImageCache(const std::string& cacheFilepath);
+
+        /// @brief  Saves any newly decoded images to the decoded image cache file.
+        /// @return True if the cache file is up-to-date; false if it couldn't be written.
+        bool SaveDecodedImageCache();
+
+        /// @brief      Loads the specified images, fonts, and sound buffers so that later requests
+        ///             for them don't have to load them.  The CPU-side decoding of all assets is
+        ///             split across the specified number of threads, including the calling thread.
+        ///             Only adding the decoded assets to this object happens serially, and textures
+        ///             are never created here since the graphics device is only used from the
+        ///             calling thread.  Assets that are already loaded, can't be loaded, or aren't
+        ///             images (.png), fonts (.ttf), or sounds (.wav or .ogg) are skipped.
+        /// @param[in]  filepaths - The filepaths of the assets to load.
+        /// @param[in]  threadCount - The number of threads to decode assets on.  1 to load serially.
+        /// @return     The wall-clock time taken to load the assets.
+        sf::Time PreloadAssets(const std::vector<std::string>& filepaths, const unsigned int threadCount);
+
+        /// @brief      Loads all assets used by the game the way the game does on startup:
+        ///             assets come from the default asset archive if one has been built, images come
+        ///             from the default decoded image cache when their files haven't changed, and
+        ///             everything is preloaded across the default number of threads.
+        /// @param[in]  headlessMode - True to only preload images, since running without a window
+        ///             or audio device means fonts and sounds aren't used, and creating a sound
+        ///             buffer would initialize the audio device.
+        void LoadAllAssets(const bool headlessMode);
+
         /// @brief      Gets the specified texture resource.
-        ///             It will persist in memory as long as this object is alive.
+        ///             It will persist in memory as long as this object is alive
+        ///             unless it is evicted after no longer being in use.
         ///             If a texture at the specified filepath has already been loaded,
         ///             the existing resource may be returned as opposed to loading
         ///             a new instance.
@@ -30,8 +117,22 @@ namespace RESOURCES
         /// @return     The texture resource, if successfully loaded.  Nullptr otherwise.
         std::shared_ptr<sf::Texture> GetTexture(const std::string& filepath);
 
+        /// @brief      Gets the specified image resource, decoded in system memory
+        ///             with the standard transparent color masked out.  Unlike textures,
+        ///             images do not require a graphics device, so they may be used
+        ///             when running without a window.
+        ///             It will persist in memory as long as this object is alive
+        ///             unless it is evicted after no longer being in use.
+        ///             If an image at the specified filepath has already been loaded,
+        ///             the existing resource may be returned as opposed to loading
+        ///             a new instance.
+        /// @param[in]  filepath - The filepath (relative or absolute) path to the image file.
+        /// @return     The image resource, if successfully loaded.  Nullptr otherwise.
+        std::shared_ptr<sf::Image> GetImage(const std::string& filepath);
+
         /// @brief      Gets the specified font resource.
-        ///             It will persist in memory as long as this object is alive.
+        ///             It will persist in memory as long as this object is alive
+        ///             unless it is evicted after no longer being in use.
         ///             If a font at the specified filepath has already been loaded,
         ///             the existing resource may be returned as opposed to loading
         ///             a new instance.
@@ -40,7 +141,8 @@ namespace RESOURCES
         std::shared_ptr<sf::Font> GetFont(const std::string& filepath);
 
         /// @brief      Gets the specified sound buffer resource.
-        ///             It will persist in memory as long as this object is alive.
+        ///             It will persist in memory as long as this object is alive
+        ///             unless it is evicted after no longer being in use.
         ///             If a sound buffer at the specified filepath has already been loaded,
         ///             the existing resource may be returned as opposed to loading
         ///             a new instance.
@@ -48,12 +150,176 @@ namespace RESOURCES
         /// @return     The sound buffer resource, if successfully loaded.  Nullptr otherwise.
         std::shared_ptr<sf::SoundBuffer> GetSoundBuffer(const std::string& filepath);
 
+        /// @brief  Gets the memory budget for cached resources.
+        /// @return The memory budget, in bytes.  UNLIMITED_MEMORY_BUDGET if resources are never evicted.
+        std::size_t GetMemoryBudgetInBytes() const;
+
+        /// @brief      Sets the memory budget for cached resources, evicting unused
+        ///             resources if the new budget is already exceeded.
+        /// @param[in]  memoryBudgetInBytes - The memory budget, in bytes.
+        ///             UNLIMITED_MEMORY_BUDGET to never evict resources.
+        void SetMemoryBudgetInBytes(const std::size_t memoryBudgetInBytes);
+
+        /// @brief  Gets the estimated memory used by all cached resources.
+        ///         Fonts are not included since the memory they use cannot be determined.
+        /// @return The estimated memory used by cached resources, in bytes.
+        std::size_t GetMemoryUsageInBytes() const;
+
+        /// @brief  Gets the number of cached resources, whether or not they are in use.
+        /// @return The number of cached resources.
+        unsigned int GetResourceCount() const;
+
+        /// @brief  Evicts all cached resources that are no longer in use, regardless of the budget.
+        void EvictUnusedResources();
+
     private:
         ResourceManager(const ResourceManager& systemToCopy);   ///< Private to disallow copying.
         ResourceManager& operator= (const ResourceManager& collisionSystem);    ///< Private to disallow assignment.
 
-        std::unordered_map< std::string, std::shared_ptr<sf::Texture> > m_textures; ///< Texture resources managed by this object.
-        std::unordered_map< std::string, std::shared_ptr<sf::Font> > m_fonts;   ///< Font resources managed by this object.
-        std::unordered_map< std::string, std::shared_ptr<sf::SoundBuffer> > m_sounds;   ///< Sound resources managed by this object.
+        ////////////////////////////////////////////////////////
+        /// @brief  A resource held in the cache, along with the
+        ///         information needed to decide when to evict it.
+        ////////////////////////////////////////////////////////
+        template <typename ResourceType>
+        struct CachedResource
+        {
+            std::shared_ptr<ResourceType> Resource; ///< The cached resource.
+            std::size_t SizeInBytes;    ///< The estimated memory used by the resource, in bytes.
+            unsigned long long LastUseTime; ///< The value of the use counter when the resource was last retrieved.
+        };
+
+        ////////////////////////////////////////////////////////
+        /// @brief  The different kinds of cached resources.
+        ////////////////////////////////////////////////////////
+        enum ResourceKind
+        {
+            RESOURCE_KIND_NONE, ///< No resource.
+            RESOURCE_KIND_TEXTURE,  ///< A texture.
+            RESOURCE_KIND_IMAGE,    ///< An image.
+            RESOURCE_KIND_FONT, ///< A font.
+            RESOURCE_KIND_SOUND_BUFFER  ///< A sound buffer.
+        };
+
+        ////////////////////////////////////////////////////////
+        /// @brief  An asset being preloaded, holding everything
+        ///         a thread decodes for it until it is cached.
+        ////////////////////////////////////////////////////////
+        struct PreloadedAsset
+        {
+            std::string Filepath;   ///< The filepath of the asset.
+            ResourceKind Kind;  ///< The kind of resource the asset is loaded as.
+            std::shared_ptr<sf::Image> Image;   ///< The decoded image, if the asset is an image.
+            uint64_t ContentHash;   ///< The hash of the encoded image file, if the asset is an image.
+            bool ImageNewlyDecoded; ///< True if the image wasn't in the decoded image cache.
+            std::shared_ptr<sf::Font> Font; ///< The font, if the asset is a font.
+            std::shared_ptr<sf::SoundBuffer> SoundBuffer;   ///< The sound buffer, if the asset is a sound.
+            bool Loaded;    ///< True if the asset was successfully loaded.
+        };
+
+        /// @brief      Gets the kind of resource an asset is preloaded as, based on its file extension.
+        /// @param[in]  filepath - The filepath of the asset.
+        /// @return     The kind of resource for the asset.  RESOURCE_KIND_NONE if it can't be preloaded.
+        static ResourceKind GetPreloadedResourceKind(const std::string& filepath);
+
+        /// @brief      Loads an image from the archive or file and masks out the standard transparent color.
+        ///             The decoded image cache is used if it has the image decoded from the same
+        ///             file contents; otherwise, the image is decoded and added to the cache.
+        /// @param[in]  filepath - The filepath (relative or absolute) path to the image file.
+        /// @return     The masked image, if successfully loaded.  Nullptr otherwise.
+        std::shared_ptr<sf::Image> LoadMaskedImage(const std::string& filepath);
+
+        /// @brief      Gets a masked image from the decoded image cache or by decoding it from the archive
+        ///             or file.  Nothing in this object is modified, so this may be called concurrently.
+        /// @param[in]  filepath - The filepath (relative or absolute) path to the image file.
+        /// @param[out] contentHash - The hash of the encoded image file.
+        /// @param[out] newlyDecoded - True if the image had to be decoded; false if it was already cached.
+        /// @return     The masked image, if successfully loaded.  Nullptr otherwise.
+        std::shared_ptr<sf::Image> DecodeMaskedImage(const std::string& filepath, uint64_t& contentHash, bool& newlyDecoded) const;
+
+        /// @brief      Loads a font from the archive or file.  May be called concurrently.
+        /// @param[in]  filepath - The filepath (relative or absolute) path to the font file.
+        /// @param[out] font - The font to load.
+        /// @return     True if the font was loaded; false otherwise.
+        bool LoadFont(const std::string& filepath, sf::Font& font) const;
+
+        /// @brief      Loads a sound buffer from the archive or file.  May be called concurrently.
+        /// @param[in]  filepath - The filepath (relative or absolute) path to the sound file.
+        /// @param[out] soundBuffer - The sound buffer to load.
+        /// @return     True if the sound buffer was loaded; false otherwise.
+        bool LoadSoundBuffer(const std::string& filepath, sf::SoundBuffer& soundBuffer) const;
+
+        /// @brief          Decodes a single asset being preloaded.  May be called concurrently for different assets.
+        /// @param[in,out]  asset - The asset to decode.  Updated with the decoded resource.
+        void DecodePreloadedAsset(PreloadedAsset& asset) const;
+
+        /// @brief          Finds a resource that has already been loaded, marking it as just used.
+        /// @param[in,out]  cache - The cache of resources of the desired kind.
+        /// @param[in]      filepath - The filepath of the resource.
+        /// @return         The cached resource, if it has been loaded.  Nullptr otherwise.
+        template <typename ResourceType>
+        std::shared_ptr<ResourceType> FindCachedResource(
+            std::unordered_map< std::string, CachedResource<ResourceType> >& cache,
+            const std::string& filepath);
+
+        /// @brief          Adds a newly loaded resource to the cache, evicting unused
+        ///                 resources if the memory budget is exceeded.
+        /// @param[in,out]  cache - The cache of resources of the resource's kind.
+        /// @param[in]      filepath - The filepath of the resource.
+        /// @param[in]      resource - The loaded resource.
+        /// @param[in]      sizeInBytes - The estimated memory used by the resource, in bytes.
+        template <typename ResourceType>
+        void AddCachedResource(
+            std::unordered_map< std::string, CachedResource<ResourceType> >& cache,
+            const std::string& filepath,
+            const std::shared_ptr<ResourceType>& resource,
+            const std::size_t sizeInBytes);
+
+        /// @brief          Finds the least recently used resource in a cache that is no longer in use,
+        ///                 if it was used less recently than the current eviction candidate.
+        /// @param[in]      cache - The cache of resources to search.
+        /// @param[in,out]  candidateLastUseTime - The last use time of the current eviction candidate.
+        ///                 Updated if a less recently used resource is found.
+        /// @param[in,out]  candidateFilepath - The filepath of the current eviction candidate.
+        ///                 Updated if a less recently used resource is found.
+        /// @return         True if a less recently used resource was found; false otherwise.
+        template <typename ResourceType>
+        static bool FindEvictionCandidate(
+            const std::unordered_map< std::string, CachedResource<ResourceType> >& cache,
+            unsigned long long& candidateLastUseTime,
+            std::string& candidateFilepath);
+
+        /// @brief          Removes a resource from a cache.
+        /// @param[in,out]  cache - The cache of resources to remove from.
+        /// @param[in]      filepath - The filepath of the resource to remove.
+        template <typename ResourceType>
+        void EvictCachedResource(
+            std::unordered_map< std::string, CachedResource<ResourceType> >& cache,
+            const std::string& filepath);
+
+        /// @brief          Removes all resources from a cache that are no longer in use.
+        /// @param[in,out]  cache - The cache of resources to remove from.
+        template <typename ResourceType>
+        void EvictUnusedCachedResources(std::unordered_map< std::string, CachedResource<ResourceType> >& cache);
+
+        /// @brief  Evicts the least recently used resources that are no longer in use
+        ///         until the memory budget is no longer exceeded or no unused resources remain.
+        void EvictResourcesOverBudget();
+
+        /// @brief  Evicts the least recently used resource that is no longer in use
+        ///         and uses a known amount of memory.
+        /// @return True if a resource was evicted; false if no resource could be evicted.
+        bool EvictLeastRecentlyUsedResource();
+
+        /// @brief  The mounted asset archive.  Declared before the resources since fonts
+        ///         loaded from the archive read from its mapping as long as they exist.
+        AssetArchive m_archive;
+        DecodedImageCache m_decodedImageCache;  ///< Previously decoded images, by the filepaths they were loaded from.
+        std::size_t m_memoryBudgetInBytes;  ///< The memory budget for cached resources, in bytes.
+        std::size_t m_memoryUsageInBytes;   ///< The estimated memory used by cached resources, in bytes.
+        unsigned long long m_useCounter;    ///< Incremented each time a resource is retrieved to track how recently resources were used.
+        std::unordered_map< std::string, CachedResource<sf::Texture> > m_textures; ///< Texture resources managed by this object.
+        std::unordered_map< std::string, CachedResource<sf::Image> > m_images; ///< Image resources managed by this object.
+        std::unordered_map< std::string, CachedResource<sf::Font> > m_fonts;   ///< Font resources managed by this object.
+        std::unordered_map< std::string, CachedResource<sf::SoundBuffer> > m_sounds;   ///< Sound resources managed by this object.
     };
 }
\ No newline at end of file
@@ -0,0 +1,309 @@
+#include <algorithm>
+#include <cmath>
+#include "Input/AutomatedController.h"
+#include "Input/ReplayController.h"
+#include "Profiling/Profiling.h"
+#include "Simulation/HeadlessSimulation.h"
+
+using namespace SIMULATION;
+
+// STATIC CONSTANT INITIALIZATION.
+const sf::Time HeadlessSimulation::STEADY_STATE_WARM_UP_TIME = sf::seconds(1.0f);
+
+float HeadlessSimulationResults::GetTicksPerSecond() const
+{
+    // CHECK IF ANY TIME WAS SPENT.
+    // Division by zero must be avoided.
+    float totalTickTimeInSeconds = TotalTickTime.asSeconds();
+    bool timeSpent = (totalTickTimeInSeconds > 0.0f);
+    if (!timeSpent)
+    {
+        return 0.0f;
+    }
+
+    float ticksPerSecond = static_cast<float>(TickCount) / totalTickTimeInSeconds;
+    return ticksPerSecond;
+}
+
+sf::Time HeadlessSimulationResults::GetAverageTickTime() const
+{
+    // CHECK IF ANY TICKS WERE RUN.
+    // Division by zero must be avoided.
+    bool ticksRun = (TickCount > 0);
+    if (!ticksRun)
+    {
+        return sf::Time::Zero;
+    }
+
+    sf::Int64 averageTickTimeInMicroseconds = TotalTickTime.asMicroseconds() / TickCount;
+    return sf::microseconds(averageTickTimeInMicroseconds);
+}
+
+void HeadlessSimulationResults::WriteReport(std::ostream& output) const
+{
+    output << "Headless simulation results" << std::endl;
+    output << "  Ticks: " << TickCount << std::endl;
+    output << "  Gameplay sessions: " << GameplaySessionCount << std::endl;
+    output << "  Random seed: " << RandomSeed << std::endl;
+    output << "  Simulated time (s): " << SimulatedTime.asSeconds() << std::endl;
+    output << "  Real time (s): " << TotalTickTime.asSeconds() << std::endl;
+    output << "  Ticks per second: " << GetTicksPerSecond() << std::endl;
+    output << "  Tick time (us): min " << MinTickTime.asMicroseconds()
+        << ", avg " << GetAverageTickTime().asMicroseconds()
+        << ", max " << MaxTickTime.asMicroseconds() << std::endl;
+
+    // WRITE THE STEADY-STATE ALLOCATIONS.
+    // They're only meaningful if allocations were actually counted.
+    if (AllocationsTracked)
+    {
+        output << "  Steady-state heap allocations: " << SteadyStateAllocationCount
+            << " in " << SteadyStateTicksWithAllocationsCount
+            << " of " << SteadyStateTickCount << " ticks" << std::endl;
+    }
+}
+
+HeadlessSimulation::HeadlessSimulation(
+    const sf::FloatRect& screenBoundsInPixels,
+    const unsigned int ticksPerSecond,
+    const uint64_t randomSeed) :
+    m_screenBoundsInPixels(screenBoundsInPixels),
+    m_timePerTick(sf::seconds(1.0f / static_cast<float>(ticksPerSecond))),
+    m_randomSeed(randomSeed),
+    m_replayedInput(),
+    m_resourceManager(std::make_shared<RESOURCES::ResourceManager>())
+{
+    // LOAD ALL ASSETS UP FRONT.
+    // States then find their assets already loaded instead of decoding them one at a time.
+    // Only images are loaded since the simulation never uses fonts or sounds.
+    const bool HEADLESS_MODE = true;
+    m_resourceManager->LoadAllAssets(HEADLESS_MODE);
+}
+
+HeadlessSimulation::~HeadlessSimulation()
+{
+    // Nothing to do.
+}
+
+void HeadlessSimulation::ReplayInput(const std::shared_ptr<const INPUT::InputRecording>& recording)
+{
+    m_replayedInput = recording;
+    m_randomSeed = recording->GetRandomSeed();
+    m_timePerTick = sf::seconds(1.0f / static_cast<float>(recording->GetTicksPerSecond()));
+}
+
+HeadlessSimulationResults HeadlessSimulation::Run(const unsigned int tickCount)
+{
+    HeadlessSimulationResults results;
+    results.RandomSeed = m_randomSeed;
+#if defined PROFILING_ENABLED
+    results.AllocationsTracked = true;
+#endif
+
+    // START THE FIRST GAMEPLAY SESSION.
+    std::shared_ptr<STATES::GameplayState> gameplayState = CreateGameplayState(results.GameplaySessionCount);
+    ++results.GameplaySessionCount;
+    sf::Time sessionSimulatedTime = sf::Time::Zero;
+
+    // RUN THE SIMULATION FOR THE REQUESTED NUMBER OF TICKS.
+    sf::Clock tickClock;
+    for (unsigned int tickIndex = 0; tickIndex < tickCount; ++tickIndex)
+    {
+        // START A NEW GAMEPLAY SESSION IF THE PREVIOUS ONE ENDED.
+        // Session creation is not included in the tick timing since it
+        // measures resource loading rather than simulation.
+        bool gameplayEnded = gameplayState->GameplayEnded();
+        if (gameplayEnded)
+        {
+            // A replayed recording only covers a single session, so the run ends with it.
+            // Another session would start the recorded input over partway through the run.
+            bool replayingInput = (nullptr != m_replayedInput);
+            if (replayingInput)
+            {
+                break;
+            }
+
+            gameplayState = CreateGameplayState(results.GameplaySessionCount);
+            ++results.GameplaySessionCount;
+            sessionSimulatedTime = sf::Time::Zero;
+        }
+
+        // UPDATE THE SIMULATION FOR A SINGLE TICK.
+        uint64_t allocationCountBeforeTick = PROFILE_ALLOCATION_COUNT();
+        tickClock.restart();
+        gameplayState->Update(m_timePerTick);
+        sf::Time tickTime = tickClock.getElapsedTime();
+        uint64_t tickAllocationCount = PROFILE_ALLOCATION_COUNT() - allocationCountBeforeTick;
+
+        // RECORD THE TIMING OF THE TICK.
+        bool firstTick = (0 == results.TickCount);
+        results.MinTickTime = firstTick ? tickTime : std::min(results.MinTickTime, tickTime);
+        results.MaxTickTime = std::max(results.MaxTickTime, tickTime);
+        results.TotalTickTime += tickTime;
+        results.SimulatedTime += m_timePerTick;
+        ++results.TickCount;
+
+        // RECORD THE ALLOCATIONS OF STEADY-STATE TICKS.
+        sessionSimulatedTime += m_timePerTick;
+        bool sessionWarmedUp = (sessionSimulatedTime > STEADY_STATE_WARM_UP_TIME);
+        if (sessionWarmedUp)
+        {
+            ++results.SteadyStateTickCount;
+            results.SteadyStateAllocationCount += tickAllocationCount;
+
+            bool tickAllocated = (tickAllocationCount > 0);
+            if (tickAllocated)
+            {
+                ++results.SteadyStateTicksWithAllocationsCount;
+            }
+        }
+
+        // Each tick is treated as a frame for profiling.
+        PROFILE_END_FRAME();
+    }
+
+    return results;
+}
+
+StressTestResults HeadlessSimulation::RunStressTest(const StressTestParameters& parameters)
+{
+    StressTestResults results;
+    results.RandomSeed = m_randomSeed;
+
+    // RUN EACH STAGE WITH AN INCREASING WORKLOAD.
+    unsigned int alienRowCount = parameters.InitialAlienRowCount;
+    unsigned int alienColumnCount = parameters.InitialAlienColumnCount;
+    float timeBetweenMissileFiresInSeconds = parameters.TimeBetweenMissileFiresInSeconds;
+    unsigned int gameplaySessionCount = 0;
+    sf::Clock tickClock;
+    for (unsigned int stageIndex = 0; stageIndex < parameters.StageCount; ++stageIndex)
+    {
+        // CONFIGURE THE GAMEPLAY FOR THE STAGE.
+        STATES::GameplaySettings settings;
+        settings.HeadlessMode = true;
+        settings.AlienRowCount = alienRowCount;
+        settings.AlienColumnCount = alienColumnCount;
+        settings.InitialAlienParameters.MinTimeBetweenMissileFiresInSeconds = timeBetweenMissileFiresInSeconds;
+        settings.InitialAlienParameters.MaxTimeBetweenMissileFiresInSeconds = timeBetweenMissileFiresInSeconds;
+        settings.ExplosionsPerMissileHit = parameters.ExplosionsPerMissileHit * (stageIndex + 1);
+
+        // Each alien may have a couple of seconds' worth of missiles in flight at once, since a
+        // missile takes a few seconds to cross the screen.  This leaves room for all aliens to keep firing.
+        const float MISSILE_FLIGHT_TIME_IN_SECONDS = 2.0f;
+        unsigned int maxMissilesInFlightPerAlien = static_cast<unsigned int>(
+            std::ceil(MISSILE_FLIGHT_TIME_IN_SECONDS / timeBetweenMissileFiresInSeconds));
+        unsigned int alienCountPerFormation = alienRowCount * alienColumnCount;
+        unsigned int missileCapacityForAllAliens = alienCountPerFormation * maxMissilesInFlightPerAlien;
+        settings.MissileCapacity = std::max(settings.MissileCapacity, missileCapacityForAllAliens);
+
+        // RUN THE STAGE.
+        StressTestStageResults stageResults;
+        stageResults.AlienCountPerFormation = alienCountPerFormation;
+        stageResults.TimeBetweenMissileFiresInSeconds = timeBetweenMissileFiresInSeconds;
+        stageResults.ExplosionsPerMissileHit = settings.ExplosionsPerMissileHit;
+        uint64_t totalGameObjectCount = 0;
+        std::shared_ptr<STATES::GameplayState> gameplayState;
+        while (stageResults.TickCount < parameters.TicksPerStage)
+        {
+            // START A NEW GAMEPLAY SESSION IF NEEDED.
+            // A heavy workload quickly overwhelms the automated player, so sessions are restarted
+            // with the same settings to measure the stage for all of its ticks.  Session creation
+            // is not included in the tick timing since it measures resource loading rather than simulation.
+            bool gameplaySessionNeeded = (!gameplayState || gameplayState->GameplayEnded());
+            if (gameplaySessionNeeded)
+            {
+                settings.RandomSeed = m_randomSeed + gameplaySessionCount;
+                ++gameplaySessionCount;
+                gameplayState = std::make_shared<STATES::GameplayState>(
+                    m_screenBoundsInPixels,
+                    settings,
+                    std::make_shared<INPUT::AutomatedController>(),
+                    m_resourceManager);
+            }
+
+            // UPDATE THE SIMULATION FOR A SINGLE TICK.
+            tickClock.restart();
+            gameplayState->Update(m_timePerTick);
+            sf::Time tickTime = tickClock.getElapsedTime();
+
+            // RECORD THE TIMING AND WORKLOAD OF THE TICK.
+            unsigned int gameObjectCount = gameplayState->GetGameObjectCount();
+            totalGameObjectCount += gameObjectCount;
+            stageResults.PeakGameObjectCount = std::max(stageResults.PeakGameObjectCount, gameObjectCount);
+            stageResults.MaxTickTime = std::max(stageResults.MaxTickTime, tickTime);
+            stageResults.TotalTickTime += tickTime;
+            ++stageResults.TickCount;
+
+            // Each tick is treated as a frame for profiling.
+            PROFILE_END_FRAME();
+        }
+
+        bool ticksRun = (stageResults.TickCount > 0);
+        if (ticksRun)
+        {
+            stageResults.AverageGameObjectCount = static_cast<unsigned int>(totalGameObjectCount / stageResults.TickCount);
+        }
+
+        results.Stages.push_back(stageResults);
+
+        // STOP ONCE THE FRAME TIME BUDGET IS EXCEEDED.
+        // Larger stages would only take longer without adding to the scaling curve of interest.
+        bool stageOverBudget = (stageResults.GetAverageTickTime() > StressTestResults::FRAME_TIME_BUDGET);
+        if (stageOverBudget)
+        {
+            break;
+        }
+
+        // DOUBLE THE NUMBER OF ALIENS FOR THE NEXT STAGE.
+        // Rows and columns are alternately doubled to keep formations roughly proportioned.
+        bool doubleRows = (0 == stageIndex % 2);
+        if (doubleRows)
+        {
+            alienRowCount *= 2;
+        }
+        else
+        {
+            alienColumnCount *= 2;
+        }
+
+        // HALVE THE TIME BETWEEN MISSILE FIRES FOR THE NEXT STAGE.
+        // The time never decreases below the minimum, though a shorter time provided
+        // for the first stage is kept as is.
+        float minTimeBetweenMissileFiresInSeconds = std::min(
+            timeBetweenMissileFiresInSeconds,
+            StressTestParameters::MIN_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS);
+        timeBetweenMissileFiresInSeconds = std::max(timeBetweenMissileFiresInSeconds / 2.0f, minTimeBetweenMissileFiresInSeconds);
+    }
+
+    return results;
+}
+
+std::shared_ptr<STATES::GameplayState> HeadlessSimulation::CreateGameplayState(const unsigned int sessionIndex) const
+{
+    PROFILE_MARKER("CreateGameplayState");
+
+    STATES::GameplaySettings settings;
+    settings.HeadlessMode = true;
+
+    // CHECK IF RECORDED INPUT IS BEING REPLAYED.
+    std::shared_ptr<INPUT::IInputController> playerController;
+    bool replayingInput = (nullptr != m_replayedInput);
+    if (replayingInput)
+    {
+        // The recorded session can only be reproduced with the same seed it was recorded with.
+        settings.RandomSeed = m_randomSeed;
+        playerController = std::make_shared<INPUT::ReplayController>(m_replayedInput);
+    }
+    else
+    {
+        // Each session plays out differently, while the run as a whole stays reproducible.
+        settings.RandomSeed = m_randomSeed + sessionIndex;
+        playerController = std::make_shared<INPUT::AutomatedController>();
+    }
+
+    std::shared_ptr<STATES::GameplayState> gameplayState = std::make_shared<STATES::GameplayState>(
+        m_screenBoundsInPixels,
+        settings,
+        playerController,
+        m_resourceManager);
+    return gameplayState;
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <SFML/System.hpp>
+#include "Input/InputRecording.h"
+#include "Resources/ResourceManager.h"
+#include "Simulation/StressTest.h"
+#include "States/GameplayState.h"
+
+/// @brief  Code related to driving the game simulation outside of the normal game loop.
+namespace SIMULATION
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  The results of a headless simulation run.
+    ////////////////////////////////////////////////////////
+    struct HeadlessSimulationResults
+    {
+        unsigned int TickCount; ///< The number of simulation ticks that were run.
+        unsigned int GameplaySessionCount;  ///< The number of gameplay sessions started during the run.
+        uint64_t RandomSeed;    ///< The seed for all randomness in the run.
+        sf::Time SimulatedTime; ///< The total amount of synthetic time simulated.
+        sf::Time TotalTickTime; ///< The total real time spent updating the simulation.
+        sf::Time MinTickTime;   ///< The shortest real time spent on a single tick.
+        sf::Time MaxTickTime;   ///< The longest real time spent on a single tick.
+        bool AllocationsTracked;    ///< True if heap allocations were counted, which requires profiling to be enabled.
+        unsigned int SteadyStateTickCount;  ///< The number of ticks run after each gameplay session warmed up.
+        unsigned int SteadyStateTicksWithAllocationsCount;  ///< The number of steady-state ticks that allocated at all.
+        uint64_t SteadyStateAllocationCount;    ///< The number of heap allocations made during steady-state ticks.
+
+        /// @brief  Constructor.  Initializes results for an empty run.
+        HeadlessSimulationResults() :
+            TickCount(0),
+            GameplaySessionCount(0),
+            RandomSeed(0),
+            SimulatedTime(),
+            TotalTickTime(),
+            MinTickTime(),
+            MaxTickTime(),
+            AllocationsTracked(false),
+            SteadyStateTickCount(0),
+            SteadyStateTicksWithAllocationsCount(0),
+            SteadyStateAllocationCount(0)
+        {}
+
+        /// @brief  Gets the number of ticks run per second of real time.
+        /// @return The simulation throughput in ticks per second.
+        float GetTicksPerSecond() const;
+
+        /// @brief  Gets the average real time spent on a single tick.
+        /// @return The average time per tick.
+        sf::Time GetAverageTickTime() const;
+
+        /// @brief          Writes a human-readable report of the results.
+        /// @param[in,out]  output - The stream to write the report to.
+        void WriteReport(std::ostream& output) const;
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  Drives the gameplay state without a window, audio device,
+    ///         or keyboard.  Input is supplied by an automated controller
+    ///         and each tick advances a fixed amount of synthetic time,
+    ///         allowing the simulation cost to be measured in isolation
+    ///         from rendering and vertical sync.
+    ////////////////////////////////////////////////////////
+    class HeadlessSimulation
+    {
+    public:
+        /// @brief  The simulated time after a gameplay session starts before its ticks are
+        ///         considered steady-state.  This gives one-time setup, such as filling
+        ///         pools and caches, time to finish so that steady-state allocations
+        ///         reflect ongoing gameplay.
+        static const sf::Time STEADY_STATE_WARM_UP_TIME;
+
+        /// @brief      Constructor.
+        /// @param[in]  screenBoundsInPixels - The boundaries of the screen for which to confine game objects.
+        /// @param[in]  ticksPerSecond - The number of ticks per second of synthetic time.
+        /// @param[in]  randomSeed - The seed for all randomness in the simulation.  Each gameplay
+        ///             session is seeded differently, but deterministically, from this seed.
+        explicit HeadlessSimulation(
+            const sf::FloatRect& screenBoundsInPixels,
+            const unsigned int ticksPerSecond,
+            const uint64_t randomSeed);
+
+        /// @brief  Destructor.
+        ~HeadlessSimulation();
+
+        /// @brief      Replays recorded input instead of using automated input.  The recording's
+        ///             random seed and tick rate replace those the simulation was created with,
+        ///             so the simulated workload is identical on every run.  Since a recording
+        ///             covers a single gameplay session, a run ends early if the session does.
+        /// @param[in]  recording - The recorded input to replay.
+        void ReplayInput(const std::shared_ptr<const INPUT::InputRecording>& recording);
+
+        /// @brief      Runs the simulation for the specified number of ticks.
+        ///             A new gameplay session is started whenever the previous one ends,
+        ///             unless recorded input is being replayed.
+        ///             Heap allocations during steady-state ticks are counted if profiling is enabled.
+        /// @param[in]  tickCount - The number of ticks to run.
+        /// @return     The results of the run.
+        HeadlessSimulationResults Run(const unsigned int tickCount);
+
+        /// @brief      Runs a stress test that ramps up the number of game objects in stages
+        ///             until the average tick time exceeds the frame time budget, measuring
+        ///             how the simulation cost scales.  Each stage starts a new gameplay session
+        ///             with automated input, restarting it whenever its gameplay ends.
+        /// @param[in]  parameters - Parameters controlling how the workload is ramped up.
+        /// @return     The results of each stage that was run.
+        StressTestResults RunStressTest(const StressTestParameters& parameters);
+
+    private:
+        HeadlessSimulation(const HeadlessSimulation& simulationToCopy);  ///< Private to disallow copying.
+        HeadlessSimulation& operator= (const HeadlessSimulation& rhsSimulation); ///< Private to disallow assignment.
+
+        /// @brief      Helper method to create a new headless gameplay session.
+        /// @param[in]  sessionIndex - The index of the session within the run, starting at 0.
+        /// @return     The new gameplay state.
+        std::shared_ptr<STATES::GameplayState> CreateGameplayState(const unsigned int sessionIndex) const;
+
+        sf::FloatRect m_screenBoundsInPixels;   ///< The boundaries of the screen for which to confine game objects.
+        sf::Time m_timePerTick; ///< The synthetic time advanced by each tick.
+        uint64_t m_randomSeed;  ///< The seed for all randomness in the simulation.
+        std::shared_ptr<const INPUT::InputRecording> m_replayedInput;   ///< The recorded input to replay.  Null for automated input.
+        std::shared_ptr<RESOURCES::ResourceManager> m_resourceManager;  ///< The resources shared by all gameplay sessions so that restarts don't reload them.
+    };
+}
@@ -0,0 +1,57 @@
+#include <chrono>
+#include "Simulation/RandomNumberGenerator.h"
+
+using namespace SIMULATION;
+
+/// @brief  The multiplier for advancing the state of the generator.
+static const uint64_t STATE_MULTIPLIER = 6364136223846793005ULL;
+/// @brief  The increment for advancing the state of the generator.  It must be odd.
+static const uint64_t STATE_INCREMENT = 1442695040888963407ULL;
+
+// STATIC METHODS.
+
+uint64_t RandomNumberGenerator::CreateTimeBasedSeed()
+{
+    uint64_t seed = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+    return seed;
+}
+
+// INSTANCE METHODS.
+
+RandomNumberGenerator::RandomNumberGenerator(const uint64_t seed) :
+    m_state(0)
+{
+    // MIX THE SEED INTO THE STATE.
+    // The state is advanced before and after adding the seed so that
+    // similar seeds still produce unrelated sequences.
+    GenerateNumber();
+    m_state += seed;
+    GenerateNumber();
+}
+
+RandomNumberGenerator::~RandomNumberGenerator()
+{
+    // Nothing else to do.
+}
+
+uint32_t RandomNumberGenerator::GenerateNumber()
+{
+    // ADVANCE THE STATE.
+    uint64_t previousState = m_state;
+    m_state = (previousState * STATE_MULTIPLIER) + STATE_INCREMENT;
+
+    // PERMUTE THE PREVIOUS STATE INTO THE OUTPUT NUMBER.
+    // The high bits of the state are the most random, so they are folded together
+    // and then rotated by an amount taken from the highest bits.
+    uint32_t xorShiftedState = static_cast<uint32_t>(((previousState >> 18) ^ previousState) >> 27);
+    uint32_t rotation = static_cast<uint32_t>(previousState >> 59);
+    uint32_t randomNumber = (xorShiftedState >> rotation) | (xorShiftedState << ((32 - rotation) & 31));
+    return randomNumber;
+}
+
+unsigned int RandomNumberGenerator::GenerateNumberLessThan(const unsigned int upperBound)
+{
+    uint64_t scaledNumber = static_cast<uint64_t>(GenerateNumber()) * upperBound;
+    unsigned int randomNumber = static_cast<unsigned int>(scaledNumber >> 32);
+    return randomNumber;
+}
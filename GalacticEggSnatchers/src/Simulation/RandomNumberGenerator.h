@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+
+namespace SIMULATION
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  A fast, seedable source of random numbers.
+    ///
+    ///         Numbers are generated with the PCG32 algorithm, which
+    ///         only needs a few arithmetic operations and 16 bytes of
+    ///         state per generator.  Unlike standard library engines
+    ///         and distributions, the sequence generated for a seed is
+    ///         fully defined here, so the same seed produces exactly
+    ///         the same numbers on every platform and compiler.
+    ///
+    ///         Generators are owned by whatever they produce randomness
+    ///         for rather than shared globally, so that separate
+    ///         simulations never affect each other's sequences.
+    ////////////////////////////////////////////////////////
+    class RandomNumberGenerator
+    {
+    public:
+        /// @brief  Creates a seed based on the current time, for when
+        ///         randomness doesn't need to be reproducible.
+        /// @return A seed that differs each time it is created.
+        static uint64_t CreateTimeBasedSeed();
+
+        /// @brief      Constructor.
+        /// @param[in]  seed - The seed determining the sequence of generated numbers.
+        explicit RandomNumberGenerator(const uint64_t seed);
+
+        /// @brief  Destructor.
+        ~RandomNumberGenerator();
+
+        /// @brief  Generates the next random number in the sequence.
+        /// @return A random number, uniformly distributed across all 32-bit values.
+        uint32_t GenerateNumber();
+
+        /// @brief      Generates a random number within a range starting at 0.
+        ///             The number is scaled from a full 32-bit number rather than taken
+        ///             as a remainder, which avoids a division.  The slight bias toward
+        ///             some numbers is negligible for the small ranges used in the game.
+        /// @param[in]  upperBound - The exclusive upper bound of the range.  Must be positive.
+        /// @return     A random number from 0 up to (but not including) the upper bound.
+        unsigned int GenerateNumberLessThan(const unsigned int upperBound);
+
+    private:
+        RandomNumberGenerator(const RandomNumberGenerator& generatorToCopy);  ///< Private to disallow copying.
+        RandomNumberGenerator& operator= (const RandomNumberGenerator& rhsGenerator); ///< Private to disallow assignment.
+
+        uint64_t m_state;   ///< The current state, advanced each time a number is generated.
+    };
+}
@@ -0,0 +1,24 @@
+#include "Simulation/SimulationClock.h"
+
+using namespace SIMULATION;
+
+SimulationClock::SimulationClock() :
+    m_elapsedTime(sf::Time::Zero)
+{
+    // Nothing else to do.
+}
+
+SimulationClock::~SimulationClock()
+{
+    // Nothing else to do.
+}
+
+void SimulationClock::Update(const sf::Time& elapsedTime)
+{
+    m_elapsedTime += elapsedTime;
+}
+
+sf::Time SimulationClock::GetElapsedTime() const
+{
+    return m_elapsedTime;
+}
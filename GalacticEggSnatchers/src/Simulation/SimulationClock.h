@@ -0,0 +1,39 @@
+#pragma once
+
+#include <SFML/System.hpp>
+
+namespace SIMULATION
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Tracks how much time has passed within the simulation.
+    ///
+    ///         Unlike a wall clock, simulation time only advances
+    ///         when the simulation is updated, so anything timed
+    ///         against it behaves the same regardless of how fast
+    ///         updates actually run (such as in headless mode) or
+    ///         whether updates are paused.
+    ////////////////////////////////////////////////////////
+    class SimulationClock
+    {
+    public:
+        /// @brief  Constructor.  Starts the clock at zero.
+        explicit SimulationClock();
+
+        /// @brief  Destructor.
+        ~SimulationClock();
+
+        /// @brief      Advances the clock for a single simulation update.
+        /// @param[in]  elapsedTime - The elapsed simulation time since the last update.
+        void Update(const sf::Time& elapsedTime);
+
+        /// @brief  Gets the total simulation time that has passed.
+        /// @return The simulation time since the clock was created.
+        sf::Time GetElapsedTime() const;
+
+    private:
+        SimulationClock(const SimulationClock& clockToCopy);  ///< Private to disallow copying.
+        SimulationClock& operator= (const SimulationClock& rhsClock); ///< Private to disallow assignment.
+
+        sf::Time m_elapsedTime; ///< The total simulation time that has passed.
+    };
+}
@@ -0,0 +1,68 @@
+#include "Simulation/StressTest.h"
+
+using namespace SIMULATION;
+
+// STATIC CONSTANT INITIALIZATION.
+const float StressTestParameters::DEFAULT_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS = 1.0f;
+const float StressTestParameters::MIN_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS = 0.25f;
+const sf::Time StressTestResults::FRAME_TIME_BUDGET = sf::microseconds(1000000 / 60);
+
+sf::Time StressTestStageResults::GetAverageTickTime() const
+{
+    // CHECK IF ANY TICKS WERE RUN.
+    // Division by zero must be avoided.
+    bool ticksRun = (TickCount > 0);
+    if (!ticksRun)
+    {
+        return sf::Time::Zero;
+    }
+
+    sf::Int64 averageTickTimeInMicroseconds = TotalTickTime.asMicroseconds() / TickCount;
+    return sf::microseconds(averageTickTimeInMicroseconds);
+}
+
+const StressTestStageResults* StressTestResults::GetFirstStageOverBudget() const
+{
+    for (std::size_t stageIndex = 0; stageIndex < Stages.size(); ++stageIndex)
+    {
+        bool stageOverBudget = (Stages[stageIndex].GetAverageTickTime() > FRAME_TIME_BUDGET);
+        if (stageOverBudget)
+        {
+            return &Stages[stageIndex];
+        }
+    }
+
+    return nullptr;
+}
+
+void StressTestResults::WriteReport(std::ostream& output) const
+{
+    output << "Stress test results" << std::endl;
+    output << "  Random seed: " << RandomSeed << std::endl;
+    output << "  Frame time budget (us): " << FRAME_TIME_BUDGET.asMicroseconds() << std::endl;
+
+    // WRITE THE SCALING CURVE.
+    for (std::size_t stageIndex = 0; stageIndex < Stages.size(); ++stageIndex)
+    {
+        const StressTestStageResults& stage = Stages[stageIndex];
+        output << "  Stage " << (stageIndex + 1) << ": "
+            << stage.AlienCountPerFormation << " aliens per formation, "
+            << "missiles every " << stage.TimeBetweenMissileFiresInSeconds << " s, "
+            << stage.ExplosionsPerMissileHit << " explosions per hit, "
+            << stage.TickCount << " ticks, "
+            << "game objects avg " << stage.AverageGameObjectCount << " / peak " << stage.PeakGameObjectCount << ", "
+            << "tick time (us) avg " << stage.GetAverageTickTime().asMicroseconds()
+            << " / max " << stage.MaxTickTime.asMicroseconds() << std::endl;
+    }
+
+    // WRITE WHERE THE FRAME TIME BUDGET WAS EXCEEDED.
+    const StressTestStageResults* firstStageOverBudget = GetFirstStageOverBudget();
+    if (firstStageOverBudget)
+    {
+        output << "  Frame time budget exceeded at " << firstStageOverBudget->AverageGameObjectCount << " game objects" << std::endl;
+    }
+    else
+    {
+        output << "  Frame time budget not exceeded" << std::endl;
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include <SFML/System.hpp>
+
+namespace SIMULATION
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Parameters controlling how a stress test ramps
+    ///         up the gameplay workload.  Each stage of the test
+    ///         runs gameplay sessions with twice as many
+    ///         aliens as the previous stage (alternately doubling
+    ///         the rows and columns of each formation), half
+    ///         the time between each alien's missile fires (down
+    ///         to a minimum), enough missile capacity for all of
+    ///         them to fire, and more explosions for each missile hit.
+    ////////////////////////////////////////////////////////
+    struct StressTestParameters
+    {
+        /// @brief  The default maximum number of stages to run.
+        static const unsigned int DEFAULT_STAGE_COUNT = 12;
+        /// @brief  The default number of ticks simulated in each stage.
+        static const unsigned int DEFAULT_TICKS_PER_STAGE = 300;
+        /// @brief  The default number of rows in each alien formation during the first stage.
+        ///         This matches the formations of normal gameplay.
+        static const unsigned int DEFAULT_INITIAL_ALIEN_ROW_COUNT = 5;
+        /// @brief  The default number of columns in each alien formation during the first stage.
+        ///         This matches the formations of normal gameplay.
+        static const unsigned int DEFAULT_INITIAL_ALIEN_COLUMN_COUNT = 6;
+        /// @brief  The default time between each alien's missile fires during the first stage.
+        ///         This is the shortest time supported by normal gameplay.
+        static const float DEFAULT_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS;
+        /// @brief  The shortest time between each alien's missile fires that later stages decrease to.
+        static const float MIN_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS;
+        /// @brief  The default number of explosions per missile hit added in each stage.
+        static const unsigned int DEFAULT_EXPLOSIONS_PER_MISSILE_HIT = 4;
+
+        unsigned int StageCount;    ///< The maximum number of stages to run.  The test stops early once the frame time budget is exceeded.
+        unsigned int TicksPerStage; ///< The number of ticks simulated in each stage.
+        unsigned int InitialAlienRowCount;  ///< The number of rows in each alien formation during the first stage.
+        unsigned int InitialAlienColumnCount;   ///< The number of columns in each alien formation during the first stage.
+        float TimeBetweenMissileFiresInSeconds;  ///< The time between each alien's missile fires during the first stage, which is halved in each later stage.
+        unsigned int ExplosionsPerMissileHit;   ///< The number of explosions per missile hit in the first stage, which is added again in each later stage.
+
+        /// @brief  Constructor.  Initializes parameters for the default stress test.
+        StressTestParameters() :
+            StageCount(DEFAULT_STAGE_COUNT),
+            TicksPerStage(DEFAULT_TICKS_PER_STAGE),
+            InitialAlienRowCount(DEFAULT_INITIAL_ALIEN_ROW_COUNT),
+            InitialAlienColumnCount(DEFAULT_INITIAL_ALIEN_COLUMN_COUNT),
+            TimeBetweenMissileFiresInSeconds(DEFAULT_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS),
+            ExplosionsPerMissileHit(DEFAULT_EXPLOSIONS_PER_MISSILE_HIT)
+        {}
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  The results of a single stage of a stress test.
+    ////////////////////////////////////////////////////////
+    struct StressTestStageResults
+    {
+        unsigned int AlienCountPerFormation;    ///< The number of aliens in each formation.
+        float TimeBetweenMissileFiresInSeconds; ///< The time between each alien's missile fires.
+        unsigned int ExplosionsPerMissileHit;   ///< The number of explosions created for each missile hit.
+        unsigned int TickCount; ///< The number of ticks simulated.
+        unsigned int AverageGameObjectCount;    ///< The average number of game objects in play after each tick.
+        unsigned int PeakGameObjectCount;   ///< The most game objects in play after any tick.
+        sf::Time TotalTickTime; ///< The total real time spent updating the simulation.
+        sf::Time MaxTickTime;   ///< The longest real time spent on a single tick.
+
+        /// @brief  Constructor.  Initializes results for an empty stage.
+        StressTestStageResults() :
+            AlienCountPerFormation(0),
+            TimeBetweenMissileFiresInSeconds(0.0f),
+            ExplosionsPerMissileHit(0),
+            TickCount(0),
+            AverageGameObjectCount(0),
+            PeakGameObjectCount(0),
+            TotalTickTime(),
+            MaxTickTime()
+        {}
+
+        /// @brief  Gets the average real time spent on a single tick.
+        /// @return The average time per tick.
+        sf::Time GetAverageTickTime() const;
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  The results of a stress test, describing how
+    ///         the cost of a simulation tick scales with the
+    ///         number of game objects in play.
+    ////////////////////////////////////////////////////////
+    struct StressTestResults
+    {
+        /// @brief  The time available for each frame at 60 frames per second.
+        ///         A stage exceeds the budget when its average tick time is longer.
+        static const sf::Time FRAME_TIME_BUDGET;
+
+        uint64_t RandomSeed;    ///< The seed for all randomness in the test.
+        std::vector<StressTestStageResults> Stages;   ///< The results of each stage that was run, in order.
+
+        /// @brief  Constructor.  Initializes results for a test without any stages.
+        StressTestResults() :
+            RandomSeed(0),
+            Stages()
+        {}
+
+        /// @brief  Gets the first stage whose average tick time exceeded the frame time budget.
+        /// @return The first stage over budget; null if all stages were within budget.
+        const StressTestStageResults* GetFirstStageOverBudget() const;
+
+        /// @brief          Writes a human-readable report of the results.
+        /// @param[in,out]  output - The stream to write the report to.
+        void WriteReport(std::ostream& output) const;
+    };
+}
@@ -0,0 +1,257 @@
+#include <algorithm>
+#include "Profiling/Profiling.h"
+#include "Simulation/TimerWheel.h"
+
+using namespace SIMULATION;
+
+// STATIC CONSTANT INITIALIZATION.
+const sf::Time TimerWheel::DEFAULT_RESOLUTION = sf::milliseconds(1);
+
+// INSTANCE METHODS.
+
+TimerWheel::TimerWheel(const sf::Time& resolution, const unsigned int capacity) :
+    m_resolution(resolution),
+    m_currentTime(sf::Time::Zero),
+    m_nextTick(1),
+    m_pendingCount(0),
+    m_timers(),
+    m_freeTimerIndices(),
+    m_firstTimerIndices()
+{
+    // ALLOCATE STORAGE FOR ALL TIMERS UP FRONT.
+    m_timers.reserve(capacity);
+    m_freeTimerIndices.reserve(capacity);
+
+    // START WITH ALL SLOTS EMPTY.
+    m_firstTimerIndices.fill(NO_TIMER_INDEX);
+}
+
+TimerWheel::~TimerWheel()
+{
+    // Nothing else to do.
+}
+
+CONTAINERS::GenerationalHandle TimerWheel::Schedule(const sf::Time& delay, const TimerEvent& event)
+{
+    PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_TIMERS);
+
+    // CALCULATE THE TICK ON WHICH THE TIMER IS DUE.
+    // The due time is rounded up to a whole tick so that the timer never expires early.
+    sf::Time dueTime = m_currentTime + std::max(delay, sf::Time::Zero);
+    uint64_t dueTimeInMicroseconds = static_cast<uint64_t>(dueTime.asMicroseconds());
+    uint64_t resolutionInMicroseconds = static_cast<uint64_t>(m_resolution.asMicroseconds());
+    uint64_t dueTick = (dueTimeInMicroseconds + resolutionInMicroseconds - 1) / resolutionInMicroseconds;
+
+    // The highest level of the wheel can only reach a limited number of ticks ahead.
+    const uint64_t MAX_TICKS_UNTIL_DUE = (static_cast<uint64_t>(1) << (SLOT_INDEX_BIT_COUNT * LEVEL_COUNT)) - 1;
+    uint64_t maxDueTick = m_nextTick + MAX_TICKS_UNTIL_DUE;
+    dueTick = std::min(dueTick, maxDueTick);
+
+    // GET STORAGE FOR THE TIMER.
+    // Storage of previously expired timers is reused so that scheduling normally doesn't allocate.
+    unsigned int timerIndex = NO_TIMER_INDEX;
+    bool freeTimerExists = !m_freeTimerIndices.empty();
+    if (freeTimerExists)
+    {
+        timerIndex = m_freeTimerIndices.back();
+        m_freeTimerIndices.pop_back();
+    }
+    else
+    {
+        timerIndex = static_cast<unsigned int>(m_timers.size());
+        Timer newTimer;
+        newTimer.Generation = 0;
+        m_timers.push_back(newTimer);
+    }
+
+    // ADD THE TIMER TO THE WHEEL.
+    Timer& timer = m_timers[timerIndex];
+    timer.DueTick = dueTick;
+    timer.Event = event;
+    timer.Pending = true;
+    Link(timerIndex);
+    ++m_pendingCount;
+
+    return CONTAINERS::GenerationalHandle(timerIndex, timer.Generation);
+}
+
+void TimerWheel::Cancel(const CONTAINERS::GenerationalHandle& timer)
+{
+    // CHECK IF THE TIMER IS STILL PENDING.
+    bool timerPending = IsPending(timer);
+    if (!timerPending)
+    {
+        return;
+    }
+
+    // REMOVE THE TIMER.
+    Unlink(timer.SlotIndex);
+    Free(timer.SlotIndex);
+}
+
+bool TimerWheel::IsPending(const CONTAINERS::GenerationalHandle& timer) const
+{
+    // CHECK IF THE HANDLE REFERS TO ANY STORED TIMER.
+    bool timerIndexValid = (timer.SlotIndex < m_timers.size());
+    if (!timerIndexValid)
+    {
+        return false;
+    }
+
+    // CHECK IF THE HANDLE STILL REFERS TO THE PENDING TIMER IT WAS CREATED FOR.
+    const Timer& storedTimer = m_timers[timer.SlotIndex];
+    bool sameGeneration = (storedTimer.Generation == timer.Generation);
+    bool timerPending = (sameGeneration && storedTimer.Pending);
+    return timerPending;
+}
+
+unsigned int TimerWheel::GetPendingCount() const
+{
+    return m_pendingCount;
+}
+
+void TimerWheel::AdvanceTo(const sf::Time& currentTime, std::vector<TimerEvent>& expiredEvents)
+{
+    // DETERMINE THE LAST TICK THAT HAS BEEN REACHED.
+    m_currentTime = currentTime;
+    uint64_t currentTimeInMicroseconds = static_cast<uint64_t>(currentTime.asMicroseconds());
+    uint64_t resolutionInMicroseconds = static_cast<uint64_t>(m_resolution.asMicroseconds());
+    uint64_t lastReachedTick = currentTimeInMicroseconds / resolutionInMicroseconds;
+
+    // PROCESS EACH TICK THAT HAS BEEN REACHED.
+    const unsigned int SLOT_INDEX_MASK = (SLOT_COUNT_PER_LEVEL - 1);
+    while (m_nextTick <= lastReachedTick)
+    {
+        // SKIP THE REMAINING TICKS IF NO TIMERS ARE PENDING.
+        // No slots can contain timers, so there is nothing to cascade or expire.
+        bool timersPending = (m_pendingCount > 0);
+        if (!timersPending)
+        {
+            m_nextTick = lastReachedTick + 1;
+            break;
+        }
+
+        // REDISTRIBUTE HIGHER LEVELS EACH TIME A LOWER LEVEL WRAPS AROUND.
+        // Each level's next slot holds the timers due during the next full rotation of
+        // the level below it, so they must be moved down before any of them are due.
+        unsigned int lowestLevelSlotIndex = static_cast<unsigned int>(m_nextTick & SLOT_INDEX_MASK);
+        bool lowestLevelWrapped = (0 == lowestLevelSlotIndex);
+        if (lowestLevelWrapped)
+        {
+            for (unsigned int level = 1; level < LEVEL_COUNT; ++level)
+            {
+                unsigned int slotIndexInLevel = static_cast<unsigned int>((m_nextTick >> (SLOT_INDEX_BIT_COUNT * level)) & SLOT_INDEX_MASK);
+                Cascade(level, slotIndexInLevel);
+
+                // Higher levels only need to be redistributed if this level also wrapped around.
+                bool levelWrapped = (0 == slotIndexInLevel);
+                if (!levelWrapped)
+                {
+                    break;
+                }
+            }
+        }
+
+        // EXPIRE ALL TIMERS DUE ON THIS TICK.
+        // Every timer in the lowest level's slot for the tick is due, so the whole slot is emptied at once.
+        unsigned int timerIndex = m_firstTimerIndices[lowestLevelSlotIndex];
+        m_firstTimerIndices[lowestLevelSlotIndex] = NO_TIMER_INDEX;
+        while (NO_TIMER_INDEX != timerIndex)
+        {
+            unsigned int nextTimerIndex = m_timers[timerIndex].NextTimerIndex;
+            expiredEvents.push_back(m_timers[timerIndex].Event);
+            Free(timerIndex);
+            timerIndex = nextTimerIndex;
+        }
+
+        ++m_nextTick;
+    }
+}
+
+void TimerWheel::Link(const unsigned int timerIndex)
+{
+    // DETERMINE HOW MANY TICKS REMAIN UNTIL THE TIMER IS DUE.
+    // Timers that are already due are placed in the slot for the next tick to be processed.
+    Timer& timer = m_timers[timerIndex];
+    uint64_t dueTick = std::max(timer.DueTick, m_nextTick);
+    uint64_t ticksUntilDue = dueTick - m_nextTick;
+
+    // FIND THE LOWEST LEVEL THAT CAN REACH THE DUE TICK.
+    unsigned int level = 0;
+    while (level < (LEVEL_COUNT - 1))
+    {
+        uint64_t levelTickRange = (static_cast<uint64_t>(1) << (SLOT_INDEX_BIT_COUNT * (level + 1)));
+        bool dueWithinLevel = (ticksUntilDue < levelTickRange);
+        if (dueWithinLevel)
+        {
+            break;
+        }
+
+        ++level;
+    }
+
+    // ADD THE TIMER TO THE FRONT OF THE SLOT FOR THE DUE TICK.
+    const unsigned int SLOT_INDEX_MASK = (SLOT_COUNT_PER_LEVEL - 1);
+    unsigned int slotIndexInLevel = static_cast<unsigned int>((dueTick >> (SLOT_INDEX_BIT_COUNT * level)) & SLOT_INDEX_MASK);
+    unsigned int slotIndex = (level * SLOT_COUNT_PER_LEVEL) + slotIndexInLevel;
+
+    unsigned int firstTimerIndex = m_firstTimerIndices[slotIndex];
+    timer.SlotIndex = slotIndex;
+    timer.PreviousTimerIndex = NO_TIMER_INDEX;
+    timer.NextTimerIndex = firstTimerIndex;
+    if (NO_TIMER_INDEX != firstTimerIndex)
+    {
+        m_timers[firstTimerIndex].PreviousTimerIndex = timerIndex;
+    }
+    m_firstTimerIndices[slotIndex] = timerIndex;
+}
+
+void TimerWheel::Unlink(const unsigned int timerIndex)
+{
+    // CONNECT THE NEIGHBORING TIMERS TO EACH OTHER.
+    Timer& timer = m_timers[timerIndex];
+    bool firstInSlot = (NO_TIMER_INDEX == timer.PreviousTimerIndex);
+    if (firstInSlot)
+    {
+        m_firstTimerIndices[timer.SlotIndex] = timer.NextTimerIndex;
+    }
+    else
+    {
+        m_timers[timer.PreviousTimerIndex].NextTimerIndex = timer.NextTimerIndex;
+    }
+
+    bool lastInSlot = (NO_TIMER_INDEX == timer.NextTimerIndex);
+    if (!lastInSlot)
+    {
+        m_timers[timer.NextTimerIndex].PreviousTimerIndex = timer.PreviousTimerIndex;
+    }
+}
+
+void TimerWheel::Free(const unsigned int timerIndex)
+{
+    // INVALIDATE ANY HANDLES TO THE TIMER.
+    Timer& timer = m_timers[timerIndex];
+    timer.Pending = false;
+    ++timer.Generation;
+
+    // ALLOW THE STORAGE TO BE REUSED.
+    m_freeTimerIndices.push_back(timerIndex);
+    --m_pendingCount;
+}
+
+void TimerWheel::Cascade(const unsigned int level, const unsigned int slotIndexInLevel)
+{
+    // EMPTY THE SLOT.
+    unsigned int slotIndex = (level * SLOT_COUNT_PER_LEVEL) + slotIndexInLevel;
+    unsigned int timerIndex = m_firstTimerIndices[slotIndex];
+    m_firstTimerIndices[slotIndex] = NO_TIMER_INDEX;
+
+    // MOVE EACH TIMER TO THE SLOT FOR ITS DUE TICK.
+    // Since the timers are now closer to being due, they are placed in lower levels.
+    while (NO_TIMER_INDEX != timerIndex)
+    {
+        unsigned int nextTimerIndex = m_timers[timerIndex].NextTimerIndex;
+        Link(timerIndex);
+        timerIndex = nextTimerIndex;
+    }
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <SFML/System.hpp>
+#include "Containers/GenerationalHandle.h"
+
+namespace SIMULATION
+{
+    ////////////////////////////////////////////////////////
+    /// @brief  Identifies what should happen when a timer expires.
+    ///         The meaning of the type is defined by whoever
+    ///         schedules the timer.
+    ////////////////////////////////////////////////////////
+    struct TimerEvent
+    {
+        unsigned int Type;  ///< The kind of event.
+        CONTAINERS::GenerationalHandle Target;  ///< The object the event applies to.  Invalid if the event has no target.
+
+        /// @brief  Constructor.  Creates an event of type 0 without a target.
+        TimerEvent() :
+            Type(0),
+            Target()
+        {}
+
+        /// @brief      Constructor.
+        /// @param[in]  type - The kind of event.
+        /// @param[in]  target - The object the event applies to.
+        TimerEvent(const unsigned int type, const CONTAINERS::GenerationalHandle& target) :
+            Type(type),
+            Target(target)
+        {}
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  Schedules events to occur after delays of simulation time.
+    ///
+    ///         Timers are kept in a hierarchical timer wheel.  Time is
+    ///         divided into ticks of a fixed resolution, and each level
+    ///         of the wheel has a ring of slots covering a range of ticks
+    ///         that is a multiple of the level below it.  A timer is placed
+    ///         in the slot for its due tick on the lowest level that can
+    ///         reach it.  Each time the lowest level wraps around, the next
+    ///         slot of the level above is redistributed into lower levels.
+    ///         Scheduling, cancelling, and expiring a timer are therefore all
+    ///         constant-time, no matter how many timers are pending, and
+    ///         pending timers that aren't due yet are never examined.
+    ///
+    ///         Timers never expire early, but may expire up to one tick
+    ///         late.  Storage for timers is allocated up front and reused,
+    ///         only growing if more timers are pending than ever before.
+    ////////////////////////////////////////////////////////
+    class TimerWheel
+    {
+    public:
+        /// @brief  The default number of timers that may be pending before storage must grow.
+        ///         This comfortably exceeds the number of timers normally pending during gameplay.
+        static const unsigned int DEFAULT_CAPACITY = 1024;
+        /// @brief  The default duration of each tick of the wheel.
+        static const sf::Time DEFAULT_RESOLUTION;
+
+        /// @brief      Constructor.  Allocates storage for timers up front.
+        /// @param[in]  resolution - The duration of each tick of the wheel.  Must be positive.
+        /// @param[in]  capacity - The number of timers that may be pending before storage must grow.
+        explicit TimerWheel(const sf::Time& resolution, const unsigned int capacity);
+
+        /// @brief  Destructor.
+        ~TimerWheel();
+
+        /// @brief      Schedules an event to occur after a delay.
+        /// @param[in]  delay - The simulation time from the current time until the event occurs.
+        ///             Delays longer than the wheel can represent are shortened to the longest delay.
+        /// @param[in]  event - The event to occur.
+        /// @return     The handle of the timer for the event.
+        CONTAINERS::GenerationalHandle Schedule(const sf::Time& delay, const TimerEvent& event);
+
+        /// @brief      Cancels a timer so that its event never occurs.
+        ///             Does nothing if the timer already expired or was cancelled.
+        /// @param[in]  timer - The handle of the timer to cancel.
+        void Cancel(const CONTAINERS::GenerationalHandle& timer);
+
+        /// @brief      Checks if a timer is still waiting to expire.
+        /// @param[in]  timer - The handle of the timer to check.
+        /// @return     True if the timer is pending; false if it expired or was cancelled.
+        bool IsPending(const CONTAINERS::GenerationalHandle& timer) const;
+
+        /// @brief  Gets the number of timers waiting to expire.
+        /// @return The number of pending timers.
+        unsigned int GetPendingCount() const;
+
+        /// @brief          Advances the wheel to the specified simulation time, expiring all timers
+        ///                 that are due by then.  Events of timers due on earlier ticks are output
+        ///                 before those due on later ticks.
+        /// @param[in]      currentTime - The current simulation time.  Must not be earlier than
+        ///                 the time the wheel was last advanced to.
+        /// @param[in,out]  expiredEvents - The events of expired timers are appended to this buffer.
+        void AdvanceTo(const sf::Time& currentTime, std::vector<TimerEvent>& expiredEvents);
+
+    private:
+        TimerWheel(const TimerWheel& wheelToCopy);  ///< Private to disallow copying.
+        TimerWheel& operator= (const TimerWheel& rhsWheel); ///< Private to disallow assignment.
+
+        /// @brief  The number of bits of a tick used to index the slots of each level.
+        static const unsigned int SLOT_INDEX_BIT_COUNT = 8;
+        /// @brief  The number of slots in each level of the wheel.
+        static const unsigned int SLOT_COUNT_PER_LEVEL = (1 << SLOT_INDEX_BIT_COUNT);
+        /// @brief  The number of levels in the wheel.  With the default resolution,
+        ///         this allows delays of more than a month to be represented.
+        static const unsigned int LEVEL_COUNT = 4;
+        /// @brief  The index used to indicate that no timer is linked.
+        static const unsigned int NO_TIMER_INDEX = 0xFFFFFFFF;
+
+        ////////////////////////////////////////////////////////
+        /// @brief  A single timer, linked into the list of timers
+        ///         for the slot it is waiting in.
+        ////////////////////////////////////////////////////////
+        struct Timer
+        {
+            uint64_t DueTick;   ///< The tick on which the timer expires.
+            TimerEvent Event;   ///< The event to occur when the timer expires.
+            unsigned int SlotIndex; ///< The index of the slot (across all levels) the timer is in.
+            unsigned int PreviousTimerIndex;    ///< The previous timer in the same slot.
+            unsigned int NextTimerIndex;    ///< The next timer in the same slot.
+            unsigned int Generation;    ///< The current generation of the timer's storage.
+            bool Pending;   ///< Whether the timer is waiting to expire.
+        };
+
+        /// @brief      Adds a pending timer to the slot for its due tick.
+        /// @param[in]  timerIndex - The index of the timer to link.
+        void Link(const unsigned int timerIndex);
+
+        /// @brief      Removes a pending timer from its slot.
+        /// @param[in]  timerIndex - The index of the timer to unlink.
+        void Unlink(const unsigned int timerIndex);
+
+        /// @brief      Releases the storage of a timer so that it can be reused.
+        /// @param[in]  timerIndex - The index of the timer to free.
+        void Free(const unsigned int timerIndex);
+
+        /// @brief      Redistributes all timers in a slot into the levels below it.
+        /// @param[in]  level - The level of the slot.
+        /// @param[in]  slotIndexInLevel - The index of the slot within its level.
+        void Cascade(const unsigned int level, const unsigned int slotIndexInLevel);
+
+        sf::Time m_resolution;  ///< The duration of each tick of the wheel.
+        sf::Time m_currentTime; ///< The simulation time the wheel was last advanced to.
+        uint64_t m_nextTick;    ///< The next tick to expire timers for.  All earlier ticks have been processed.
+        unsigned int m_pendingCount;    ///< The number of timers waiting to expire.
+        std::vector<Timer> m_timers;    ///< Storage for all timers, pending or not.
+        std::vector<unsigned int> m_freeTimerIndices;   ///< Indices of timers available for reuse.
+        std::array<unsigned int, LEVEL_COUNT * SLOT_COUNT_PER_LEVEL> m_firstTimerIndices;   ///< The first timer in each slot, by level and then slot.
+    };
+}
@@ -1,11 +1,15 @@
 #include <stdexcept>
+#include "Resources/AssetFilepaths.h"
 #include "States/CreditsState.h"
 
 using namespace STATES;
 
-CreditsState::CreditsState(const sf::FloatRect& screenBoundsInPixels) :
+CreditsState::CreditsState(
+    const sf::FloatRect& screenBoundsInPixels,
+    const std::shared_ptr<RESOURCES::ResourceManager>& resourceManager) :
     m_screenBoundsInPixels(screenBoundsInPixels),
-    m_resourceManager(),
+    m_resourceManager(resourceManager),
+    m_font(),
     m_nextGameState(GAME_STATE_TYPE_INVALID),
     m_contributors()
 {
@@ -33,7 +37,7 @@ void CreditsState::Update(const sf::Time& elapsedTime)
     // Nothing else to do.
 }
 
-void CreditsState::Render(sf::RenderTarget& renderTarget)
+void CreditsState::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
 {
     // RENDER EACH OF THE CONTRIBUTORS.
     for (auto contributorText : m_contributors)
@@ -51,13 +55,14 @@ void CreditsState::HandleKeyPress(const sf::Keyboard::Key key)
 void CreditsState::InitializeCreditsText()
 {
     // LOAD THE FONT FOR THE CREDITS TEXT.
-    const std::string CREDITS_FONT_FILEPATH = "res/fonts/Minecraftia.ttf";
-    std::shared_ptr<sf::Font> creditsFont = m_resourceManager.GetFont(CREDITS_FONT_FILEPATH);
+    const std::string& CREDITS_FONT_FILEPATH = RESOURCES::GetAssetFilepath(RESOURCES::ASSET_FONT_MINECRAFTIA);
+    std::shared_ptr<sf::Font> creditsFont = m_resourceManager->GetFont(CREDITS_FONT_FILEPATH);
     bool creditsFontLoaded = (nullptr != creditsFont);
     if (!creditsFontLoaded)
     {
         throw std::runtime_error("Error loading credits font.");
     }
+    m_font = creditsFont;
 
     // ADD EACH OF THE CONTRIBUTORS TO THE LIST OF CREDITS.
     const unsigned int CREDITS_FONT_HEIGHT_IN_PIXELS = 14;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 #include "Resources/ResourceManager.h"
 #include "States/IGameState.h"
@@ -14,7 +15,10 @@ namespace STATES
     public:
         /// @brief      Constructor.
         /// @param[in]  screenBoundsInPixels - The boundaries of the screen.
-        explicit CreditsState(const sf::FloatRect& screenBoundsInPixels);
+        /// @param[in]  resourceManager - The resource manager shared by all states.
+        explicit CreditsState(
+            const sf::FloatRect& screenBoundsInPixels,
+            const std::shared_ptr<RESOURCES::ResourceManager>& resourceManager);
 
         /// @brief  Destructor.
         virtual ~CreditsState();
@@ -28,8 +32,8 @@ namespace STATES
         /// @copydoc    IGameState::Update(const sf::Time& elapsedTime)
         virtual void Update(const sf::Time& elapsedTime);
 
-        /// @copydoc    IGameState::Render(sf::RenderTarget& renderTarget)
-        virtual void Render(sf::RenderTarget& renderTarget);
+        /// @copydoc    IGameState::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
+        virtual void Render(sf::RenderTarget& renderTarget, const float interpolationRatio);
 
         /// @copydoc    IGameState::HandleKeyPress(const sf::Keyboard::Key key)
         virtual void HandleKeyPress(const sf::Keyboard::Key key);
@@ -42,7 +46,8 @@ namespace STATES
         void InitializeCreditsText();
 
         sf::FloatRect m_screenBoundsInPixels;   ///< The boundaries of the screen.
-        RESOURCES::ResourceManager m_resourceManager;   ///< The resource manager.
+        std::shared_ptr<RESOURCES::ResourceManager> m_resourceManager;   ///< The resource manager.
+        std::shared_ptr<sf::Font> m_font;   ///< The font for all text on the credits screen.  Held so that it remains loaded while used by the text.
         GameStateType m_nextGameState;  ///< The next game state that should follow when the user is done viewing credits.
         std::vector<sf::Text> m_contributors;    ///< The text displayed for contributors in the credits.
     };
@@ -1,12 +1,11 @@
-#include <chrono>
+#include <algorithm>
 #include <fstream>
-#include <random>
 #include <stdexcept>
 #include "GalacticEggSnatchersGame.h"
 #include "Graphics/IRenderable.h"
-#include "Input/KeyboardController.h"
 #include "Objects/AlienFactory.h"
 #include "Objects/EasterEggFactory.h"
+#include "Profiling/Profiling.h"
 #include "States/GameplayState.h"
 #include <iostream>
 
@@ -16,38 +15,94 @@ using namespace STATES;
 const uint16_t GameplayState::DEFAULT_ALIEN_KILL_POINTS = 100;
 const uint16_t GameplayState::MAX_HIGH_SCORE = 65500;
 
+// Handlers for each combination of collision layers, indexed by the lower layer and then the higher layer.
+// Combinations of layers that never interact have no handler.
+const GameplayState::CollisionHandler GameplayState::COLLISION_HANDLERS[PHYSICS::COLLISIONS::COLLISION_LAYER_COUNT][PHYSICS::COLLISIONS::COLLISION_LAYER_COUNT] =
+{
+    // COLLISION_LAYER_BUNNY
+    { nullptr, nullptr, &GameplayState::HandleBunnyAlienCollision, &GameplayState::HandleBunnyAlienMissileCollision, nullptr },
+    // COLLISION_LAYER_BUNNY_MISSILE
+    { nullptr, nullptr, &GameplayState::HandleBunnyMissileAlienCollision, nullptr, nullptr },
+    // COLLISION_LAYER_ALIEN
+    { nullptr, nullptr, nullptr, nullptr, &GameplayState::HandleAlienEasterEggCollision },
+    // COLLISION_LAYER_ALIEN_MISSILE
+    { nullptr, nullptr, nullptr, nullptr, &GameplayState::HandleAlienMissileEasterEggCollision },
+    // COLLISION_LAYER_EGG
+    { nullptr, nullptr, nullptr, nullptr, nullptr }
+};
+
 // INSTANCE METHODS.
 
-GameplayState::GameplayState(const sf::FloatRect& screenBoundsInPixels) :
-    m_resourceManager(),
+GameplayState::GameplayState(
+    const sf::FloatRect& screenBoundsInPixels,
+    const GameplaySettings& settings,
+    const std::shared_ptr<INPUT::IInputController>& playerController,
+    const std::shared_ptr<RESOURCES::ResourceManager>& resourceManager) :
+    m_settings(settings),
+    m_resourceManager(resourceManager),
+    m_soundBuffers(),
+    m_soundPlayer(settings.HeadlessMode ? 0 : AUDIO::SoundPlayer::DEFAULT_VOICE_COUNT),
+    m_textureAtlas(GetGameplayImageIds(), *resourceManager),
+    m_spriteBatch(),
+    m_hudFont(),
     m_gameplayHud(),
+    m_randomNumberGenerator(settings.RandomSeed),
+    m_simulationClock(),
+    m_timers(SIMULATION::TimerWheel::DEFAULT_RESOLUTION, SIMULATION::TimerWheel::DEFAULT_CAPACITY),
+    m_expiredTimerEvents(),
     m_screenBoundsInPixels(screenBoundsInPixels),
-    m_collisionSystem(),
-    m_playerController(),
-    m_bunnyMissileFiringClock(),
+    m_collisionSystem(screenBoundsInPixels),
+    m_collisionPairs(),
+    m_missilesExplodedThisUpdate(),
+    m_aliensKilledThisUpdate(),
+    m_easterEggsDestroyedThisUpdate(),
+    m_playerController(playerController),
+    m_bunnyMissileReloading(false),
     m_nextMainState(GAME_STATE_TYPE_INVALID),
     m_currentSubState(PLAYING_GAME_SUBSTATE),
     m_currentScore(0),
     m_highScore(0),
     m_highScores(),
-    m_alienParameters(),
+    m_alienParameters(settings.InitialAlienParameters),
     m_bunnyPlayer(),
     m_easterEggs(),
     m_aliens(),
-    m_missiles(),
+    m_missiles(settings.MissileCapacity),
+    m_bunnyMissileSprite(),
+    m_alienMissileSprite(),
     m_explosions()
 {
+    // CREATE THE TEXTURE FOR ALL GAMEPLAY SPRITES.
+    // There is no graphics device to create it on in headless mode.
+    if (!m_settings.HeadlessMode)
+    {
+        m_textureAtlas.CreateTexture();
+    }
+
+    // LOAD ALL SOUNDS SO THAT THEY CAN BE PLAYED WITHOUT LOOKING THEM UP BY FILEPATH.
+    LoadSoundBuffers();
+
+    // LOAD RESOURCES NEEDED FOR FIRING MISSILES.
+    InitializeMissileResources();
+
+    // RESERVE SPACE FOR EXPIRED TIMERS SO THAT HANDLING THEM NORMALLY DOESN'T ALLOCATE.
+    const unsigned int EXPECTED_MAX_EXPIRED_TIMERS_PER_UPDATE = 64;
+    m_expiredTimerEvents.reserve(EXPECTED_MAX_EXPIRED_TIMERS_PER_UPDATE);
+
     // CREATE THE INITIAL OBJECTS FOR A NEW GAMEPLAY SESSION.
-    m_playerController = std::make_shared<INPUT::KeyboardController>();
     m_bunnyPlayer = CreateInitialBunnyPlayer();
     m_easterEggs = CreateInitialEasterEggs();
-    m_aliens = CreateInitialAliens(m_alienParameters);
+    AddAlienGrid(m_alienParameters);
 
     // LOAD THE HIGH SCORES.
     LoadHighScores();
 
     // INITIALIZE THE HUD.
-    InitializeHud();
+    // There is nothing to display the HUD on in headless mode.
+    if (!m_settings.HeadlessMode)
+    {
+        InitializeHud();
+    }
 }
 
 
@@ -68,13 +123,26 @@ GameStateType GameplayState::GetNextState() const
 
 void GameplayState::Update(const sf::Time& elapsedTime)
 {
+    // SAVE WHERE OBJECTS ARE BEFORE THIS UPDATE MOVES THEM.
+    // This allows rendering to smoothly interpolate between simulation updates.
+    // It is done even if gameplay is frozen so that objects are rendered as stationary.
+    SavePreviousPositionsOfMovingObjects();
+
     // UPDATE THE GAME ONLY IF MAIN GAMEPLAY IS GOING ON.
     // This will "freeze" the game when the player has won or lost.
     // Updates for handling the win/lost sub-states are elsewhere.
     bool gameplayOccurring = (PLAYING_GAME_SUBSTATE == m_currentSubState);
     if (gameplayOccurring)
     {
+        // ADVANCE SIMULATION TIME.
+        // Timed events are handled first so that input and objects see their results.
+        m_simulationClock.Update(elapsedTime);
+        m_expiredTimerEvents.clear();
+        m_timers.AdvanceTo(m_simulationClock.GetElapsedTime(), m_expiredTimerEvents);
+        HandleExpiredTimers();
+
         // HANDLE USER INPUT.
+        m_playerController->Update(elapsedTime);
         HandleInput(*m_playerController, elapsedTime);
 
         // UPDATE THE MAIN GAME OBJECTS.
@@ -92,7 +160,7 @@ void GameplayState::Update(const sf::Time& elapsedTime)
         // has managed to do that in-between updates, congratulations!
         // Therefore, exactly one alien is require for spawning a new wave.
         const unsigned int REMAINING_ALIENS_TO_TRIGGER_NEW_WAVE = 1;
-        bool moreAliensNeeded = (REMAINING_ALIENS_TO_TRIGGER_NEW_WAVE == m_aliens.size());
+        bool moreAliensNeeded = (REMAINING_ALIENS_TO_TRIGGER_NEW_WAVE == m_aliens.GetCount());
         if (moreAliensNeeded)
         {
             SpawnAlienWave();
@@ -100,21 +168,52 @@ void GameplayState::Update(const sf::Time& elapsedTime)
 
         // UPDATE THE HUD.
         /// @todo Scores are updated elsewhere, but maybe they should be updated here?
-        m_gameplayHud->SetLivesCount(m_bunnyPlayer->GetLives());
+        if (m_gameplayHud)
+        {
+            m_gameplayHud->SetLivesCount(m_bunnyPlayer->GetLives());
+        }
     }
 
+    // START ALL SOUNDS REQUESTED DURING THIS UPDATE.
+    m_soundPlayer.Update();
+
     // UPDATE THE SUB-STATE OF THE GAME TO DETECT WIN/LOSS CONDITIONS.
     UpdateSubState();
 }
 
-void GameplayState::Render(sf::RenderTarget& renderTarget)
+void GameplayState::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
 {
-    RenderGameObjects(renderTarget);
-    m_gameplayHud->Render(renderTarget);
+    RenderGameObjects(renderTarget, interpolationRatio);
+
+    if (m_gameplayHud)
+    {
+        // UPDATE THE PERFORMANCE OVERLAY IF IT'S SHOWN.
+        if (m_gameplayHud->IsPerformanceOverlayVisible())
+        {
+            GRAPHICS::GUI::GameObjectCounts gameObjectCounts;
+            gameObjectCounts.AlienCount = m_aliens.GetCount();
+            gameObjectCounts.MissileCount = m_missiles.GetCount();
+            gameObjectCounts.ExplosionCount = static_cast<unsigned int>(m_explosions.size());
+            gameObjectCounts.EasterEggCount = static_cast<unsigned int>(m_easterEggs.size());
+            m_gameplayHud->SetGameObjectCounts(gameObjectCounts);
+        }
+
+        m_gameplayHud->Render(renderTarget, interpolationRatio);
+    }
 }
 
 void GameplayState::HandleKeyPress(const sf::Keyboard::Key key)
 {
+    // TOGGLE THE PERFORMANCE OVERLAY IF REQUESTED.
+    // This is allowed at any time so that performance can be checked even after gameplay ends.
+    bool performanceOverlayToggled = (sf::Keyboard::F3 == key);
+    if (performanceOverlayToggled && m_gameplayHud)
+    {
+        bool performanceOverlayVisible = m_gameplayHud->IsPerformanceOverlayVisible();
+        m_gameplayHud->SetPerformanceOverlayVisible(!performanceOverlayVisible);
+        return;
+    }
+
     // CHECK IF THE GAMEPLAY HAS ENDED.
     bool playerWon = (VICTORY_SUBSTATE == m_currentSubState);
     bool playerLost = (GAME_OVER_SUBSTATE == m_currentSubState);
@@ -139,19 +238,104 @@ void GameplayState::HandleKeyPress(const sf::Keyboard::Key key)
     }
 }
 
-std::shared_ptr<OBJECTS::EasterBunny> GameplayState::CreateInitialBunnyPlayer()
+bool GameplayState::GameplayEnded() const
+{
+    bool gameplayOccurring = (PLAYING_GAME_SUBSTATE == m_currentSubState);
+    return !gameplayOccurring;
+}
+
+unsigned int GameplayState::GetGameObjectCount() const
+{
+    const unsigned int BUNNY_COUNT = 1;
+    unsigned int gameObjectCount = (
+        BUNNY_COUNT +
+        static_cast<unsigned int>(m_easterEggs.size()) +
+        m_aliens.GetCount() +
+        m_missiles.GetCount() +
+        static_cast<unsigned int>(m_explosions.size()));
+    return gameObjectCount;
+}
+
+std::vector<RESOURCES::AssetId> GameplayState::GetGameplayImageIds()
 {
-    // LOAD THE TEXTURE FOR THE BUNNY.
-    const std::string BUNNY_TEXTURE_FILEPATH = "res/Images/bunny.png";
-    std::shared_ptr<sf::Texture> bunnyTexture = m_resourceManager.GetTexture(BUNNY_TEXTURE_FILEPATH);
-    bool bunnyTextureLoaded = (nullptr != bunnyTexture);
-    if (!bunnyTextureLoaded)
+    std::vector<RESOURCES::AssetId> imageIds = OBJECTS::AlienFactory::GetAllAlienTextureIds();
+    std::vector<RESOURCES::AssetId> eggTextureIds = OBJECTS::EasterEggFactory::GetAllEggTextureIds();
+    imageIds.insert(imageIds.end(), eggTextureIds.begin(), eggTextureIds.end());
+    imageIds.push_back(RESOURCES::ASSET_IMAGE_BUNNY);
+    imageIds.push_back(RESOURCES::ASSET_IMAGE_CARROT);
+    imageIds.push_back(RESOURCES::ASSET_IMAGE_ALIEN_MISSILE);
+    imageIds.push_back(RESOURCES::ASSET_IMAGE_EXPLOSION);
+    return imageIds;
+}
+
+std::vector<RESOURCES::AssetId> GameplayState::GetGameplaySoundIds()
+{
+    std::vector<RESOURCES::AssetId> soundIds;
+    soundIds.push_back(RESOURCES::ASSET_SOUND_EXPLOSION);
+    soundIds.push_back(RESOURCES::ASSET_SOUND_MISSILE_LAUNCH);
+    return soundIds;
+}
+
+std::shared_ptr<sf::Sprite> GameplayState::CreateSprite(const RESOURCES::AssetId textureId)
+{
+    PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_SPRITES);
+
+    // FIND THE AREA OF THE ATLAS CONTAINING THE TEXTURE'S IMAGE.
+    const sf::IntRect& textureRectangle = m_textureAtlas.GetTextureRectangle(textureId);
+
+    // CREATE THE SPRITE.
+    std::shared_ptr<sf::Sprite> sprite = std::make_shared<sf::Sprite>();
+    // Nothing is ever drawn in headless mode, so the sprite doesn't need a texture.
+    if (!m_settings.HeadlessMode)
     {
-        throw std::runtime_error("Error loading bunny texture.");
+        sprite->setTexture(m_textureAtlas.GetTexture());
     }
+    sprite->setTextureRect(textureRectangle);
+    return sprite;
+}
+
+void GameplayState::LoadSoundBuffers()
+{
+    // CHECK IF SOUNDS CAN BE PLAYED.
+    if (m_settings.HeadlessMode)
+    {
+        // No audio device exists to play sounds on.
+        return;
+    }
+
+    // LOAD THE SOUND DATA.
+    std::vector<RESOURCES::AssetId> soundIds = GetGameplaySoundIds();
+    for (RESOURCES::AssetId soundId : soundIds)
+    {
+        const std::string& soundFilepath = RESOURCES::GetAssetFilepath(soundId);
+        std::shared_ptr<sf::SoundBuffer> soundBuffer = m_resourceManager->GetSoundBuffer(soundFilepath);
+        bool soundBufferLoaded = (nullptr != soundBuffer);
+        if (!soundBufferLoaded)
+        {
+            throw std::runtime_error("Error loading sound: " + soundFilepath);
+        }
+
+        m_soundBuffers[soundId] = soundBuffer;
+    }
+}
+
+const std::shared_ptr<sf::SoundBuffer>& GameplayState::GetSoundBuffer(const RESOURCES::AssetId soundId) const
+{
+    return m_soundBuffers[soundId];
+}
+
+void GameplayState::PlaySound(const RESOURCES::AssetId soundId, const AUDIO::SoundPriority priority)
+{
+    PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_SOUNDS);
+
+    // The sound player ignores sounds that weren't loaded since no audio device exists.
+    m_soundPlayer.Play(GetSoundBuffer(soundId), priority);
+}
 
+std::shared_ptr<OBJECTS::EasterBunny> GameplayState::CreateInitialBunnyPlayer()
+{
     // CREATE THE SPRITE FOR THE BUNNY.
-    std::shared_ptr<sf::Sprite> bunnySprite = std::make_shared<sf::Sprite>(*bunnyTexture);
+    std::shared_ptr<sf::Sprite> bunnySprite = CreateSprite(RESOURCES::ASSET_IMAGE_BUNNY);
     
     // Set the initial position of the bunny sprite.
     float screenXCenter = (static_cast<float>(GalacticEggSnatchersGame::SCREEN_WIDTH_IN_PIXELS) / 2.0f);
@@ -177,17 +361,9 @@ std::vector< std::shared_ptr<OBJECTS::EasterEgg> > GameplayState::CreateInitialE
     std::vector< std::shared_ptr<OBJECTS::EasterEgg> > initialEasterEggs;
     for (unsigned int currentEasterEggCount = 0; currentEasterEggCount < INITIAL_EASTER_EGG_COUNT; ++currentEasterEggCount)
     {
-        // LOAD THE TEXTURE FOR THE EASTER EGG.
-        const std::string EGG_TEXTURE_FILEPATH = OBJECTS::EasterEggFactory::GetRandomEggTextureFilepath();
-        std::shared_ptr<sf::Texture> eggTexture = m_resourceManager.GetTexture(EGG_TEXTURE_FILEPATH);
-        bool eggTextureLoaded = (nullptr != eggTexture);
-        if (!eggTextureLoaded)
-        {
-            throw std::runtime_error("Error loading egg texture.");
-        }
-
         // CREATE A SPRITE FOR THE EASTER EGG.
-        std::shared_ptr<sf::Sprite> eggSprite = std::make_shared<sf::Sprite>(*eggTexture);
+        RESOURCES::AssetId eggTextureId = OBJECTS::EasterEggFactory::GetRandomEggTextureId(m_randomNumberGenerator);
+        std::shared_ptr<sf::Sprite> eggSprite = CreateSprite(eggTextureId);
 
         // POSITION THE SPRITE.
         // It is positioned so that all eggs are equally spaced out along a horizontal line
@@ -214,41 +390,34 @@ std::vector< std::shared_ptr<OBJECTS::EasterEgg> > GameplayState::CreateInitialE
     return initialEasterEggs;
 }
 
-std::list< std::shared_ptr<OBJECTS::Alien> > GameplayState::CreateInitialAliens(const AlienDifficultyParameters& alienParameters)
+void GameplayState::InitializeMissileResources()
 {
-    // LOAD THE MISSILE SOUND DATA FOR ALIENS.
-    const std::string MISSILE_SOUND_FILEPATH = "res/Sounds/MissileLaunch.wav";
-    std::shared_ptr<sf::SoundBuffer> missileSoundBuffer = m_resourceManager.GetSoundBuffer(MISSILE_SOUND_FILEPATH);
-    bool missileSoundBufferLoaded = (nullptr != missileSoundBuffer);
-    if (!missileSoundBufferLoaded)
-    {
-        throw std::runtime_error("Error loading missile sound.");
-    }
-    
+    // CREATE THE SPRITES TO COPY FOR MISSILES.
+    m_bunnyMissileSprite = CreateSprite(RESOURCES::ASSET_IMAGE_CARROT);
+    m_alienMissileSprite = CreateSprite(RESOURCES::ASSET_IMAGE_ALIEN_MISSILE);
+}
+
+void GameplayState::AddAlienGrid(const AlienDifficultyParameters& alienParameters)
+{
+    PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_ALIENS);
+
     // CREATE A 2D GRID OF ALIENS.
     // The number of aliens may be adjusted later depending on spacing/gameplay experience.
-    const unsigned int ALIEN_ROW_COUNT = 5;
-    const unsigned int ALIEN_COLUMN_COUNT = 6;
-    std::list< std::shared_ptr<OBJECTS::Alien> > initialAliens;
+    const unsigned int ALIEN_ROW_COUNT = m_settings.AlienRowCount;
+    const unsigned int ALIEN_COLUMN_COUNT = m_settings.AlienColumnCount;
+    m_aliens.Reserve(m_aliens.GetCount() + ALIEN_ROW_COUNT * ALIEN_COLUMN_COUNT);
 
     for (unsigned int currentAlienRow = 0; currentAlienRow < ALIEN_ROW_COUNT; ++currentAlienRow)
     {
         for (unsigned int currentAlienColumn = 0; currentAlienColumn < ALIEN_COLUMN_COUNT; ++currentAlienColumn)
         {
-            // LOAD THE TEXTURE FOR THE ALIEN.
+            // GET THE APPEARANCE FOR THE ALIEN.
             // Select a random texture to provide variety during gameplay.
-            std::string alienTextureFilepath = OBJECTS::AlienFactory::GetRandomAlienTextureFilepath();
-            std::shared_ptr<sf::Texture> alienTexture = m_resourceManager.GetTexture(alienTextureFilepath);
-            bool alienTextureLoaded = (nullptr != alienTexture);
-            if (!alienTextureLoaded)
-            {
-                throw std::runtime_error("Error loading alien texture.");
-            }
+            RESOURCES::AssetId alienTextureId = OBJECTS::AlienFactory::GetRandomAlienTextureId(m_randomNumberGenerator);
+            std::shared_ptr<sf::Sprite> alienSprite = CreateSprite(alienTextureId);
+            unsigned int alienSpriteId = m_aliens.GetSpriteId(*alienSprite);
 
-            // CREATE A SPRITE FOR THE ALIEN.
-            std::shared_ptr<sf::Sprite> alienSprite = std::make_shared<sf::Sprite>(*alienTexture);
-
-            // POSITION THE SPRITE.
+            // POSITION THE ALIEN.
             // The alien is positioned show that all aliens in the grid are uniformly spaced out.
             // Adjustments to positioning may be needed at a later date.
 
@@ -257,9 +426,15 @@ std::list< std::shared_ptr<OBJECTS::Alien> > GameplayState::CreateInitialAliens(
             const float VerticalSpacingBetweenAliens = 8.0f;
             float alienHeightInPixels = alienSprite->getGlobalBounds().height;
             float minAlienYPosition = (alienHeightInPixels * 3.0f);
+
+            // Rows are packed closer together if there are more of them than normal so that
+            // larger grids don't start out on top of the Easter eggs.
+            float alienRowHeight = (VerticalSpacingBetweenAliens + alienHeightInPixels);
+            float maxGridHeight = alienRowHeight * static_cast<float>(GameplaySettings::DEFAULT_ALIEN_ROW_COUNT);
+            float alienRowSpacing = std::min(alienRowHeight, maxGridHeight / static_cast<float>(ALIEN_ROW_COUNT));
             float alienYPosition = (
                 minAlienYPosition + 
-                (VerticalSpacingBetweenAliens + alienHeightInPixels) * static_cast<float>(currentAlienRow));
+                alienRowSpacing * static_cast<float>(currentAlienRow));
 
             // The X position is calculated so that all aliens in a row are equally spaced out along a horizontal line
             // across the screen (based on which "column" of aliens we are currently on for the current row).
@@ -271,36 +446,83 @@ std::list< std::shared_ptr<OBJECTS::Alien> > GameplayState::CreateInitialAliens(
             float alienHalfWidth = (alienSprite->getLocalBounds().width / 2.0f);
             float alienLeftXPosition = (alienCenterXPosition - alienHalfWidth);
 
-            alienSprite->setPosition(alienLeftXPosition, alienYPosition);
-
-            // LOAD THE ALIEN MISSILE TEXTURE.
-            const std::string ALIEN_MISSILE_TEXTURE_FILEPATH = "res/Images/alienMissile1.png";
-            std::shared_ptr<sf::Texture> alienMissileTexture = m_resourceManager.GetTexture(ALIEN_MISSILE_TEXTURE_FILEPATH);;
-            bool alienMissileTextureLoaded = (nullptr != alienMissileTexture);
-            if (!alienMissileTextureLoaded)
-            {
-                throw std::runtime_error("Error loading alien missile texture.");
-            }
-
-            // CREATE THE ALIEN.
-            // Note that std::make_shared is not used here simply because Visual Studio 2012
-            // doesn't seem to have a version that supports more than 5 arguments.
-            std::shared_ptr<OBJECTS::Alien> alien(new OBJECTS::Alien(
+            // ADD THE ALIEN.
+            CONTAINERS::GenerationalHandle alienHandle = m_aliens.Add(
+                sf::Vector2f(alienLeftXPosition, alienYPosition),
+                alienSpriteId,
+                alienParameters.HorizontalMoveSpeedInPixelsPerSecond,
                 alienParameters.MinTimeBetweenMissileFiresInSeconds,
                 alienParameters.MaxTimeBetweenMissileFiresInSeconds,
-                alienParameters.HorizontalMoveSpeedInPixelsPerSecond,
-                alienSprite, 
-                alienMissileTexture,
-                missileSoundBuffer) );
-            initialAliens.push_back(alien);
+                m_randomNumberGenerator);
+
+            // SCHEDULE THE ALIEN'S FIRST MISSILE.
+            ScheduleAlienMissileFire(alienHandle);
         }
     }
+}
+
+void GameplayState::ScheduleAlienMissileFire(const CONTAINERS::GenerationalHandle& alienHandle)
+{
+    // The timer is simply ignored when it expires if the alien was destroyed in the meantime,
+    // so it doesn't need to be tracked for cancelling.
+    unsigned int alienIndex = m_aliens.GetIndex(alienHandle);
+    sf::Time timeUntilNextMissileFire = m_aliens.GetTimeUntilNextMissileFire(alienIndex, m_randomNumberGenerator);
+    m_timers.Schedule(timeUntilNextMissileFire, SIMULATION::TimerEvent(TIMER_EVENT_ALIEN_MISSILE_FIRE, alienHandle));
+}
+
+void GameplayState::FireAlienMissile(const CONTAINERS::GenerationalHandle& alienHandle)
+{
+    PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_MISSILES);
+
+    // CHECK IF THE ALIEN STILL EXISTS.
+    bool alienExists = m_aliens.Contains(alienHandle);
+    if (!alienExists)
+    {
+        return;
+    }
 
-    return initialAliens;
+    // SCHEDULE THE ALIEN'S NEXT MISSILE.
+    // This is done even if the current missile can't be added so that the alien tries again later.
+    ScheduleAlienMissileFire(alienHandle);
+
+    // POSITION THE MISSILE SPRITE SO THAT IT FIRES FROM THE ALIEN.
+    // Adjust the position from the center of the alien based on how wide the missile is.
+    unsigned int alienIndex = m_aliens.GetIndex(alienHandle);
+    sf::Vector2f launchPosition = m_aliens.GetMissileLaunchPosition(alienIndex);
+    float missileWidth = m_alienMissileSprite->getLocalBounds().width;
+    float halfMissileWidth = (missileWidth / 2.0f);
+    float missileXPosition = (launchPosition.x - halfMissileWidth);
+
+    // Create the sprite for the missile.
+    sf::Sprite missileSprite(*m_alienMissileSprite);
+    missileSprite.setPosition(missileXPosition, launchPosition.y);
+
+    // FIRE THE MISSILE DOWNWARD FROM THE ALIEN.
+    const float NO_HORIZONTAL_MOVEMENT = 0.0f;
+    const float MISSILE_Y_VELOCITY_IN_PIXELS_PER_SECOND = 192.0f;
+    sf::Vector2f missileVelocity(NO_HORIZONTAL_MOVEMENT, MISSILE_Y_VELOCITY_IN_PIXELS_PER_SECOND);
+    
+    OBJECTS::WEAPONS::Missile alienMissile(
+        OBJECTS::WEAPONS::MISSILE_SOURCE_ALIEN,
+        missileVelocity,
+        missileSprite);
+
+    // ADD THE MISSILE IF ROOM EXISTS.
+    // If too many missiles are already flying, the alien simply doesn't fire.
+    CONTAINERS::GenerationalHandle missileHandle = m_missiles.Add(alienMissile);
+    bool missileAdded = m_missiles.Contains(missileHandle);
+    if (missileAdded)
+    {
+        // Alien missiles are frequent enough that any one of them can go unheard.
+        PlaySound(RESOURCES::ASSET_SOUND_MISSILE_LAUNCH, AUDIO::SOUND_PRIORITY_LOW);
+    }
 }
 
 void GameplayState::SpawnAlienWave()
 {
+    PROFILE_PHASE(PROFILED_PHASE_SPAWN_ALIEN_WAVE);
+    PROFILE_MARKER("SpawnAlienWave");
+
     // INCREASE THE ALIEN DIFFICULTY PARAMETERS.
     // First try decreasing the minimum frequency of alien missile fires.
     bool minMissileFiringTimeCanDecrease = (
@@ -309,8 +531,7 @@ void GameplayState::SpawnAlienWave()
     {
         // Make the new aliens potentially fire missiles more frequently.
         m_alienParameters.MinTimeBetweenMissileFiresInSeconds--;
-        std::list< std::shared_ptr<OBJECTS::Alien> > newAliens = CreateInitialAliens(m_alienParameters);
-        m_aliens.insert(m_aliens.end(), newAliens.begin(), newAliens.end());
+        AddAlienGrid(m_alienParameters);
         return;
     }
 
@@ -327,8 +548,7 @@ void GameplayState::SpawnAlienWave()
         // Make the new aliens potentially fire missiles more frequently.
         const unsigned int MISSILE_FIRE_MAX_TIME_DECREASE_PER_WAVE = 4;
         m_alienParameters.MaxTimeBetweenMissileFiresInSeconds -= MISSILE_FIRE_MAX_TIME_DECREASE_PER_WAVE;
-        std::list< std::shared_ptr<OBJECTS::Alien> > newAliens = CreateInitialAliens(m_alienParameters);
-        m_aliens.insert(m_aliens.end(), newAliens.begin(), newAliens.end());
+        AddAlienGrid(m_alienParameters);
         return;
     }
 
@@ -342,14 +562,15 @@ void GameplayState::SpawnAlienWave()
         // Make the new aliens move faster.
         const float ALIEN_SPEED_INCREASE_PER_WAVE = 4.0f;
         m_alienParameters.HorizontalMoveSpeedInPixelsPerSecond += ALIEN_SPEED_INCREASE_PER_WAVE;
-        std::list< std::shared_ptr<OBJECTS::Alien> > newAliens = CreateInitialAliens(m_alienParameters);
-        m_aliens.insert(m_aliens.end(), newAliens.begin(), newAliens.end());
+        AddAlienGrid(m_alienParameters);
         return;
     }
 }
 
 void GameplayState::LoadHighScores()
 {   
+    PROFILE_MARKER("LoadHighScores");
+
     // OPEN THE HIGH SCORES FILE.
     const std::string HIGH_SCORES_FILEPATH = "res/highScores.txt";
     std::ifstream highScoresFile(HIGH_SCORES_FILEPATH, std::ios_base::in);
@@ -390,20 +611,22 @@ void GameplayState::LoadHighScores()
 void GameplayState::InitializeHud()
 {
     // LOAD THE FONT RESOURCE.
-    std::shared_ptr<sf::Font> hudFont = m_resourceManager.GetFont("res/Fonts/Minecraftia.ttf");
-    bool fontLoaded = (nullptr != hudFont);
+    m_hudFont = m_resourceManager->GetFont(RESOURCES::GetAssetFilepath(RESOURCES::ASSET_FONT_MINECRAFTIA));
+    bool fontLoaded = (nullptr != m_hudFont);
     if (!fontLoaded)
     {
         throw std::runtime_error("Error loading HUD font.");
     }
 
     // INITIALIZE THE GAMEPLAY HUD.
-    m_gameplayHud = std::make_shared<GRAPHICS::GUI::GameplayHud>(m_screenBoundsInPixels, hudFont);
+    m_gameplayHud = std::make_shared<GRAPHICS::GUI::GameplayHud>(m_screenBoundsInPixels, m_hudFont);
     m_gameplayHud->SetHighScore(m_highScore);
 }
 
 void GameplayState::HandleInput(const INPUT::IInputController& playerController, const sf::Time& elapsedTime)
 {
+    PROFILE_PHASE(PROFILED_PHASE_HANDLE_INPUT);
+
     // CHECK IF MOVEMENT INPUT WAS PROVIDED.
     bool leftButtonPressed = playerController.LeftButtonPressed();
     bool rightButtonPressed = playerController.RightButtonPressed();
@@ -425,72 +648,71 @@ void GameplayState::HandleInput(const INPUT::IInputController& playerController,
     {
         // CHECK IF SUFFICIENT TIME HAS PASSED BETWEEN THE LAST TIME A BUNNY FIRED A MISSILE.
         // We don't want the player to be able to fire missiles too quickly.
-        const float TIME_DELAY_BETWEEN_BUNNY_MISSILE_FIRING_IN_SECONDS = 0.5f;
-        sf::Time elapsedTimeSinceLastBunnyMissileFired = m_bunnyMissileFiringClock.getElapsedTime();
-        float elapsedTimeSinceLastBunnyMissileFiredInSeconds = elapsedTimeSinceLastBunnyMissileFired.asSeconds();
-        bool bunnyMissileFiringTimeDelayExceeded = (elapsedTimeSinceLastBunnyMissileFiredInSeconds > TIME_DELAY_BETWEEN_BUNNY_MISSILE_FIRING_IN_SECONDS);
-        if (!bunnyMissileFiringTimeDelayExceeded)
+        if (m_bunnyMissileReloading)
         {
             // Don't fire a missile since enough time hasn't passed yet.
             return;
         }
 
-        // LOAD THE CARROT MISSILE TEXTURE.
-        const std::string CARROT_MISSILE_TEXTURE_FILEPATH = "res/Images/carrot.png";
-        std::shared_ptr<sf::Texture> carrotMissileTexture = m_resourceManager.GetTexture(CARROT_MISSILE_TEXTURE_FILEPATH);;
-        bool carrotMissileTextureLoaded = (nullptr != carrotMissileTexture);
-        if (!carrotMissileTextureLoaded)
-        {
-            throw std::runtime_error("Error loading carrot missile texture.");
-        }
-
-        // CREATE THE SPRITE FOR THE MISSILE.
-        std::shared_ptr<sf::Sprite> carrotMissileSprite = std::make_shared<sf::Sprite>(*carrotMissileTexture);
-
-        // LOAD THE MISSILE SOUND DATA.
-        const std::string MISSILE_SOUND_FILEPATH = "res/Sounds/MissileLaunch.wav";
-        std::shared_ptr<sf::SoundBuffer> missileSoundBuffer = m_resourceManager.GetSoundBuffer(MISSILE_SOUND_FILEPATH);
-        bool missileSoundBufferLoaded = (nullptr != missileSoundBuffer);
-        if (!missileSoundBufferLoaded)
+        // CREATE THE BUNNY'S MISSILE.
+        PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_MISSILES);
+        OBJECTS::WEAPONS::Missile missile = m_bunnyPlayer->FireMissile(*m_bunnyMissileSprite);
+        CONTAINERS::GenerationalHandle missileHandle = m_missiles.Add(missile);
+        bool missileAdded = m_missiles.Contains(missileHandle);
+        if (!missileAdded)
         {
-            throw std::runtime_error("Error loading missile sound.");
+            // Don't fire a missile since too many are already flying.
+            return;
         }
 
-        // CREATE THE SOUND FOR THE MISSILE.
-        std::shared_ptr<sf::Sound> missileSound = std::make_shared<sf::Sound>(*missileSoundBuffer);
+        // The player should always hear their own missiles being fired.
+        PlaySound(RESOURCES::ASSET_SOUND_MISSILE_LAUNCH, AUDIO::SOUND_PRIORITY_HIGH);
 
-        // CREATE THE BUNNY'S MISSILE.
-        std::shared_ptr<OBJECTS::WEAPONS::Missile> missile = m_bunnyPlayer->FireMissile(carrotMissileSprite, missileSound);
-        m_missiles.push_back(missile);
-
-        // RESET THE CLOCK TRACKING WHEN THE BUNNY FIRED A MISSILE.
+        // START THE TIMER FOR WHEN THE BUNNY CAN FIRE AGAIN.
         // This will allow another missile to be fired after sufficient time passes.
-        m_bunnyMissileFiringClock.restart();
+        const sf::Time TIME_DELAY_BETWEEN_BUNNY_MISSILE_FIRING = sf::milliseconds(500);
+        m_bunnyMissileReloading = true;
+        m_timers.Schedule(
+            TIME_DELAY_BETWEEN_BUNNY_MISSILE_FIRING,
+            SIMULATION::TimerEvent(TIMER_EVENT_BUNNY_MISSILE_RELOADED, CONTAINERS::GenerationalHandle()));
     }
 }
 
-void GameplayState::UpdateGameObjects(const sf::Time& elapsedTime)
-{    
-    // UPDATE ANY EXPLOSIONS.
-    // We don't automatically increment the iterator during the for loop because we may need to
-    // erase from the container during the loop for explosions that have expired.
-    for (auto explosion = m_explosions.begin(); explosion != m_explosions.end(); )
+void GameplayState::HandleExpiredTimers()
+{
+    for (const SIMULATION::TimerEvent& timerEvent : m_expiredTimerEvents)
     {
-        (*explosion)->Update(elapsedTime);
-
-        // Remove the explosion if it has exceeded its lifetime.
-        bool explosionLifetimeExceeded = (*explosion)->LifetimeExceeded();
-        if (explosionLifetimeExceeded)
+        switch (timerEvent.Type)
         {
-            explosion = m_explosions.erase(explosion);
-        }
-        else
-        {
-            ++explosion;
+        case TIMER_EVENT_BUNNY_MISSILE_RELOADED:
+            m_bunnyMissileReloading = false;
+            break;
+        case TIMER_EVENT_EXPLOSION_EXPIRED:
+            // All explosions last equally long, so the oldest explosion is always the one expiring.
+            m_explosions.pop_front();
+            break;
+        case TIMER_EVENT_ALIEN_MISSILE_FIRE:
+            FireAlienMissile(timerEvent.Target);
+            break;
         }
     }
+}
+
+void GameplayState::SavePreviousPositionsOfMovingObjects()
+{
+    m_bunnyPlayer->SavePreviousPosition();
+
+    m_aliens.SavePreviousPositions();
+
+    m_missiles.SavePreviousPositions();
+}
+
+void GameplayState::UpdateGameObjects(const sf::Time& elapsedTime)
+{
+    PROFILE_PHASE(PROFILED_PHASE_UPDATE_GAME_OBJECTS);
     
     // UPDATE THE PLAYER BUNNY.
+    // Explosions don't need updating since timers remove them once they expire.
     m_bunnyPlayer->Update(elapsedTime);
 
     // UPDATE THE EASTER EGGS.
@@ -500,342 +722,339 @@ void GameplayState::UpdateGameObjects(const sf::Time& elapsedTime)
     }
 
     // UPDATE THE ALIENS.
-    for (std::shared_ptr<OBJECTS::Alien>& alien : m_aliens)
-    {
-        alien->Update(elapsedTime);
-
-        // Check if the alien wants to fire a missile.
-        if (alien->WantsToFireMissile())
-        {
-            // Fire an alien missile.
-            std::shared_ptr<OBJECTS::WEAPONS::Missile> alienMissile = alien->FireMissile();
-            m_missiles.push_back(alienMissile);
-        }
-    }
+    // Aliens fire missiles when their timers expire rather than while being updated.
+    m_aliens.Update(elapsedTime);
 
     // UPDATE THE MISSILES.
-    for (std::shared_ptr<OBJECTS::WEAPONS::Missile>& missile : m_missiles)
-    {
-        missile->Update(elapsedTime);
-    }
+    m_missiles.Update(elapsedTime);
 }
 
 void GameplayState::HandleGameObjectCollisions()
 {
-    // INITIALIZE A RANDOM NUMBER GENERATOR FOR RANDOMLY ROTATING EXPLOSION SPRITES.
-    /// @todo Refactor this randomness logic to a more central location.
-    // The random number generator variables are static to ensure randomness over multiple calls to this function.
-    static bool randomNumberGeneratorInitialized = false;
-    static std::default_random_engine randomNumberGenerator;
-    if (!randomNumberGeneratorInitialized)
-    {
-        // Initialize the random number generator with a seed based on the current time.
-        unsigned long seed = static_cast<unsigned long>(std::chrono::system_clock::now().time_since_epoch().count());
-        randomNumberGenerator.seed(seed);
-
-        randomNumberGeneratorInitialized = true;
-    }
-    
-    // CHECK FOR COLLISIONS WITH MISSILES.
-    // We don't automatically increment the iterator during the for loop because we may need to
-    // erase from the container during the loop for missiles that collide with objects.
-    for (auto missile = m_missiles.begin(); missile != m_missiles.end();)
-    {
-        // HANDLE THE MISSILE DIFFERENTLY DEPENDING ON WHAT TYPE OF OBJECT FIRED IT.
-        bool missileCollided = false;
-        sf::FloatRect collidedObjectRectangle;
-        OBJECTS::WEAPONS::MissileSource missileSource = (*missile)->GetMissileSource();
-        switch (missileSource)
-        {
-        case OBJECTS::WEAPONS::MISSILE_SOURCE_ALIEN:
-            missileCollided = HandleAlienMissileCollisions(**missile, collidedObjectRectangle);
-            break;
-        case OBJECTS::WEAPONS::MISSILE_SOURCE_EASTER_BUNNY:
-            missileCollided = HandleBunnyMissileCollisions(**missile, collidedObjectRectangle);
-            break;
-        default:
-            // This case is never expected, but if we receive a missile of a different
-            // type, we don't have anything to do for it.
-            break;
-        }
+    PROFILE_PHASE(PROFILED_PHASE_HANDLE_GAME_OBJECT_COLLISIONS);
 
-        // CHECK IF THE MISSILE COLLIDED.
-        if (missileCollided)
-        {
-            // GENERATE AN EXPLOSION AT THE LOCATION OF THE MISSILE.
-            // Load the explosion texture.
-            const std::string EXPLOSION_TEXTURE_FILEPATH = "res/Images/explosion1.png";
-            std::shared_ptr<sf::Texture> explosionTexture = m_resourceManager.GetTexture(EXPLOSION_TEXTURE_FILEPATH);;
-            bool explosionTextureLoaded = (nullptr != explosionTexture);
-            if (!explosionTextureLoaded)
-            {
-                throw std::runtime_error("Error loading explosion texture.");
-            }
+    // ADD COLLIDABLE OBJECTS TO THE COLLISION BROADPHASE.
+    // Objects are identified by their index within their own container.  Objects destroyed
+    // during this update are only marked rather than removed until all collisions have been
+    // handled so that their indices remain valid.  Aliens are kept out of the broadphase
+    // since they are tested separately below.
+    m_collisionSystem.ClearBroadphase();
 
-            // Create the sprite for the explosion.
-            std::shared_ptr<sf::Sprite> explosionSprite = std::make_shared<sf::Sprite>(*explosionTexture);
-            // Set the origin for transformations to the center of the sprite to make rotation work properly.
-            sf::FloatRect explosionBounds = explosionSprite->getLocalBounds();
-            float explosionHalfWidth = explosionBounds.width / 2.0f;
-            float explosionCenterX = explosionBounds.left + explosionHalfWidth;
-            float explosionHalfHeight = explosionBounds.height / 2.0f;
-            float explosionCenterY = explosionBounds.top + explosionHalfHeight;
-            explosionSprite->setOrigin(explosionCenterX, explosionCenterY);
-
-            // Rotate the explosion by a random amount to add more variety.
-            /// @todo Refactor this randomness logic to a more central location.
-            const unsigned int MAX_ROTATION_IN_DEGREES = 360;
-            unsigned int randomRotationInDegrees = ( randomNumberGenerator() % MAX_ROTATION_IN_DEGREES );
-            explosionSprite->setRotation(static_cast<float>(randomRotationInDegrees));
-
-            // Position the explosion to correspond with the position of the collided object.
-            // Since we needed to set the origin of the explosion to the center (as opposed to top-left)
-            // for rotation, we need to calculate the center of the object's bounding box.
-            float collidedObjectHalfWidth = collidedObjectRectangle.width / 2.0f;
-            float collidedObjectCenterX = collidedObjectRectangle.left + collidedObjectHalfWidth;
-            float collidedObjectHalfHeight = collidedObjectRectangle.height / 2.0f;
-            float collidedObjectCenterY = collidedObjectRectangle.top + collidedObjectHalfHeight;
-            explosionSprite->setPosition(collidedObjectCenterX, collidedObjectCenterY);
-
-            // Load the explosion sound data.
-            const std::string EXPLOSION_SOUND_FILEPATH = "res/Sounds/Explosion.wav";
-            std::shared_ptr<sf::SoundBuffer> explosionSoundBuffer = m_resourceManager.GetSoundBuffer(EXPLOSION_SOUND_FILEPATH);
-            bool explosionSoundBufferLoaded = (nullptr != explosionSoundBuffer);
-            if (!explosionSoundBufferLoaded)
-            {
-                throw std::runtime_error("Error loading explosion sound.");
-            }
+    const unsigned int BUNNY_COLLISION_ID = 0;
+    m_collisionSystem.AddToBroadphase(*m_bunnyPlayer, BUNNY_COLLISION_ID);
 
-            // Create the sound for the explosion.
-            std::shared_ptr<sf::Sound> explosionSound = std::make_shared<sf::Sound>(*explosionSoundBuffer);
+    unsigned int easterEggCount = static_cast<unsigned int>(m_easterEggs.size());
+    m_easterEggsDestroyedThisUpdate.assign(easterEggCount, false);
+    for (unsigned int easterEggIndex = 0; easterEggIndex < easterEggCount; ++easterEggIndex)
+    {
+        m_collisionSystem.AddToBroadphase(*m_easterEggs[easterEggIndex], easterEggIndex);
+    }
 
-            // Create the explosion.
-            std::shared_ptr<OBJECTS::Explosion> explosion = std::make_shared<OBJECTS::Explosion>(explosionSprite, explosionSound);
-            m_explosions.push_back(explosion);
+    m_missilesExplodedThisUpdate.assign(m_missiles.GetCount(), false);
+    m_missiles.AddToBroadphase(m_collisionSystem);
+
+    m_collisionPairs.clear();
+    m_collisionSystem.FindCollisionPairs(m_collisionPairs);
+
+    // FIND COLLISIONS WITH ALIENS.
+    // Aliens are the most numerous objects and their bounding rectangles are already packed,
+    // so each other object is tested against all aliens at once using SIMD instructions.
+    // Missile collisions are found first so that aliens killed by missiles are handled
+    // before those aliens can hurt the bunny or abduct eggs during the same update.
+    m_aliensKilledThisUpdate.assign(m_aliens.GetCount(), false);
+    const PHYSICS::COLLISIONS::PackedRectangles& alienBoundingRectangles = m_aliens.GetBoundingRectangles();
+    m_missiles.FindCollisionPairs(
+        m_collisionSystem,
+        PHYSICS::COLLISIONS::COLLISION_LAYER_ALIEN,
+        alienBoundingRectangles,
+        m_collisionPairs);
+    m_collisionSystem.FindCollisionPairs(
+        *m_bunnyPlayer,
+        BUNNY_COLLISION_ID,
+        PHYSICS::COLLISIONS::COLLISION_LAYER_ALIEN,
+        alienBoundingRectangles,
+        m_collisionPairs);
+    for (unsigned int easterEggIndex = 0; easterEggIndex < easterEggCount; ++easterEggIndex)
+    {
+        m_collisionSystem.FindCollisionPairs(
+            *m_easterEggs[easterEggIndex],
+            easterEggIndex,
+            PHYSICS::COLLISIONS::COLLISION_LAYER_ALIEN,
+            alienBoundingRectangles,
+            m_collisionPairs);
+    }
 
-            // REMOVE THE MISSILE SINCE IT HAS EXPLODED.
-            missile = m_missiles.erase(missile);
-        }
-        else
+    // HANDLE EACH PAIR OF COLLIDING OBJECTS.
+    // Pairs are only generated for layers that interact, so each pair goes
+    // directly to the handler registered for its combination of layers.
+    // Pairs are handled in the order found above.
+    for (const PHYSICS::COLLISIONS::CollisionPair& collisionPair : m_collisionPairs)
+    {
+        CollisionHandler collisionHandler = COLLISION_HANDLERS[collisionPair.FirstLayer][collisionPair.SecondLayer];
+        bool collisionHandlerRegistered = (nullptr != collisionHandler);
+        if (collisionHandlerRegistered)
         {
-            // Move to the checking collisions for the next missile.
-            ++missile;
+            (this->*collisionHandler)(collisionPair);
         }
     }
 
-    // CHECK FOR COLLISIONS OF THE ALIENS WITH THE EASTER EGGS OR PLAYER.
-    for (auto alien : m_aliens)
+    // REMOVE OBJECTS DESTROYED BY COLLISIONS.
+    RemoveDestroyedObjects();
+}
+
+void GameplayState::HandleBunnyAlienCollision(const PHYSICS::COLLISIONS::CollisionPair& collisionPair)
+{
+    // CHECK IF THE ALIEN IS STILL ALIVE.
+    unsigned int alienIndex = collisionPair.SecondObjectId;
+    bool alienKilled = m_aliensKilledThisUpdate[alienIndex];
+    if (alienKilled)
     {
-        sf::FloatRect alienBounds = alien->GetBoundingRectangle();
+        return;
+    }
 
-        // CHECK IF THE ALIEN COLLIDED WITH THE EASTER BUNNY.
-        sf::FloatRect bunnyBounds = m_bunnyPlayer->GetBoundingRectangle();
-        bool alienHitBunny = alienBounds.intersects(bunnyBounds);
-        if (alienHitBunny)
-        {
-            m_bunnyPlayer->LoseLife();
-        }
+    // The player loses a life for each alien touching it.
+    m_bunnyPlayer->LoseLife();
+}
 
-        // CHECK IF THE ALIEN COLLIDED WITH ANY EASTER EGGS.
-        // We don't automatically increment the iterator during the for loop because we may need to
-        // erase from the container during the loop for eggs that have lost all health.
-        for (auto easterEgg = m_easterEggs.begin(); easterEgg != m_easterEggs.end();)
-        {
-            // Check if the alien hit an egg.
-            sf::FloatRect eggBounds = (*easterEgg)->GetBoundingRectangle();
-            bool alienHitEgg = alienBounds.intersects(eggBounds);
-            if (alienHitEgg)
-            {
-                (*easterEgg)->LoseHealth();
-
-                // Check if the alien killed the egg.
-                uint8_t eggHealth = (*easterEgg)->GetHealth();
-                bool eggAlive = (eggHealth > 0);
-                if (!eggAlive)
-                {            
-                    // Remove the egg so that it is no longer updated.
-                    easterEgg = m_easterEggs.erase(easterEgg);
-                }
-            }
-            else
-            {
-                // Move to the checking collisions for the next egg.
-                ++easterEgg;
-            }
-        }
+void GameplayState::HandleBunnyAlienMissileCollision(const PHYSICS::COLLISIONS::CollisionPair& collisionPair)
+{
+    // CHECK IF THE MISSILE HAS ALREADY EXPLODED.
+    unsigned int missileIndex = collisionPair.SecondObjectId;
+    bool missileExploded = m_missilesExplodedThisUpdate[missileIndex];
+    if (missileExploded)
+    {
+        return;
     }
+
+    // HURT THE PLAYER.
+    m_bunnyPlayer->LoseLife();
+
+    // EXPLODE THE MISSILE ON THE PLAYER.
+    const sf::FloatRect& bunnyBounds = collisionPair.FirstBoundingRectangle;
+    ExplodeMissile(missileIndex, bunnyBounds);
 }
 
-bool GameplayState::HandleAlienMissileCollisions(const OBJECTS::WEAPONS::Missile& missile,  sf::FloatRect& collidedObjectRectangle)
+void GameplayState::HandleBunnyMissileAlienCollision(const PHYSICS::COLLISIONS::CollisionPair& collisionPair)
 {
-    // VERIFY THAT THE MISSILE CAME FROM AN ALIEN.
-    bool missileFromAlien = (OBJECTS::WEAPONS::MISSILE_SOURCE_ALIEN == missile.GetMissileSource());
-    if (!missileFromAlien)
+    // CHECK IF BOTH OBJECTS ARE STILL INTACT.
+    // A missile can only kill a single alien, and an alien can only be killed once.
+    unsigned int missileIndex = collisionPair.FirstObjectId;
+    unsigned int alienIndex = collisionPair.SecondObjectId;
+    bool missileExploded = m_missilesExplodedThisUpdate[missileIndex];
+    bool alienKilled = m_aliensKilledThisUpdate[alienIndex];
+    if (missileExploded || alienKilled)
     {
-        // We don't want to check for collisions with the provided missile.
-        return false;
+        return;
     }
 
-    // CHECK IF THE MISSILE COLLIDED WITH ANY EASTER EGGS.
-    sf::FloatRect missileBounds = missile.GetBoundingRectangle();
-    // We don't automatically increment the iterator during the for loop because we may need to
-    // erase from the container during the loop for eggs that have lost all health.
-    for (auto easterEgg = m_easterEggs.begin(); easterEgg != m_easterEggs.end();)
-    {
-        // Check if the missile hit an egg.
-        sf::FloatRect eggBounds = (*easterEgg)->GetBoundingRectangle();
-        bool missileHitEgg = missileBounds.intersects(eggBounds);
-        if (missileHitEgg)
-        {
-            collidedObjectRectangle = eggBounds;
+    // KILL THE ALIEN.
+    // It is only marked so that it is removed once all collisions are handled.
+    m_aliensKilledThisUpdate[alienIndex] = true;
 
-            (*easterEgg)->LoseHealth();
+    // Add points to the player's score for killing the alien.
+    AddToScore(DEFAULT_ALIEN_KILL_POINTS);
 
-            // Check if the missile killed the egg.
-            uint8_t eggHealth = (*easterEgg)->GetHealth();
-            bool eggAlive = (eggHealth > 0);
-            if (!eggAlive)
-            {            
-                // Remove the egg so that it is no longer updated.
-                easterEgg = m_easterEggs.erase(easterEgg);
-            }
+    // EXPLODE THE MISSILE ON THE ALIEN.
+    const sf::FloatRect& alienBounds = collisionPair.SecondBoundingRectangle;
+    ExplodeMissile(missileIndex, alienBounds);
+}
 
-            return true;
-        }
-        else
-        {
-            // Move to the checking collisions for the next egg.
-            ++easterEgg;
-        }
+void GameplayState::HandleAlienEasterEggCollision(const PHYSICS::COLLISIONS::CollisionPair& collisionPair)
+{
+    // CHECK IF BOTH OBJECTS ARE STILL INTACT.
+    unsigned int alienIndex = collisionPair.FirstObjectId;
+    unsigned int easterEggIndex = collisionPair.SecondObjectId;
+    bool alienKilled = m_aliensKilledThisUpdate[alienIndex];
+    bool easterEggDestroyed = m_easterEggsDestroyedThisUpdate[easterEggIndex];
+    if (alienKilled || easterEggDestroyed)
+    {
+        return;
     }
 
-    // CHECK IF THE MISSILE COLLIDED WITH THE EASTER BUNNY.
-    sf::FloatRect bunnyBounds = m_bunnyPlayer->GetBoundingRectangle();
-    bool missileHitBunny = missileBounds.intersects(bunnyBounds);
-    if (missileHitBunny)
+    // An alien reaching an egg abducts it, regardless of its remaining health.
+    m_easterEggsDestroyedThisUpdate[easterEggIndex] = true;
+}
+
+void GameplayState::HandleAlienMissileEasterEggCollision(const PHYSICS::COLLISIONS::CollisionPair& collisionPair)
+{
+    // CHECK IF BOTH OBJECTS ARE STILL INTACT.
+    unsigned int missileIndex = collisionPair.FirstObjectId;
+    unsigned int easterEggIndex = collisionPair.SecondObjectId;
+    bool missileExploded = m_missilesExplodedThisUpdate[missileIndex];
+    bool easterEggDestroyed = m_easterEggsDestroyedThisUpdate[easterEggIndex];
+    if (missileExploded || easterEggDestroyed)
     {
-        collidedObjectRectangle = bunnyBounds;
+        return;
+    }
 
-        m_bunnyPlayer->LoseLife();
+    // DAMAGE THE EGG.
+    std::shared_ptr<OBJECTS::EasterEgg>& easterEgg = m_easterEggs[easterEggIndex];
+    easterEgg->LoseHealth();
+
+    // Check if the missile killed the egg.
+    uint8_t eggHealth = easterEgg->GetHealth();
+    bool eggAlive = (eggHealth > 0);
+    if (!eggAlive)
+    {
+        // Mark the egg so that it is removed once all collisions are handled.
+        m_easterEggsDestroyedThisUpdate[easterEggIndex] = true;
     }
 
-    return missileHitBunny;
+    // EXPLODE THE MISSILE ON THE EGG.
+    const sf::FloatRect& eggBounds = collisionPair.SecondBoundingRectangle;
+    ExplodeMissile(missileIndex, eggBounds);
 }
 
-bool GameplayState::HandleBunnyMissileCollisions(const OBJECTS::WEAPONS::Missile& missile, sf::FloatRect& collidedObjectRectangle)
+void GameplayState::ExplodeMissile(const unsigned int missileIndex, const sf::FloatRect& collidedObjectRectangle)
 {
-    // VERIFY THAT THE MISSILE CAME FROM A BUNNY.
-    bool missileFromBunny = (OBJECTS::WEAPONS::MISSILE_SOURCE_EASTER_BUNNY == missile.GetMissileSource());
-    if (!missileFromBunny)
-    {
-        // We don't want to check for collisions with the provided missile.
-        return false;
-    }
+    PROFILE_ALLOCATIONS(ALLOCATION_CATEGORY_EXPLOSIONS);
 
-    // CHECK IF THE MISSILE COLLIDED WITH ANY ALIENS.
-    sf::FloatRect missileBounds = missile.GetBoundingRectangle();
-    // We don't automatically increment the iterator during the for loop because we may need to
-    // erase from the container during the loop for aliens that were hit.
-    for (auto alien = m_aliens.begin(); alien != m_aliens.end();)
+    // MARK THE MISSILE AS EXPLODED.
+    // It is only marked so that it is removed once all collisions are handled.
+    m_missilesExplodedThisUpdate[missileIndex] = true;
+
+    // GENERATE EXPLOSIONS AT THE LOCATION OF THE COLLIDED OBJECT.
+    // Normally only a single explosion is generated, but more may be requested for stress testing.
+    for (unsigned int explosionIndex = 0; explosionIndex < m_settings.ExplosionsPerMissileHit; ++explosionIndex)
     {
-        // Check if the missile hit the current alien.
-        sf::FloatRect alienBounds = (*alien)->GetBoundingRectangle();
-        bool missileHitAlien = missileBounds.intersects(alienBounds);
-        if (missileHitAlien)
-        {            
-            // Get the bounding rectangle of the collided alien.
-            collidedObjectRectangle = alienBounds;
-            
-            // Remove the alien itself so that it is no longer updated.
-            alien = m_aliens.erase(alien);
+        // Create the sprite for the explosion.
+        std::shared_ptr<sf::Sprite> explosionSprite = CreateSprite(RESOURCES::ASSET_IMAGE_EXPLOSION);
+        // Set the origin for transformations to the center of the sprite to make rotation work properly.
+        sf::FloatRect explosionBounds = explosionSprite->getLocalBounds();
+        float explosionHalfWidth = explosionBounds.width / 2.0f;
+        float explosionCenterX = explosionBounds.left + explosionHalfWidth;
+        float explosionHalfHeight = explosionBounds.height / 2.0f;
+        float explosionCenterY = explosionBounds.top + explosionHalfHeight;
+        explosionSprite->setOrigin(explosionCenterX, explosionCenterY);
+
+        // Rotate the explosion by a random amount to add more variety.
+        const unsigned int MAX_ROTATION_IN_DEGREES = 360;
+        unsigned int randomRotationInDegrees = m_randomNumberGenerator.GenerateNumberLessThan(MAX_ROTATION_IN_DEGREES);
+        explosionSprite->setRotation(static_cast<float>(randomRotationInDegrees));
+
+        // Position the explosion to correspond with the position of the collided object.
+        // Since we needed to set the origin of the explosion to the center (as opposed to top-left)
+        // for rotation, we need to calculate the center of the object's bounding box.
+        float collidedObjectHalfWidth = collidedObjectRectangle.width / 2.0f;
+        float collidedObjectCenterX = collidedObjectRectangle.left + collidedObjectHalfWidth;
+        float collidedObjectHalfHeight = collidedObjectRectangle.height / 2.0f;
+        float collidedObjectCenterY = collidedObjectRectangle.top + collidedObjectHalfHeight;
+        explosionSprite->setPosition(collidedObjectCenterX, collidedObjectCenterY);
+
+        // Create the explosion.
+        std::shared_ptr<OBJECTS::Explosion> explosion = std::make_shared<OBJECTS::Explosion>(explosionSprite);
+        m_explosions.push_back(explosion);
+
+        // Remove the explosion once its lifetime is over.
+        m_timers.Schedule(
+            sf::seconds(OBJECTS::Explosion::MAX_LIFETIME_IN_SECONDS),
+            SIMULATION::TimerEvent(TIMER_EVENT_EXPLOSION_EXPIRED, CONTAINERS::GenerationalHandle()));
+    }
 
-            // Add points to the player's score for killing the alien.
-            AddToScore(DEFAULT_ALIEN_KILL_POINTS);
+    // Play the sound for the explosion.
+    PlaySound(RESOURCES::ASSET_SOUND_EXPLOSION, AUDIO::SOUND_PRIORITY_NORMAL);
+}
 
-            return true;
+void GameplayState::RemoveDestroyedObjects()
+{
+    // Objects are removed from the highest index down.  For swap-removing containers,
+    // this ensures that the object moved into each removed object's index is one that
+    // survived.  For order-preserving containers, it ensures that indices of objects
+    // still to be removed aren't shifted.
+
+    // REMOVE EXPLODED MISSILES.
+    for (unsigned int remainingMissileCount = static_cast<unsigned int>(m_missilesExplodedThisUpdate.size());
+        remainingMissileCount > 0;
+        --remainingMissileCount)
+    {
+        unsigned int missileIndex = remainingMissileCount - 1;
+        bool missileExploded = m_missilesExplodedThisUpdate[missileIndex];
+        if (missileExploded)
+        {
+            m_missiles.RemoveAt(missileIndex);
         }
-        else
+    }
+
+    // REMOVE KILLED ALIENS.
+    for (unsigned int remainingAlienCount = static_cast<unsigned int>(m_aliensKilledThisUpdate.size());
+        remainingAlienCount > 0;
+        --remainingAlienCount)
+    {
+        unsigned int alienIndex = remainingAlienCount - 1;
+        bool alienKilled = m_aliensKilledThisUpdate[alienIndex];
+        if (alienKilled)
         {
-            // Move to the checking collisions for the next alien.
-            ++alien;
+            m_aliens.RemoveAt(alienIndex);
         }
     }
 
-    // NO COLLISIONS OCCURRED.
-    return false;
+    // REMOVE DESTROYED EASTER EGGS.
+    for (unsigned int remainingEasterEggCount = static_cast<unsigned int>(m_easterEggsDestroyedThisUpdate.size());
+        remainingEasterEggCount > 0;
+        --remainingEasterEggCount)
+    {
+        unsigned int easterEggIndex = remainingEasterEggCount - 1;
+        bool easterEggDestroyed = m_easterEggsDestroyedThisUpdate[easterEggIndex];
+        if (easterEggDestroyed)
+        {
+            m_easterEggs.erase(m_easterEggs.begin() + easterEggIndex);
+        }
+    }
 }
 
 void GameplayState::HandleScreenBoundaryCollisions(const sf::FloatRect& screenBoundsInPixels)
 {
+    PROFILE_PHASE(PROFILED_PHASE_HANDLE_SCREEN_BOUNDARY_COLLISIONS);
+
     // HANDLE COLLISIONS FOR THE BUNNY.
     // The return value is intentionally ignored since we don't need to perform
     // any additional response if the bunny hit the screen boundaries.
     m_collisionSystem.HandleBoundaryCollisions(screenBoundsInPixels, *m_bunnyPlayer);
 
     // HANDLE COLLISIONS FOR THE ALIENS.
-    for (auto alien = m_aliens.begin(); alien != m_aliens.end(); ++alien)
-    {
-        // The return value is intentionally ignored since we don't need to perform
-        // any additional response if the bunny hit the screen boundaries.
-        m_collisionSystem.HandleBoundaryCollisions(screenBoundsInPixels, **alien);
-    }
+    m_aliens.HandleBoundaryCollisions(m_collisionSystem, screenBoundsInPixels);
 
     // HANDLE COLLISIONS FOR THE MISSILES.
-    // We don't automatically increment the iterator during the for loop because we may need to
-    // erase from the container during the loop for missiles that hit the screen boundaries.
-    for (auto missile = m_missiles.begin(); missile != m_missiles.end();)
-    {
-        bool missileHitScreenBoundary = m_collisionSystem.HandleBoundaryCollisions(screenBoundsInPixels, **missile);
-
-        // Check if the missile went off screen.
-        if (missileHitScreenBoundary)
-        {            
-            // Remove the missile itself so that it is no longer updated.
-            missile = m_missiles.erase(missile);
-        }
-        else
-        {
-            // Move to the checking collisions for the next missile.
-            ++missile;
-        }
-    }
+    // Missiles that go off screen are removed.
+    m_missiles.RemoveBoundaryCollisions(m_collisionSystem, screenBoundsInPixels);
 
     // No other game objects (easter eggs, etc.) need to have collisions with the screen
     // boundaries handled since they don't move.
 }
 
-void GameplayState::RenderGameObjects(sf::RenderTarget& renderTarget)
+void GameplayState::RenderGameObjects(sf::RenderTarget& renderTarget, const float interpolationRatio)
 {
+    PROFILE_PHASE(PROFILED_PHASE_RENDER_GAME_OBJECTS);
+
     // Note that the rendering order here is intentionally chosen for
     // what hopefully makes the most sense in terms of layering objects
-    // on top of one another.
+    // on top of one another.  All sprites share the texture atlas, so
+    // they are collected into a single batch, which preserves this order.
+    m_spriteBatch.Clear();
 
     // RENDER THE EASTER EGGS.
-    for (std::shared_ptr<OBJECTS::EasterEgg> easterEgg : m_easterEggs)
+    for (const std::shared_ptr<OBJECTS::EasterEgg>& easterEgg : m_easterEggs)
     {
-        easterEgg->Render(renderTarget);
+        easterEgg->Render(m_spriteBatch, interpolationRatio);
     }
 
     // RENDER THE ALIENS.
-    for (std::shared_ptr<OBJECTS::Alien> alien : m_aliens)
-    {
-        alien->Render(renderTarget);
-    }
+    m_aliens.Render(m_spriteBatch, interpolationRatio);
 
     // RENDER THE BUNNY PLAYER.
-    m_bunnyPlayer->Render(renderTarget);
+    m_bunnyPlayer->Render(m_spriteBatch, interpolationRatio);
 
     // RENDER THE MISSILES.
-    for (std::shared_ptr<OBJECTS::WEAPONS::Missile> missile : m_missiles)
-    {
-        missile->Render(renderTarget);
-    }
+    m_missiles.Render(m_spriteBatch, interpolationRatio);
 
     // RENDER THE EXPLOSIONS.
-    for (std::shared_ptr<OBJECTS::Explosion> explosion : m_explosions)
+    for (const std::shared_ptr<OBJECTS::Explosion>& explosion : m_explosions)
     {
-        explosion->Render(renderTarget);
+        explosion->Render(m_spriteBatch, interpolationRatio);
     }
+
+    // DRAW ALL GAME OBJECTS AT ONCE.
+    m_spriteBatch.Render(renderTarget, m_textureAtlas.GetTexture());
 }
 
 void GameplayState::AddToScore(const uint16_t pointsToAdd)
@@ -849,7 +1068,10 @@ void GameplayState::AddToScore(const uint16_t pointsToAdd)
     if (!maxHighScoreReached)
     {
         m_currentScore += pointsToAdd;
-        m_gameplayHud->SetScore(m_currentScore);
+        if (m_gameplayHud)
+        {
+            m_gameplayHud->SetScore(m_currentScore);
+        }
     }
 
     // Update the high score, if needed.
@@ -857,7 +1079,10 @@ void GameplayState::AddToScore(const uint16_t pointsToAdd)
     if (newHighestScoreReached)
     {
         m_highScore = m_currentScore;
-        m_gameplayHud->SetHighScore(m_highScore);
+        if (m_gameplayHud)
+        {
+            m_gameplayHud->SetHighScore(m_highScore);
+        }
     }
 }
 
@@ -869,13 +1094,16 @@ void GameplayState::UpdateSubState()
     // score due to difficulty increases in the game, but this check is provided
     // just in case to prevent annoying the player with a wrap-around score.
     bool maxHighScoreReached = (m_currentScore >= MAX_HIGH_SCORE);
-    bool allAliensKilled = (m_aliens.size() <= 0);
+    bool allAliensKilled = m_aliens.IsEmpty();
     bool playerWon = (maxHighScoreReached || allAliensKilled);
     if (playerWon)
     {
         m_currentSubState = VICTORY_SUBSTATE;
 
-        m_gameplayHud->ShowPlayerWonText();
+        if (m_gameplayHud)
+        {
+            m_gameplayHud->ShowPlayerWonText();
+        }
     }
 
     // CHECK IF THE PLAYER HAS LOST.
@@ -888,12 +1116,17 @@ void GameplayState::UpdateSubState()
         // lost all lives or eggs, we still want to consider that a game over.
         m_currentSubState = GAME_OVER_SUBSTATE;
 
-        m_gameplayHud->ShowPlayerLostText();
+        if (m_gameplayHud)
+        {
+            m_gameplayHud->ShowPlayerLostText();
+        }
     }
 }
 
 void GameplayState::SaveHighScores()
 {
+    PROFILE_MARKER("SaveHighScores");
+
     /// @todo   Rethink refactoring the HighScores class to support
     ///         these kinds of operations.  We may also be able
     ///         to consider using the heap operations provided in
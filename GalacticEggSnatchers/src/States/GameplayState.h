@@ -1,14 +1,22 @@
 #pragma once
 
+#include <array>
 #include <list>
 #include <memory>
 #include <vector>
+#include "Audio/SoundPlayer.h"
 #include "Graphics/Gui/GameplayHud.h"
+#include "Graphics/SpriteBatch.h"
+#include "Graphics/TextureAtlas.h"
 #include "Input/IInputController.h"
 #include "Objects/AllObjects.h"
 #include "Physics/Collisions/CollisionSystem.h"
+#include "Resources/AssetFilepaths.h"
 #include "Resources/ResourceManager.h"
 #include "SaveData/HighScores.h"
+#include "Simulation/RandomNumberGenerator.h"
+#include "Simulation/SimulationClock.h"
+#include "Simulation/TimerWheel.h"
 #include "States/IGameState.h"
 
 namespace STATES
@@ -27,15 +35,61 @@ namespace STATES
         /// @brief  The default maximum time between missile fires.
         static const unsigned int DEFAULT_MAX_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS = MAX_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS;
         
-        unsigned int MinTimeBetweenMissileFiresInSeconds;   ///< Minimum time to potentially wait between firing missiles.
-        unsigned int MaxTimeBetweenMissileFiresInSeconds;   ///< Maximum time to potentially wait between firing missiles.
+        float MinTimeBetweenMissileFiresInSeconds;   ///< Minimum time to potentially wait between firing missiles.
+        float MaxTimeBetweenMissileFiresInSeconds;   ///< Maximum time to potentially wait between firing missiles.
         float HorizontalMoveSpeedInPixelsPerSecond;  ///< The horizontal movement speed of the aliens.
 
         /// @brief  Constructor.
         AlienDifficultyParameters() :
-            MinTimeBetweenMissileFiresInSeconds(DEFAULT_MIN_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS),
-            MaxTimeBetweenMissileFiresInSeconds(DEFAULT_MAX_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS),
-            HorizontalMoveSpeedInPixelsPerSecond(OBJECTS::Alien::DEFAULT_MOVE_SPEED_IN_PIXELS_PER_SECOND)
+            MinTimeBetweenMissileFiresInSeconds(static_cast<float>(DEFAULT_MIN_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS)),
+            MaxTimeBetweenMissileFiresInSeconds(static_cast<float>(DEFAULT_MAX_TIME_BETWEEN_MISSILE_FIRES_IN_SECONDS)),
+            HorizontalMoveSpeedInPixelsPerSecond(OBJECTS::AlienStore::DEFAULT_MOVE_SPEED_IN_PIXELS_PER_SECOND)
+        {}
+    };
+
+    ////////////////////////////////////////////////////////
+    /// @brief  Settings controlling how the gameplay state runs.
+    ////////////////////////////////////////////////////////
+    struct GameplaySettings
+    {
+        /// @brief  The default number of rows in each formation of aliens.
+        static const unsigned int DEFAULT_ALIEN_ROW_COUNT = 5;
+        /// @brief  The default number of columns in each formation of aliens.
+        static const unsigned int DEFAULT_ALIEN_COLUMN_COUNT = 6;
+        /// @brief  The default number of explosions created when a missile hits something.
+        static const unsigned int DEFAULT_EXPLOSIONS_PER_MISSILE_HIT = 1;
+
+        /// @brief  True if gameplay should run without any graphics or audio devices.
+        ///         Textures, sounds, and the HUD are not created in headless mode, allowing
+        ///         the simulation to be driven on machines without a display or sound card.
+        bool HeadlessMode;
+
+        /// @brief  The seed for all randomness during gameplay.  Gameplay with the same seed
+        ///         and the same input plays out identically, allowing runs to be reproduced.
+        uint64_t RandomSeed;
+
+        /// @brief  The number of rows in each formation of aliens.  Formations with more rows
+        ///         than normal are compressed into the normal formation area.
+        unsigned int AlienRowCount;
+        /// @brief  The number of columns in each formation of aliens.
+        unsigned int AlienColumnCount;
+        /// @brief  The difficulty of the first formation of aliens.
+        AlienDifficultyParameters InitialAlienParameters;
+        /// @brief  The maximum number of missiles that may be flying at once.
+        unsigned int MissileCapacity;
+        /// @brief  The number of explosions created when a missile hits something.
+        unsigned int ExplosionsPerMissileHit;
+
+        /// @brief  Constructor.  Initializes settings for normal gameplay with a seed that
+        ///         differs each time the settings are created.
+        GameplaySettings() :
+            HeadlessMode(false),
+            RandomSeed(SIMULATION::RandomNumberGenerator::CreateTimeBasedSeed()),
+            AlienRowCount(DEFAULT_ALIEN_ROW_COUNT),
+            AlienColumnCount(DEFAULT_ALIEN_COLUMN_COUNT),
+            InitialAlienParameters(),
+            MissileCapacity(OBJECTS::WEAPONS::MissilePool::DEFAULT_CAPACITY),
+            ExplosionsPerMissileHit(DEFAULT_EXPLOSIONS_PER_MISSILE_HIT)
         {}
     };
 
@@ -50,6 +104,17 @@ namespace STATES
         GAME_OVER_SUBSTATE = 3  ///< The player just lost the main game.
     };
 
+    ////////////////////////////////////////////////////////
+    /// @brief  Defines the different events that gameplay
+    ///         schedules timers for.
+    ////////////////////////////////////////////////////////
+    enum GameplayTimerEventType
+    {
+        TIMER_EVENT_BUNNY_MISSILE_RELOADED, ///< The bunny may fire another missile.  Has no target.
+        TIMER_EVENT_EXPLOSION_EXPIRED,  ///< The oldest explosion has exceeded its lifetime.  Has no target.
+        TIMER_EVENT_ALIEN_MISSILE_FIRE  ///< An alien wants to fire a missile.  Targets the alien.
+    };
+
     ////////////////////////////////////////////////////////
     /// @brief  The main gameplay state of the Galactic Egg Snatchers game.
     ///         This state has the player (an Easter bunny) defending
@@ -63,7 +128,14 @@ namespace STATES
         
         /// @brief      Constructor.
         /// @param[in]  screenBoundsInPixels - The boundaries of the screen for which to confine game objects.
-        explicit GameplayState(const sf::FloatRect& screenBoundsInPixels);
+        /// @param[in]  settings - Settings controlling how the gameplay runs.
+        /// @param[in]  playerController - The controller supplying input for the player.
+        /// @param[in]  resourceManager - The resource manager shared by all states.
+        explicit GameplayState(
+            const sf::FloatRect& screenBoundsInPixels,
+            const GameplaySettings& settings,
+            const std::shared_ptr<INPUT::IInputController>& playerController,
+            const std::shared_ptr<RESOURCES::ResourceManager>& resourceManager);
 
         /// @brief  Destructor.
         virtual ~GameplayState();
@@ -77,26 +149,90 @@ namespace STATES
         /// @copydoc    IGameState::Update(const sf::Time& elapsedTime)
         virtual void Update(const sf::Time& elapsedTime);
 
-        /// @copydoc    IGameState::Render(sf::RenderTarget& renderTarget)
-        virtual void Render(sf::RenderTarget& renderTarget);
+        /// @copydoc    IGameState::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
+        virtual void Render(sf::RenderTarget& renderTarget, const float interpolationRatio);
 
         /// @copydoc    IGameState::HandleKeyPress(const sf::Keyboard::Key key)
         virtual void HandleKeyPress(const sf::Keyboard::Key key);
 
+        /// @brief  Checks if the main gameplay has ended, either from the player winning or losing.
+        /// @return True if the main gameplay has ended; false if it is still occurring.
+        bool GameplayEnded() const;
+
+        /// @brief  Gets the number of game objects currently in play, including the bunny,
+        ///         Easter eggs, aliens, missiles, and explosions.
+        /// @return The number of game objects.
+        unsigned int GetGameObjectCount() const;
+
     private:
         GameplayState(const GameplayState& stateToCopy);    ///< Private to disallow copying.
         GameplayState& operator= (const GameplayState& rhsState);    ///< Private to disallow assignment.
 
+        /// @brief  A method for handling a collision between objects in a specific pair of layers.
+        typedef void (GameplayState::*CollisionHandler)(const PHYSICS::COLLISIONS::CollisionPair& collisionPair);
+
+        /// @brief  The handler for each combination of collision layers, indexed by the
+        ///         lower layer and then the higher layer.  Null for layers that don't interact.
+        static const CollisionHandler COLLISION_HANDLERS[PHYSICS::COLLISIONS::COLLISION_LAYER_COUNT][PHYSICS::COLLISIONS::COLLISION_LAYER_COUNT];
+
+        /// @brief  Gets the asset IDs of all images used by gameplay sprites, which are packed
+        ///         into the texture atlas.
+        /// @return The asset IDs of all gameplay images.
+        static std::vector<RESOURCES::AssetId> GetGameplayImageIds();
+
+        /// @brief  Gets the asset IDs of all sounds played during gameplay.
+        /// @return The asset IDs of all gameplay sounds.
+        static std::vector<RESOURCES::AssetId> GetGameplaySoundIds();
+
+        /// @brief      Creates a sprite for the specified texture, using the area of the texture
+        ///             atlas containing the texture's image.  In headless mode, the sprite
+        ///             is only given the dimensions of the texture's image since no graphics
+        ///             device exists for creating a texture.
+        ///             An exception is thrown if the texture's image is not in the atlas.
+        /// @param[in]  textureId - The asset ID of the texture for the sprite.
+        /// @return     The newly created sprite.
+        std::shared_ptr<sf::Sprite> CreateSprite(const RESOURCES::AssetId textureId);
+
+        /// @brief  Loads the buffers for all gameplay sounds so that they can later be
+        ///         retrieved by asset ID.  An exception is thrown if any sound buffer
+        ///         cannot be loaded.  Nothing is loaded in headless mode since no
+        ///         audio device exists.
+        void LoadSoundBuffers();
+
+        /// @brief      Gets the specified sound buffer, which was loaded along with all other
+        ///             gameplay sounds.
+        /// @param[in]  soundId - The asset ID of the sound.
+        /// @return     The sound buffer; null in headless mode since no audio device exists.
+        const std::shared_ptr<sf::SoundBuffer>& GetSoundBuffer(const RESOURCES::AssetId soundId) const;
+
+        /// @brief      Requests that a sound be played during this update, if sounds can be played.
+        /// @param[in]  soundId - The asset ID of the sound.
+        /// @param[in]  priority - How important it is for the sound to be heard.
+        void PlaySound(const RESOURCES::AssetId soundId, const AUDIO::SoundPriority priority);
+
         /// @brief  Creates the initial Easter bunny for the player.
         /// @return The player Easter bunny in its initial state for a new gameplay session.
         std::shared_ptr<OBJECTS::EasterBunny> CreateInitialBunnyPlayer();
         /// @brief  Creates the initial Easter eggs.
         /// @return The Easter eggs in their initial state for a new gameplay session.
         std::vector< std::shared_ptr<OBJECTS::EasterEgg> > CreateInitialEasterEggs();
-        /// @brief      Creates the initial enemy aliens.
+        /// @brief  Loads the resources shared by all missiles so that firing
+        ///         a missile doesn't need to load or allocate anything.
+        void InitializeMissileResources();
+
+        /// @brief      Adds a grid of enemy aliens in their initial positions.
+        ///             The size of the grid comes from the gameplay settings.
         /// @param[in]  alienParameters - Parameters defining how difficult the aliens should be.
-        /// @return     The aliens in their initial state for a new gameplay session.
-        std::list< std::shared_ptr<OBJECTS::Alien> > CreateInitialAliens(const AlienDifficultyParameters& alienParameters);
+        void AddAlienGrid(const AlienDifficultyParameters& alienParameters);
+
+        /// @brief      Schedules when an alien will next fire a missile.
+        /// @param[in]  alienHandle - The handle of the alien.  Must refer to an existing alien.
+        void ScheduleAlienMissileFire(const CONTAINERS::GenerationalHandle& alienHandle);
+
+        /// @brief      Fires a missile from an alien and schedules its next missile.
+        ///             Does nothing if the alien no longer exists.
+        /// @param[in]  alienHandle - The handle of the alien firing the missile.
+        void FireAlienMissile(const CONTAINERS::GenerationalHandle& alienHandle);
 
         /// @brief  Spawns a new wave of aliens with increasing difficulty.
         void SpawnAlienWave();
@@ -112,24 +248,47 @@ namespace STATES
         /// @param[in]  elapsedTime - The elapsed time since the last frame of updating.
         void HandleInput(const INPUT::IInputController& playerController, const sf::Time& elapsedTime);
 
+        /// @brief  Handles the events of all timers that expired during the current update.
+        void HandleExpiredTimers();
+
+        /// @brief  Saves the current positions of all moving game objects before they are updated,
+        ///         allowing rendering to interpolate between simulation updates.
+        void SavePreviousPositionsOfMovingObjects();
+
         /// @brief      Updates all of the game objects in this state for a single update frame.
         /// @param[in]  elapsedTime - The elapsed time since the last frame of updating.
         void UpdateGameObjects(const sf::Time& elapsedTime);
 
         /// @brief  Handles collisions between game objects.
         void HandleGameObjectCollisions();
-        
-        /// @brief          Handles collisions of the provided alien-sourced missile with any non-alien game objects.
-        /// @param[in]      missile - The missile, assumed to have been fired by an alien, for which to handle collisions.
-        /// @param[in,out]  collidedObjectRectangle - The bounding rectangle of the collided object, if any.
-        /// @return         True if the missile collided with anything; false otherwise.
-        bool HandleAlienMissileCollisions(const OBJECTS::WEAPONS::Missile& missile, sf::FloatRect& collidedObjectRectangle);
-
-        /// @brief          Handles collisions of the provided bunny-sourced missile with any alien game objects.
-        /// @param[in]      missile - The missile, assumed to have been fired by the bunny, for which to handle collisions.
-        /// @param[in,out]  collidedObjectRectangle - The bounding rectangle of the collided object, if any.
-        /// @return         True if the missile collided with anything; false otherwise.
-        bool HandleBunnyMissileCollisions(const OBJECTS::WEAPONS::Missile& missile, sf::FloatRect& collidedObjectRectangle);
+
+        /// @brief      Handles an alien touching the bunny.
+        /// @param[in]  collisionPair - The bunny (first) and alien (second) that collided.
+        void HandleBunnyAlienCollision(const PHYSICS::COLLISIONS::CollisionPair& collisionPair);
+
+        /// @brief      Handles an alien missile hitting the bunny.
+        /// @param[in]  collisionPair - The bunny (first) and alien missile (second) that collided.
+        void HandleBunnyAlienMissileCollision(const PHYSICS::COLLISIONS::CollisionPair& collisionPair);
+
+        /// @brief      Handles a bunny missile hitting an alien.
+        /// @param[in]  collisionPair - The bunny missile (first) and alien (second) that collided.
+        void HandleBunnyMissileAlienCollision(const PHYSICS::COLLISIONS::CollisionPair& collisionPair);
+
+        /// @brief      Handles an alien touching an Easter egg.
+        /// @param[in]  collisionPair - The alien (first) and Easter egg (second) that collided.
+        void HandleAlienEasterEggCollision(const PHYSICS::COLLISIONS::CollisionPair& collisionPair);
+
+        /// @brief      Handles an alien missile hitting an Easter egg.
+        /// @param[in]  collisionPair - The alien missile (first) and Easter egg (second) that collided.
+        void HandleAlienMissileEasterEggCollision(const PHYSICS::COLLISIONS::CollisionPair& collisionPair);
+
+        /// @brief      Explodes a missile that collided with an object, marking it for removal.
+        /// @param[in]  missileIndex - The index of the missile that exploded.
+        /// @param[in]  collidedObjectRectangle - The bounding rectangle of the object the missile hit.
+        void ExplodeMissile(const unsigned int missileIndex, const sf::FloatRect& collidedObjectRectangle);
+
+        /// @brief  Removes all objects marked as destroyed while handling collisions.
+        void RemoveDestroyedObjects();
 
         /// @brief      Handles screen boundary collisions for game objects in this state.
         /// @param[in]  screenBoundsInPixels - The boundaries of the screen for which to confine game objects.
@@ -137,7 +296,9 @@ namespace STATES
 
         /// @brief          Renders all renderable game objects on the provided render target.
         /// @param[in,out]  renderTarget - The render target to render to.
-        void RenderGameObjects(sf::RenderTarget& renderTarget);
+        /// @param[in]      interpolationRatio - How far (from 0 to 1) the rendered frame lies between
+        ///                 the previous and current simulation updates.
+        void RenderGameObjects(sf::RenderTarget& renderTarget, const float interpolationRatio);
 
         /// @brief      Adds points to the score.
         /// @param[in]  pointsToAdd - The number of points to add to the current score.
@@ -149,19 +310,41 @@ namespace STATES
         /// @brief  Saves the high scores to a data file.
         void SaveHighScores();
 
+        // SETTINGS MEMBER VARIABLES.
+        GameplaySettings m_settings;    ///< Settings controlling how the gameplay runs.
+
         // RESOURCE MEMBER VARIABLES.
-        RESOURCES::ResourceManager m_resourceManager;  ///< The system that handles resources.
+        std::shared_ptr<RESOURCES::ResourceManager> m_resourceManager;  ///< The system that handles resources.
+        std::array<std::shared_ptr<sf::SoundBuffer>, RESOURCES::ASSET_ID_COUNT> m_soundBuffers; ///< The buffers for gameplay sounds, by asset ID.  Null in headless mode.
+
+        // AUDIO MEMBER VARIABLES.
+        AUDIO::SoundPlayer m_soundPlayer;   ///< Plays all gameplay sounds.  Has no voices in headless mode.
 
         // GRAPHICS MEMEBR VARIABLES.
-        std::shared_ptr<GRAPHICS::GUI::GameplayHud> m_gameplayHud;   ///< The HUD for the gameplay state.
+        GRAPHICS::TextureAtlas m_textureAtlas;  ///< The atlas containing the images for all gameplay sprites.
+        GRAPHICS::SpriteBatch m_spriteBatch;    ///< The batch for drawing all game objects at once.
+        std::shared_ptr<sf::Font> m_hudFont;    ///< The font for text in the HUD.  Held so that it remains loaded while used by the HUD.  Null in headless mode.
+        std::shared_ptr<GRAPHICS::GUI::GameplayHud> m_gameplayHud;   ///< The HUD for the gameplay state.  Null in headless mode.
         
+        // RANDOMNESS MEMBER VARIABLES.
+        SIMULATION::RandomNumberGenerator m_randomNumberGenerator;  ///< The source of all randomness during gameplay, seeded from the settings.
+
+        // TIMING MEMBER VARIABLES.
+        SIMULATION::SimulationClock m_simulationClock;  ///< The simulation time of this gameplay session.  Only advances while gameplay is occurring.
+        SIMULATION::TimerWheel m_timers;    ///< Timers for missile firing, explosion lifetimes, and other delayed gameplay events.
+        std::vector<SIMULATION::TimerEvent> m_expiredTimerEvents;   ///< The events of timers that expired during the current update.
+
         // COLLISION MEMBER VARIABLES.
         sf::FloatRect m_screenBoundsInPixels;   ///< The boundaries of the screen for which to confine game objects.
         PHYSICS::COLLISIONS::CollisionSystem m_collisionSystem; ///< The system that handles collisions.
+        std::vector<PHYSICS::COLLISIONS::CollisionPair> m_collisionPairs;   ///< The pairs of objects colliding during the current update.
+        std::vector<bool> m_missilesExplodedThisUpdate; ///< Whether each missile (by index) has exploded during the current update.
+        std::vector<bool> m_aliensKilledThisUpdate; ///< Whether each alien (by index) has been killed during the current update.
+        std::vector<bool> m_easterEggsDestroyedThisUpdate;  ///< Whether each Easter egg (by index) has been destroyed during the current update.
 
         // INPUT MEMBER VARIABLES.
         std::shared_ptr<INPUT::IInputController> m_playerController;    ///< The controller supplying input for the player.
-        sf::Clock m_bunnyMissileFiringClock;    ///< A clock for tracking how much time passes between the bunny firing a missile.
+        bool m_bunnyMissileReloading;   ///< Whether the bunny is waiting for a timer to allow it to fire another missile.
 
         // GAMEPLAY STATISTICS AND MANAGEMENT.
         GameplaySubState m_currentSubState; ///< The sub-state identifying where the player is related to the main gameplay.
@@ -174,8 +357,10 @@ namespace STATES
         // GAME OBJECT MEMBER VARIABLES.
         std::shared_ptr<OBJECTS::EasterBunny> m_bunnyPlayer;    ///< The Easter bunny controlled by the player.
         std::vector< std::shared_ptr<OBJECTS::EasterEgg> > m_easterEggs;    ///< The Easter eggs to be protected by the player.
-        std::list< std::shared_ptr<OBJECTS::Alien> > m_aliens;  ///< The enemy aliens attempting to abduct Easter eggs.
-        std::list< std::shared_ptr<OBJECTS::WEAPONS::Missile> > m_missiles;  ///< The missiles fired by the player or enemies.
-        std::list< std::shared_ptr<OBJECTS::Explosion> > m_explosions;    ///< Explosions created from missile collisions.
+        OBJECTS::AlienStore m_aliens;   ///< The enemy aliens attempting to abduct Easter eggs.
+        OBJECTS::WEAPONS::MissilePool m_missiles;   ///< The missiles fired by the player or enemies.
+        std::shared_ptr<sf::Sprite> m_bunnyMissileSprite;   ///< The sprite to copy for missiles fired by the bunny.
+        std::shared_ptr<sf::Sprite> m_alienMissileSprite;   ///< The sprite to copy for missiles fired by aliens.
+        std::list< std::shared_ptr<OBJECTS::Explosion> > m_explosions;    ///< Explosions created from missile collisions, from oldest to newest.
     };
 }
\ No newline at end of file
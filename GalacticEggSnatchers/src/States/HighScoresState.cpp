@@ -1,13 +1,17 @@
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
+#include "Resources/AssetFilepaths.h"
 #include "States/HighScoresState.h"
 
 using namespace STATES;
 
-HighScoresState::HighScoresState(const sf::FloatRect& screenBoundsInPixels) :
+HighScoresState::HighScoresState(
+    const sf::FloatRect& screenBoundsInPixels,
+    const std::shared_ptr<RESOURCES::ResourceManager>& resourceManager) :
     m_screenBoundsInPixels(screenBoundsInPixels),
-    m_resourceManager(),
+    m_resourceManager(resourceManager),
+    m_font(),
     m_nextGameState(GAME_STATE_TYPE_INVALID),
     m_highScoresTitle(),
     m_highScores()
@@ -37,7 +41,7 @@ void HighScoresState::Update(const sf::Time& elapsedTime)
     // Nothing else to do.
 }
 
-void HighScoresState::Render(sf::RenderTarget& renderTarget)
+void HighScoresState::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
 {
     // RENDER THE HIGH SCORES TITLE.
     renderTarget.draw(m_highScoresTitle);
@@ -98,8 +102,8 @@ SAVE_DATA::HighScores HighScoresState::LoadHighScores() const
 void HighScoresState::InitializeHighScoresText(SAVE_DATA::HighScores& highScores)
 {
     // LOAD THE FONT FOR THE HIGH SCORES TEXT.
-    const std::string HIGH_SCORES_FONT_FILEPATH = "res/fonts/Minecraftia.ttf";
-    std::shared_ptr<sf::Font> highScoresFont = m_resourceManager.GetFont(HIGH_SCORES_FONT_FILEPATH);
+    const std::string& HIGH_SCORES_FONT_FILEPATH = RESOURCES::GetAssetFilepath(RESOURCES::ASSET_FONT_MINECRAFTIA);
+    std::shared_ptr<sf::Font> highScoresFont = m_resourceManager->GetFont(HIGH_SCORES_FONT_FILEPATH);
     bool highScoresFontLoaded = (nullptr != highScoresFont);
     if (!highScoresFontLoaded)
     {
@@ -109,6 +113,7 @@ void HighScoresState::InitializeHighScoresText(SAVE_DATA::HighScores& highScores
     // SET THE TITLE FOR THE HIGH SCORES SCREEN.
     const unsigned int HIGH_SCORE_TITLE_TEXT_HEIGHT_IN_PIXELS = 24;
     m_highScoresTitle.setCharacterSize(HIGH_SCORE_TITLE_TEXT_HEIGHT_IN_PIXELS);
+    m_font = highScoresFont;
     m_highScoresTitle.setFont(*highScoresFont);
     m_highScoresTitle.setString("High Scores");
 
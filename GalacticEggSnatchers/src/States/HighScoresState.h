@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 #include "Resources/ResourceManager.h"
 #include "SaveData/HighScores.h"
@@ -15,7 +16,10 @@ namespace STATES
     public:
         /// @brief  Constructor.
         /// @param[in]  screenBoundsInPixels - The boundaries of the screen.
-        explicit HighScoresState(const sf::FloatRect& screenBoundsInPixels);
+        /// @param[in]  resourceManager - The resource manager shared by all states.
+        explicit HighScoresState(
+            const sf::FloatRect& screenBoundsInPixels,
+            const std::shared_ptr<RESOURCES::ResourceManager>& resourceManager);
 
         /// @brief  Destructor.
         virtual ~HighScoresState();
@@ -29,8 +33,8 @@ namespace STATES
         /// @copydoc    IGameState::Update(const sf::Time& elapsedTime)
         virtual void Update(const sf::Time& elapsedTime);
 
-        /// @copydoc    IGameState::Render(sf::RenderTarget& renderTarget)
-        virtual void Render(sf::RenderTarget& renderTarget);
+        /// @copydoc    IGameState::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
+        virtual void Render(sf::RenderTarget& renderTarget, const float interpolationRatio);
 
         /// @copydoc    IGameState::HandleKeyPress(const sf::Keyboard::Key key)
         virtual void HandleKeyPress(const sf::Keyboard::Key key);
@@ -48,7 +52,8 @@ namespace STATES
         void InitializeHighScoresText(SAVE_DATA::HighScores& highScores);
 
         sf::FloatRect m_screenBoundsInPixels;   ///< The boundaries of the screen.
-        RESOURCES::ResourceManager m_resourceManager;   ///< The resource manager.
+        std::shared_ptr<RESOURCES::ResourceManager> m_resourceManager;   ///< The resource manager.
+        std::shared_ptr<sf::Font> m_font;   ///< The font for all text on the high scores screen.  Held so that it remains loaded while used by the text.
         GameStateType m_nextGameState;  ///< The next game state that should follow when the user is done viewing high scores.
         sf::Text m_highScoresTitle; ///< A title displayed on the screen to identify that high scores are displayed.
         std::vector<sf::Text> m_highScores; ///< The high scores displayed on screen.
@@ -45,7 +45,10 @@ namespace STATES
 
         /// @brief          Renders a frame for the current game state.
         /// @param[in,out]  renderTarget - The render target to render to.
-        virtual void Render(sf::RenderTarget& renderTarget) = 0;
+        /// @param[in]      interpolationRatio - How far (from 0 to 1) the rendered frame lies between
+        ///                 the previous and current simulation updates.  Used to smooth movement
+        ///                 when rendering occurs at a different rate than simulation.
+        virtual void Render(sf::RenderTarget& renderTarget, const float interpolationRatio) = 0;
 
         /// @brief      Handles a key being pressed.
         /// @param[in]  key - The key that was pressed.
@@ -1,13 +1,17 @@
 #include <stdexcept>
+#include "Resources/AssetFilepaths.h"
 #include "States/TitleState.h"
 
 using namespace STATES;
 
 TitleState::TitleState(
     const std::string& title, 
-    const sf::FloatRect& screenBoundsInPixels) :
+    const sf::FloatRect& screenBoundsInPixels,
+    const std::shared_ptr<RESOURCES::ResourceManager>& resourceManager) :
     m_screenBoundsInPixels(screenBoundsInPixels),
-    m_resourceManager(),
+    m_resourceManager(resourceManager),
+    m_titleFont(),
+    m_menuOptionFont(),
     m_titleLabel(),
     m_menuOptions(),
     m_menuKeyToNextGameStateMap(),
@@ -37,7 +41,7 @@ void TitleState::Update(const sf::Time& elapsedTime)
     // Nothing else to do.
 }
 
-void TitleState::Render(sf::RenderTarget& renderTarget)
+void TitleState::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
 {
     // RENDER THE TITLE TEXT.
     renderTarget.draw(m_titleLabel);
@@ -64,8 +68,8 @@ void TitleState::HandleKeyPress(const sf::Keyboard::Key key)
 void TitleState::InitializeTitleLabel(const std::string& title)
 {
     // SET THE FONT FOR THE TITLE TEXT.
-    const std::string TITLE_FONT_FILEPATH = "res/fonts/Minecraftia.ttf";
-    std::shared_ptr<sf::Font> titleFont = m_resourceManager.GetFont(TITLE_FONT_FILEPATH);
+    const std::string& TITLE_FONT_FILEPATH = RESOURCES::GetAssetFilepath(RESOURCES::ASSET_FONT_MINECRAFTIA);
+    std::shared_ptr<sf::Font> titleFont = m_resourceManager->GetFont(TITLE_FONT_FILEPATH);
     bool titleFontLoaded = (nullptr != titleFont);
     if (!titleFontLoaded)
     {
@@ -75,6 +79,7 @@ void TitleState::InitializeTitleLabel(const std::string& title)
     // SET BASIC PARAMETERS FOR THE TITLE.
     const unsigned int TITLE_FONT_SIZE_IN_PIXELS = 24;
     m_titleLabel.setCharacterSize(TITLE_FONT_SIZE_IN_PIXELS);
+    m_titleFont = titleFont;
     m_titleLabel.setFont(*titleFont);
     m_titleLabel.setString(title);
 
@@ -93,13 +98,14 @@ void TitleState::InitializeTitleLabel(const std::string& title)
 void TitleState::InitializeMenuOptions()
 {
     // LOAD THE RESOURCES FOR THE MENU OPTIONS.
-    const std::string MENU_OPTION_FONT_FILEPATH = "res/fonts/Minecraftia.ttf";
-    std::shared_ptr<sf::Font> menuOptionFont = m_resourceManager.GetFont(MENU_OPTION_FONT_FILEPATH);
+    const std::string& MENU_OPTION_FONT_FILEPATH = RESOURCES::GetAssetFilepath(RESOURCES::ASSET_FONT_MINECRAFTIA);
+    std::shared_ptr<sf::Font> menuOptionFont = m_resourceManager->GetFont(MENU_OPTION_FONT_FILEPATH);
     bool menuOptionFontLoaded = (nullptr != menuOptionFont);
     if (!menuOptionFontLoaded)
     {
         throw std::runtime_error("Error loading menu option font.");
     }
+    m_menuOptionFont = menuOptionFont;
 
     const unsigned int MENU_OPTION_FONT_HEIGHT_IN_PIXELS = 14;
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <unordered_map>
 #include <vector>
 #include <SFML/Window.hpp>
@@ -17,9 +18,11 @@ namespace STATES
         /// @brief      Constructor.
         /// @param[in]  title - The title to display on the screen.
         /// @param[in]  screenBoundsInPixels - The boundaries of the screen.
+        /// @param[in]  resourceManager - The resource manager shared by all states.
         explicit TitleState(
             const std::string& title,
-            const sf::FloatRect& screenBoundsInPixels);
+            const sf::FloatRect& screenBoundsInPixels,
+            const std::shared_ptr<RESOURCES::ResourceManager>& resourceManager);
 
         /// @brief  Destructor.
         virtual ~TitleState();
@@ -33,8 +36,8 @@ namespace STATES
         /// @copydoc    IGameState::Update(const sf::Time& elapsedTime)
         virtual void Update(const sf::Time& elapsedTime);
 
-        /// @copydoc    IGameState::Render(sf::RenderTarget& renderTarget)
-        virtual void Render(sf::RenderTarget& renderTarget);
+        /// @copydoc    IGameState::Render(sf::RenderTarget& renderTarget, const float interpolationRatio)
+        virtual void Render(sf::RenderTarget& renderTarget, const float interpolationRatio);
 
         /// @copydoc    IGameState::HandleKeyPress(const sf::Keyboard::Key key)
         virtual void HandleKeyPress(const sf::Keyboard::Key key);
@@ -51,7 +54,9 @@ namespace STATES
         void InitializeMenuOptions();
 
         sf::FloatRect m_screenBoundsInPixels;   ///< The boundaries of the screen.
-        RESOURCES::ResourceManager m_resourceManager;   ///< The resource manager.
+        std::shared_ptr<RESOURCES::ResourceManager> m_resourceManager;   ///< The resource manager.
+        std::shared_ptr<sf::Font> m_titleFont;  ///< The font for the title.  Held so that it remains loaded while used by the title label.
+        std::shared_ptr<sf::Font> m_menuOptionFont; ///< The font for menu options.  Held so that it remains loaded while used by the menu options.
         sf::Text m_titleLabel;  ///< The label for the title.
         std::vector<sf::Text> m_menuOptions; ///< The menu options on the title screen.
         std::unordered_map<sf::Keyboard::Key, GameStateType> m_menuKeyToNextGameStateMap;   ///< Maps pressed keyboard keys to the next game state from menu options.
@@ -1,11 +1,141 @@
 #include <cstdlib>
 #include <exception>
+#include <fstream>
 #include <iostream>
+#include <stdexcept>
 #if defined _WINDOWS
 #include <Windows.h>
 #endif
 #include <SFML/Graphics.hpp>
+#include "Benchmarks/AlienAiBenchmark.h"
+#include "Benchmarks/AssetLoadingBenchmark.h"
+#include "Benchmarks/BenchmarkMeasurement.h"
+#include "Benchmarks/CollisionBenchmark.h"
+#include "Benchmarks/HighScoresBenchmark.h"
+#include "Benchmarks/RectangleIntersectionBenchmark.h"
+#include "Benchmarks/ResourceLookupBenchmark.h"
+#include "CommandLineOptions.h"
 #include "GalacticEggSnatchersGame.h"
+#include "Input/InputRecording.h"
+#include "Profiling/Profiling.h"
+#include "Resources/AssetArchive.h"
+#include "Resources/AssetFilepaths.h"
+#include "Resources/DecodedImageCache.h"
+#include "Resources/ResourceManager.h"
+#include "Simulation/HeadlessSimulation.h"
+
+/// @brief      Runs the gameplay simulation without a window or audio device
+///             and reports its performance.
+/// @param[in]  options - The options specifying how to run the simulation.
+/// @return     EXIT_SUCCESS if the simulation completes successfully.
+///             EXIT_FAILURE if the report could not be written or if steady-state
+///             allocations were asserted against but occurred or can't be counted.
+///             An exception is thrown if recorded input to replay can't be loaded.
+int RunHeadlessSimulation(const CommandLineOptions& options)
+{
+    // CHECK THAT ALLOCATIONS CAN BE ASSERTED AGAINST IF REQUESTED.
+    // This is checked before running so that an unsupported request doesn't waste a whole run.
+#if !defined PROFILING_ENABLED
+    if (options.AssertNoSteadyStateAllocations)
+    {
+        std::cerr << "Allocation assertions are not supported in builds without profiling enabled." << std::endl;
+        return EXIT_FAILURE;
+    }
+#endif
+
+    // CREATE THE SIMULATION.
+    SIMULATION::HeadlessSimulation simulation(
+        GalacticEggSnatchersGame::GetScreenBoundsInPixels(),
+        options.SimulationTicksPerSecond,
+        options.HeadlessRandomSeed);
+    unsigned int tickCount = options.HeadlessTickCount;
+
+    // REPLAY RECORDED INPUT IF REQUESTED.
+    // The run covers exactly the recorded ticks so that it simulates the same workload as the recording,
+    // ending early if the recorded gameplay session ends before its input runs out.
+    bool inputReplayRequested = !options.InputReplayFilepath.empty();
+    if (inputReplayRequested)
+    {
+        std::shared_ptr<INPUT::InputRecording> recording = INPUT::InputRecording::Load(options.InputReplayFilepath);
+        if (!recording)
+        {
+            throw std::runtime_error("Error loading input recording: " + options.InputReplayFilepath);
+        }
+
+        simulation.ReplayInput(recording);
+        tickCount = recording->GetTickCount();
+    }
+
+    // RUN THE SIMULATION.
+    SIMULATION::HeadlessSimulationResults results = simulation.Run(tickCount);
+
+    // REPORT THE RESULTS.
+    results.WriteReport(std::cout);
+    PROFILE_WRITE_REPORT();
+
+    bool reportFileRequested = !options.HeadlessReportFilepath.empty();
+    if (reportFileRequested)
+    {
+        std::ofstream reportFile(options.HeadlessReportFilepath);
+        results.WriteReport(reportFile);
+
+        bool reportFileWritten = reportFile.good();
+        if (!reportFileWritten)
+        {
+            std::cerr << "Error writing headless report: " << options.HeadlessReportFilepath << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    // CHECK THAT STEADY-STATE GAMEPLAY DIDN'T ALLOCATE IF REQUESTED.
+    if (options.AssertNoSteadyStateAllocations)
+    {
+        bool steadyStateAllocated = (results.SteadyStateAllocationCount > 0);
+        if (steadyStateAllocated)
+        {
+            std::cerr << "Steady-state gameplay made " << results.SteadyStateAllocationCount
+                << " heap allocations.  See the allocation report for where they came from." << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief      Runs a stress test of the gameplay simulation without a window or audio device
+///             and reports how its performance scales.
+/// @param[in]  options - The options specifying how to run the stress test.
+/// @return     EXIT_SUCCESS if the stress test completes successfully.
+///             EXIT_FAILURE if the report could not be written.
+int RunStressTest(const CommandLineOptions& options)
+{
+    // RUN THE STRESS TEST.
+    SIMULATION::HeadlessSimulation simulation(
+        GalacticEggSnatchersGame::GetScreenBoundsInPixels(),
+        options.SimulationTicksPerSecond,
+        options.HeadlessRandomSeed);
+    SIMULATION::StressTestResults results = simulation.RunStressTest(options.StressTestParameters);
+
+    // REPORT THE RESULTS.
+    results.WriteReport(std::cout);
+    PROFILE_WRITE_REPORT();
+
+    bool reportFileRequested = !options.HeadlessReportFilepath.empty();
+    if (reportFileRequested)
+    {
+        std::ofstream reportFile(options.HeadlessReportFilepath);
+        results.WriteReport(reportFile);
+
+        bool reportFileWritten = reportFile.good();
+        if (!reportFileWritten)
+        {
+            std::cerr << "Error writing stress test report: " << options.HeadlessReportFilepath << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
 
 #if defined _CONSOLE
 /// @brief      The main entry point function for the game.
@@ -28,18 +158,127 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 {
     try
     {
+        // PARSE THE COMMAND LINE.
+#if defined _CONSOLE
+        CommandLineOptions options = CommandLineOptions::Parse(argumentCount, arguments);
+#elif defined _WINDOWS
+        CommandLineOptions options = CommandLineOptions::Parse(__argc, __argv);
+#endif
+
+        // START TRACING IF REQUESTED.
+        bool tracingRequested = !options.TraceFilepath.empty();
+        if (tracingRequested)
+        {
+#if defined PROFILING_ENABLED
+            TRACE_START(options.TraceFilepath);
+#else
+            std::cerr << "Tracing is not supported in builds without profiling enabled." << std::endl;
+            return EXIT_FAILURE;
+#endif
+        }
+
+        // SET THE HITCH BUDGET IF REQUESTED.
+        // Otherwise, the flight recorder's default budget is used.
+        bool hitchBudgetSpecified = (options.HitchBudgetInMilliseconds > 0);
+        if (hitchBudgetSpecified)
+        {
+#if defined PROFILING_ENABLED
+            PROFILE_SET_HITCH_BUDGET(sf::milliseconds(static_cast<sf::Int32>(options.HitchBudgetInMilliseconds)));
+#else
+            std::cerr << "Hitch recording is not supported in builds without profiling enabled." << std::endl;
+            return EXIT_FAILURE;
+#endif
+        }
+
+        // CHECK IF ONLY BENCHMARKS SHOULD BE RUN.
+        if (options.BenchmarkMode)
+        {
+            // Gameplay hot paths are measured with each entity count so that their scaling can be tracked.
+            std::vector<unsigned int> entityCounts = BENCHMARKS::GetDefaultEntityCounts();
+            bool entityCountSpecified = (options.BenchmarkEntityCount > 0);
+            if (entityCountSpecified)
+            {
+                entityCounts.assign(1, options.BenchmarkEntityCount);
+            }
+
+            BENCHMARKS::RunBoundaryCollisionBenchmark(entityCounts, std::cout);
+            BENCHMARKS::RunGameplayCollisionBenchmark(entityCounts, std::cout);
+            BENCHMARKS::RunRectangleIntersectionBenchmark(std::cout);
+            BENCHMARKS::RunAlienAiBenchmark(entityCounts, std::cout);
+            BENCHMARKS::RunHighScoresBenchmark(std::cout);
+            BENCHMARKS::RunResourceLookupBenchmark(entityCounts, std::cout);
+            BENCHMARKS::RunAssetLoadingBenchmark(std::cout);
+            TRACE_STOP();
+            return EXIT_SUCCESS;
+        }
+
+        // CHECK IF ONLY THE ASSET ARCHIVE SHOULD BE BUILT.
+        if (options.PackAssetsMode)
+        {
+            std::vector<std::string> assetFilepaths = RESOURCES::GetAllAssetFilepaths();
+            RESOURCES::AssetArchive::Write(RESOURCES::AssetArchive::DEFAULT_FILEPATH, assetFilepaths);
+            std::cout << "Packed " << assetFilepaths.size() << " assets into " << RESOURCES::AssetArchive::DEFAULT_FILEPATH << std::endl;
+
+            // DECODE ALL IMAGES AHEAD OF TIME.
+            // Loading the images from the new archive populates the decoded image cache,
+            // so the game never has to decode images itself on startup.
+            RESOURCES::ResourceManager resourceManager;
+            const bool HEADLESS_MODE = false;
+            resourceManager.LoadAllAssets(HEADLESS_MODE);
+
+            bool decodedImagesSaved = resourceManager.SaveDecodedImageCache();
+            if (!decodedImagesSaved)
+            {
+                throw std::runtime_error("Error writing decoded image cache: " + RESOURCES::DecodedImageCache::DEFAULT_FILEPATH);
+            }
+
+            std::cout << "Decoded images into " << RESOURCES::DecodedImageCache::DEFAULT_FILEPATH << std::endl;
+            TRACE_STOP();
+            return EXIT_SUCCESS;
+        }
+
+        // CHECK IF ONLY A STRESS TEST OF THE GAMEPLAY SIMULATION SHOULD BE RUN.
+        if (options.StressTestMode)
+        {
+            int exitCode = RunStressTest(options);
+            TRACE_STOP();
+            return exitCode;
+        }
+
+        // CHECK IF ONLY THE GAMEPLAY SIMULATION SHOULD BE RUN.
+        if (options.HeadlessMode)
+        {
+            int exitCode = RunHeadlessSimulation(options);
+            TRACE_STOP();
+            return exitCode;
+        }
+
         // CREATE THE GAME.
-        GalacticEggSnatchersGame game;
+        const std::size_t BYTES_PER_KILOBYTE = 1024;
+        std::size_t resourceMemoryBudgetInBytes = static_cast<std::size_t>(options.ResourceMemoryBudgetInKilobytes) * BYTES_PER_KILOBYTE;
+        GalacticEggSnatchersGame game(
+            resourceMemoryBudgetInBytes,
+            options.SimulationTicksPerSecond,
+            options.InputRecordingFilepath);
 
         // CREATE THE WINDOW.
         sf::RenderWindow window(
             sf::VideoMode(GalacticEggSnatchersGame::SCREEN_WIDTH_IN_PIXELS, GalacticEggSnatchersGame::SCREEN_HEIGHT_IN_PIXELS), 
             GalacticEggSnatchersGame::GAME_TITLE);
 
+        // DETERMINE THE FIXED TIME STEP FOR SIMULATING THE GAME.
+        // The game is always updated in fixed steps so that simulation cost and behavior
+        // do not depend on how quickly frames can be rendered.
+        const sf::Time SIMULATION_TIME_STEP = sf::seconds(1.0f / static_cast<float>(options.SimulationTicksPerSecond));
+        const float SIMULATION_TIME_STEP_IN_SECONDS = SIMULATION_TIME_STEP.asSeconds();
+
         // PROCESS EVENTS AS LONG AS THE WINDOW REMAINS OPEN.
         sf::Clock gameLoopClock;
+        sf::Time unsimulatedTime = sf::Time::Zero;
         while (window.isOpen())
         {
+            TRACE_SCOPE("main", "Frame");
+
             // PROCESS WINDOW EVENTS.
             sf::Event event;
             while (window.pollEvent(event))
@@ -51,6 +290,14 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
                     window.close();
                     break;
                 case sf::Event::KeyPressed:
+#if defined PROFILING_ENABLED
+                    // Write the frame profile on request without passing the key to the game.
+                    if (sf::Keyboard::F9 == event.key.code)
+                    {
+                        PROFILE_WRITE_REPORT();
+                        break;
+                    }
+#endif
                     game.HandleKeyPress(event.key.code);
                     break;
                 }
@@ -59,27 +306,55 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
             // UPDATE AND DISPLAY THE GAME IN THE WINDOW.
             if (window.isOpen())
             {
-                // Update the game for the new frame.
-                sf::Time elapsedTime = gameLoopClock.restart();
-                game.Update(elapsedTime);
-            
-                // Render the current state of the game.
+                // Update the game in fixed steps for all elapsed time since the last frame.
+                // The number of steps per frame is capped so that a long hitch does not
+                // cause a burst of updates that makes the following frame even longer.
+                unsimulatedTime += gameLoopClock.restart();
+                unsigned int simulationTicksThisFrame = 0;
+                bool simulationCaughtUp = (unsimulatedTime < SIMULATION_TIME_STEP);
+                while (!simulationCaughtUp && simulationTicksThisFrame < options.MaxCatchUpTicksPerFrame)
+                {
+                    game.Update(SIMULATION_TIME_STEP);
+                    unsimulatedTime -= SIMULATION_TIME_STEP;
+                    ++simulationTicksThisFrame;
+
+                    simulationCaughtUp = (unsimulatedTime < SIMULATION_TIME_STEP);
+                }
+
+                // Drop any time that could not be caught up on.
+                // The game will appear to briefly slow down rather than stalling rendering.
+                if (!simulationCaughtUp)
+                {
+                    unsimulatedTime = sf::Time::Zero;
+                }
+
+                // Render the current state of the game between the last two simulation steps.
+                float interpolationRatio = unsimulatedTime.asSeconds() / SIMULATION_TIME_STEP_IN_SECONDS;
                 window.clear();
-                game.Render(window);
-                window.display();
+                game.Render(window, interpolationRatio);
+                {
+                    PROFILE_PHASE(PROFILED_PHASE_DISPLAY);
+                    window.display();
+                }
+
+                PROFILE_END_FRAME();
             }
         }
 
+        PROFILE_WRITE_REPORT();
+        TRACE_STOP();
         return EXIT_SUCCESS;
     }
     catch (std::exception& exception)
     {
         std::cerr << "Exception during game: " << exception.what() << std::endl;
+        TRACE_STOP();
         return EXIT_FAILURE;
     }
     catch (...)
     {
         std::cerr << "Unknown error during game." << std::endl;
+        TRACE_STOP();
         return EXIT_FAILURE;
     }
 }
\ No newline at end of file